@@ -0,0 +1,113 @@
+#ifndef FT_CONTAINERS_ALLOC_BENCH_HPP
+# define FT_CONTAINERS_ALLOC_BENCH_HPP
+
+# include <functional>
+# include "counting_allocator.hpp"
+# include "bench.hpp"
+# include "vector_bench.hpp"
+# include "list_bench.hpp"
+# include "map_bench.hpp"
+# include "set_bench.hpp"
+
+namespace bench {
+
+    /**
+     * Allocator calls made by one workload run, per element
+     */
+    struct AllocCount {
+        double allocations;
+        double deallocations;
+        double bytes;
+    };
+
+    /**
+     * Count the allocations made by the run() phase of a workload.
+     * Containers are default constructed, so they count into the shared ft::default_allocation_stats()
+     * @tparam Workload Workload type over a container using ft::counting_allocator
+     */
+    template<typename Workload, typename T>
+    AllocCount count_allocations(const Input<T> &in) {
+        ft::allocation_stats &stats = ft::default_allocation_stats();
+        Workload             work;
+
+        work.prepare(in);
+        work.reset(in);
+
+        ft::allocation_stats before = stats;
+        work.run(in);
+
+        AllocCount res;
+        double     n = static_cast<double>(in.size());
+        res.allocations = static_cast<double>(stats.allocations - before.allocations) / n;
+        res.deallocations = static_cast<double>(stats.deallocations - before.deallocations) / n;
+        res.bytes = static_cast<double>(stats.allocated_bytes - before.allocated_bytes) / n;
+        return (res);
+    }
+
+    inline void alloc_section(const char *name) {
+        std::cout << std::endl << "====== " << name << " (per element) ======" << std::endl;
+        std::cout << std::left << std::setw(10) << "container" << std::setw(12) << "op" << std::setw(8) << "type"
+                  << std::right << std::setw(10) << "size"
+                  << std::setw(12) << "ft allocs" << std::setw(12) << "std allocs"
+                  << std::setw(12) << "ft frees" << std::setw(12) << "std frees"
+                  << std::setw(12) << "ft bytes" << std::setw(12) << "std bytes" << std::endl;
+    }
+
+    /**
+     * Count allocations of the same workload on the ft and the std container and print one row
+     */
+    template<template<typename> class Workload, typename FtType, typename StdType, typename T>
+    void compare_allocations(const char *container, const char *op, const Input<T> &in) {
+        AllocCount ft_count = count_allocations< Workload<FtType> >(in);
+        AllocCount std_count = count_allocations< Workload<StdType> >(in);
+
+        std::cout << std::left << std::setw(10) << container << std::setw(12) << op << std::setw(8) << type_name<T>::get()
+                  << std::right << std::setw(10) << in.size() << std::fixed << std::setprecision(2)
+                  << std::setw(12) << ft_count.allocations << std::setw(12) << std_count.allocations
+                  << std::setw(12) << ft_count.deallocations << std::setw(12) << std_count.deallocations
+                  << std::setw(12) << ft_count.bytes << std::setw(12) << std_count.bytes << std::endl;
+    }
+
+    template<typename T>
+    void alloc_bench(const Report &report) {
+        typedef ft::counting_allocator<T>                                    alloc_type;
+        typedef ft::counting_allocator< ft::pair<const T, int> >             ft_pair_alloc;
+        typedef ft::counting_allocator< std::pair<const T, int> >            std_pair_alloc;
+        typedef ft::vector<T, alloc_type>                                    ft_vector;
+        typedef std::vector<T, alloc_type>                                   std_vector;
+        typedef ft::list<T, alloc_type>                                      ft_list;
+        typedef std::list<T, alloc_type>                                     std_list;
+        typedef ft::map<T, int, ft::less<T>, ft_pair_alloc>                  ft_map;
+        typedef std::map<T, int, std::less<T>, std_pair_alloc>               std_map;
+        typedef ft::set<T, ft::less<T>, alloc_type>                          ft_set;
+        typedef std::set<T, std::less<T>, alloc_type>                        std_set;
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 100) {
+            Input<T> in(n);
+            compare_allocations<VectorInsert, ft_vector, std_vector>("vector", "insert", in);
+            compare_allocations<VectorCopy, ft_vector, std_vector>("vector", "copy", in);
+            compare_allocations<VectorAssign, ft_vector, std_vector>("vector", "assign", in);
+            compare_allocations<ListInsert, ft_list, std_list>("list", "insert", in);
+            compare_allocations<ListCopy, ft_list, std_list>("list", "copy", in);
+            compare_allocations<ListAssign, ft_list, std_list>("list", "assign", in);
+            compare_allocations<ListSort, ft_list, std_list>("list", "sort", in);
+            compare_allocations<MapInsert, ft_map, std_map>("map", "insert", in);
+            compare_allocations<MapFind, ft_map, std_map>("map", "find", in);
+            compare_allocations<MapSubscriptHit, ft_map, std_map>("map", "index_hit", in);
+            compare_allocations<MapCopy, ft_map, std_map>("map", "copy", in);
+            compare_allocations<MapAssign, ft_map, std_map>("map", "assign", in);
+            compare_allocations<MapErase, ft_map, std_map>("map", "erase", in);
+            compare_allocations<SetInsert, ft_set, std_set>("set", "insert", in);
+            compare_allocations<SetCopy, ft_set, std_set>("set", "copy", in);
+        }
+    }
+
+    inline void alloc_bench(const Report &report) {
+        alloc_section("allocations");
+        alloc_bench<int>(report);
+        alloc_bench<Blob>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_ALLOC_BENCH_HPP
@@ -0,0 +1,291 @@
+#ifndef FT_CONTAINERS_BENCH_HPP
+# define FT_CONTAINERS_BENCH_HPP
+
+# include <time.h>
+# include <cstring>
+# include <algorithm>
+# include <string>
+# include <vector>
+# include <iostream>
+# include <iomanip>
+
+namespace bench {
+
+    /**
+     * Fixed-size trivially copyable payload used as a "large element" type
+     */
+    struct Blob {
+        int  key;
+        char data[60];
+
+        Blob(): key(0) {
+            std::memset(data, 0, sizeof(data));
+        }
+
+        explicit Blob(int k): key(k) {
+            std::memset(data, k & 0xff, sizeof(data));
+        }
+    };
+
+    inline bool operator<(const Blob &lhs, const Blob &rhs) {
+        return (lhs.key < rhs.key);
+    }
+
+    inline bool operator==(const Blob &lhs, const Blob &rhs) {
+        return (lhs.key == rhs.key);
+    }
+
+    template<typename T>
+    struct type_name {
+        static const char *get();
+    };
+
+    template<>
+    inline const char *type_name<int>::get() {
+        return ("int");
+    }
+
+    template<>
+    inline const char *type_name<std::string>::get() {
+        return ("string");
+    }
+
+    template<>
+    inline const char *type_name<Blob>::get() {
+        return ("blob64");
+    }
+
+    /**
+     * Largest input size for an element type. Heavy elements stop at 10^6,
+     * otherwise the input plus two container copies do not fit into memory
+     * @tparam T Element type
+     */
+    template<typename T>
+    struct size_limit {
+        static const size_t value = 10000000;
+    };
+
+    template<>
+    struct size_limit<std::string> {
+        static const size_t value = 1000000;
+    };
+
+    template<>
+    struct size_limit<Blob> {
+        static const size_t value = 1000000;
+    };
+
+    /**
+     * Cheap per-element value that depends on the element content
+     */
+    inline size_t weight(int value) {
+        return (static_cast<size_t>(value));
+    }
+
+    inline size_t weight(const std::string &value) {
+        return (value.size() + static_cast<unsigned char>(value[value.size() - 1]));
+    }
+
+    inline size_t weight(const Blob &value) {
+        return (static_cast<size_t>(value.key) + static_cast<unsigned char>(value.data[0]));
+    }
+
+    /**
+     * Build the i-th element of a benchmark input
+     * @tparam T Element type
+     */
+    template<typename T>
+    struct make_value {
+        static T get(size_t i);
+    };
+
+    template<>
+    inline int make_value<int>::get(size_t i) {
+        return (static_cast<int>(i));
+    }
+
+    /**
+     * Strings are 16 characters long, so they never fit into the small string buffer
+     */
+    template<>
+    inline std::string make_value<std::string>::get(size_t i) {
+        std::string s("key-000000000000");
+
+        for (size_t pos = s.size(); i && pos > 4; i /= 10)
+            s[--pos] = static_cast<char>('0' + i % 10);
+
+        return (s);
+    }
+
+    template<>
+    inline Blob make_value<Blob>::get(size_t i) {
+        return (Blob(static_cast<int>(i)));
+    }
+
+    /**
+     * Deterministic pseudo-random generator, so that ft and std always see the same input
+     */
+    class Random {
+        unsigned long long _state;
+
+    public:
+        explicit Random(unsigned long long seed = 42): _state(seed) {}
+
+        unsigned long long next() {
+            _state = _state * 6364136223846793005ULL + 1442695040888963407ULL;
+            return (_state >> 33);
+        }
+
+        size_t below(size_t n) {
+            return (static_cast<size_t>(next() % n));
+        }
+    };
+
+    /**
+     * Benchmark input: n distinct values in random and in sorted order
+     * @tparam T Element type
+     */
+    template<typename T>
+    struct Input {
+        std::vector<T> shuffled;
+        std::vector<T> sorted;
+
+        explicit Input(size_t n) {
+            sorted.reserve(n);
+            for (size_t i = 0; i < n; i++)
+                sorted.push_back(make_value<T>::get(i));
+
+            shuffled = sorted;
+            Random rnd;
+            for (size_t i = n; i > 1; i--)
+                std::swap(shuffled[i - 1], shuffled[rnd.below(i)]);
+        }
+
+        size_t size() const {
+            return (sorted.size());
+        }
+    };
+
+    /**
+     * Monotonic time
+     * @return Current time in nanoseconds
+     */
+    inline double now_ns() {
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return (static_cast<double>(ts.tv_sec) * 1e9 + static_cast<double>(ts.tv_nsec));
+    }
+
+    /**
+     * Keep a computed value alive so that the optimizer cannot drop the measured loop
+     */
+    inline void consume(size_t value) {
+        static volatile size_t sink;
+        sink = sink + value;
+    }
+
+    /**
+     * Number of repetitions so that each measurement performs about a million operations
+     * @param n Workload size
+     */
+    inline size_t repetitions(size_t n) {
+        const size_t target = 1000000;
+        return (n >= target ? 1 : target / n);
+    }
+
+    /**
+     * Run a workload repeatedly and measure only its run() phase
+     * @tparam Workload Type with reset(const Input&) and size_t run(const Input&)
+     * @param in Benchmark input
+     * @return Average time of one operation in nanoseconds
+     */
+    template<typename Workload, typename T>
+    double measure(const Input<T> &in) {
+        Workload work;
+        size_t   reps = repetitions(in.size());
+        size_t   ops = 0;
+        double   elapsed = 0;
+
+        work.prepare(in);
+        for (size_t r = 0; r < reps; r++) {
+            work.reset(in);
+            double start = now_ns();
+            ops += work.run(in);
+            elapsed += now_ns() - start;
+        }
+
+        return (ops ? elapsed / static_cast<double>(ops) : 0);
+    }
+
+    /**
+     * Workload base with no preparation: the container is built inside run()
+     */
+    struct Workload {
+        template<typename T>
+        void prepare(const Input<T> &) {}
+        template<typename T>
+        void reset(const Input<T> &) {}
+    };
+
+    /**
+     * Side by side ft/std results table
+     */
+    class Report {
+        size_t _max_size;
+        std::string _filter;
+
+    public:
+        Report(size_t max_size, const std::string &filter): _max_size(max_size), _filter(filter) {}
+
+        /**
+         * Largest size to run for an element type
+         * @tparam T Element type
+         */
+        template<typename T>
+        size_t max_size() const {
+            return (_max_size < size_limit<T>::value ? _max_size : size_limit<T>::value);
+        }
+
+        /**
+         * Whether the section was selected on the command line
+         */
+        bool enabled(const char *section) const {
+            return (_filter.empty() || _filter == section);
+        }
+
+        void section(const char *name) const {
+            std::cout << std::endl << "====== " << name << " ======" << std::endl;
+            std::cout << std::left << std::setw(10) << "container" << std::setw(12) << "op" << std::setw(8) << "type"
+                      << std::right << std::setw(10) << "size"
+                      << std::setw(12) << "ft ns/op" << std::setw(12) << "std ns/op"
+                      << std::setw(14) << "ft ops/s" << std::setw(14) << "std ops/s"
+                      << std::setw(8) << "ft/std" << std::endl;
+        }
+
+        void row(const char *container, const char *op, const char *type, size_t size, double ft_ns, double std_ns) const {
+            std::cout << std::left << std::setw(10) << container << std::setw(12) << op << std::setw(8) << type
+                      << std::right << std::setw(10) << size << std::fixed
+                      << std::setprecision(2) << std::setw(12) << ft_ns << std::setw(12) << std_ns
+                      << std::setprecision(0) << std::setw(14) << (ft_ns > 0 ? 1e9 / ft_ns : 0)
+                      << std::setw(14) << (std_ns > 0 ? 1e9 / std_ns : 0)
+                      << std::setprecision(2) << std::setw(8) << (std_ns > 0 ? ft_ns / std_ns : 0)
+                      << std::endl;
+        }
+    };
+
+    /**
+     * Measure the same workload on the ft and the std container and print one row
+     * @tparam Workload  Workload template, instantiated with both containers
+     * @tparam FtType    ft:: container type
+     * @tparam StdType   std:: container type
+     */
+    template<template<typename> class Workload, typename FtType, typename StdType, typename T>
+    void compare(const Report &report, const char *container, const char *op, const Input<T> &in) {
+        double ft_ns = measure< Workload<FtType> >(in);
+        double std_ns = measure< Workload<StdType> >(in);
+        report.row(container, op, type_name<T>::get(), in.size(), ft_ns, std_ns);
+    }
+
+}
+
+#endif //FT_CONTAINERS_BENCH_HPP
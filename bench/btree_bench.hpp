@@ -0,0 +1,68 @@
+#ifndef FT_CONTAINERS_BTREE_BENCH_HPP
+# define FT_CONTAINERS_BTREE_BENCH_HPP
+
+# include <map>
+# include "btree_map.hpp"
+# include "map.hpp"
+# include "bench.hpp"
+# include "map_bench.hpp"
+
+namespace bench {
+
+    /**
+     * Read a short run of elements from a random key on: lower_bound then a few steps forward
+     */
+    template<typename Map>
+    struct MapScan: MapFind<Map> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            const size_t span = 16;
+            size_t       sum = 0;
+
+            for (size_t i = 0; i < in.size(); i++) {
+                typename Map::const_iterator it = this->m.lower_bound(in.shuffled[i]);
+                for (size_t j = 0; j < span && it != this->m.end(); j++, it++)
+                    sum += it->second;
+            }
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    template<typename T>
+    void btree_bench(const Report &report) {
+        typedef ft::btree_map<T, int> ft_type;
+        typedef std::map<T, int>      std_type;
+        typedef ft::map<T, int>       tree_type;
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+            compare<MapInsert, ft_type, std_type>(report, "btree", "insert", in);
+            compare<MapInsertHintSorted, ft_type, std_type>(report, "btree", "hint_asc", in);
+            compare<MapErase, ft_type, std_type>(report, "btree", "erase", in);
+            compare<MapFind, ft_type, std_type>(report, "btree", "find", in);
+            compare<MapFindLatency, ft_type, std_type>(report, "btree", "find_lat", in);
+            compare<MapScan, ft_type, std_type>(report, "btree", "scan", in);
+            compare<MapIterate, ft_type, std_type>(report, "btree", "iterate", in);
+            compare<MapCopy, ft_type, std_type>(report, "btree", "copy", in);
+            compare<MapInsert, ft_type, tree_type>(report, "btree/map", "insert", in);
+            compare<MapErase, ft_type, tree_type>(report, "btree/map", "erase", in);
+            compare<MapFind, ft_type, tree_type>(report, "btree/map", "find", in);
+            compare<MapScan, ft_type, tree_type>(report, "btree/map", "scan", in);
+            compare<MapIterate, ft_type, tree_type>(report, "btree/map", "iterate", in);
+        }
+    }
+
+    /**
+     * ft::btree_map against std::map, then against ft::map: in the btree/map rows
+     * the std columns hold the ft::map times
+     */
+    inline void btree_bench(const Report &report) {
+        report.section("btree");
+        btree_bench<int>(report);
+        btree_bench<std::string>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_BTREE_BENCH_HPP
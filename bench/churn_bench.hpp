@@ -0,0 +1,91 @@
+#ifndef FT_CONTAINERS_CHURN_BENCH_HPP
+# define FT_CONTAINERS_CHURN_BENCH_HPP
+
+# include <cmath>
+# include <map>
+# include "map.hpp"
+# include "bench.hpp"
+
+namespace bench {
+
+    /**
+     * Long-running map under random insert/erase traffic. The keys are drawn from [0, 2n):
+     * a step erases the key if it is in the map and inserts it otherwise, so the map keeps about n elements
+     * while its shape is rebuilt over and over. ft and std replay the same key sequence
+     * @tparam Map Map from int to int
+     */
+    template<typename Map>
+    struct MapChurnCycles {
+        Map    m;
+        Random rnd;
+        size_t key_space;
+
+        explicit MapChurnCycles(size_t n): rnd(7), key_space(2 * n) {
+            Random fill(11);
+            while (m.size() < n)
+                m.insert(typename Map::value_type(static_cast<int>(fill.below(key_space)), 0));
+        }
+
+        /**
+         * Run steps
+         * @return Time of one step in nanoseconds
+         */
+        double run(size_t steps) {
+            size_t sum = 0;
+            double start = now_ns();
+
+            for (size_t i = 0; i < steps; i++) {
+                int key = static_cast<int>(rnd.below(key_space));
+                if (m.erase(key) == 0)
+                    m.insert(typename Map::value_type(key, static_cast<int>(i)));
+                sum += m.size();
+            }
+
+            double elapsed = now_ns() - start;
+            consume(sum);
+            return (elapsed / static_cast<double>(steps));
+        }
+    };
+
+    inline void churn_section(const char *name) {
+        std::cout << std::endl << "====== " << name << " ======" << std::endl;
+        std::cout << std::left << std::setw(10) << "container" << std::setw(12) << "op" << std::setw(8) << "type"
+                  << std::right << std::setw(10) << "size" << std::setw(12) << "steps"
+                  << std::setw(12) << "ft ns/op" << std::setw(12) << "std ns/op"
+                  << std::setw(10) << "height" << std::setw(10) << "bound" << std::setw(8) << "valid" << std::endl;
+    }
+
+    /**
+     * Run millions of churn steps per size and print one row per epoch, with the ft tree height after
+     * the epoch next to the red-black bound 2 * log2(n + 1) and the result of a full invariant check
+     */
+    inline void churn_bench(const Report &report) {
+        typedef ft::map<int, int>  ft_map;
+        typedef std::map<int, int> std_map;
+
+        const size_t epochs = 4;
+        const size_t epoch_steps = 1000000;
+
+        churn_section("churn (random insert/erase)");
+
+        for (size_t n = 1000; n <= report.max_size<int>() / 10; n *= 10) {
+            MapChurnCycles<ft_map>  ft_churn(n);
+            MapChurnCycles<std_map> std_churn(n);
+            double                  bound = 2 * std::log(static_cast<double>(n) + 1) / std::log(2.0);
+
+            for (size_t e = 1; e <= epochs; e++) {
+                double ft_ns = ft_churn.run(epoch_steps);
+                double std_ns = std_churn.run(epoch_steps);
+
+                std::cout << std::left << std::setw(10) << "map" << std::setw(12) << "churn" << std::setw(8) << "int"
+                          << std::right << std::setw(10) << ft_churn.m.size() << std::setw(12) << e * epoch_steps
+                          << std::fixed << std::setprecision(2) << std::setw(12) << ft_ns << std::setw(12) << std_ns
+                          << std::setw(10) << ft_churn.m.height() << std::setprecision(1) << std::setw(10) << bound
+                          << std::setw(8) << (ft_churn.m.verify() ? "yes" : "NO") << std::endl;
+            }
+        }
+    }
+
+}
+
+#endif //FT_CONTAINERS_CHURN_BENCH_HPP
@@ -0,0 +1,66 @@
+#ifndef FT_CONTAINERS_FLAT_BENCH_HPP
+# define FT_CONTAINERS_FLAT_BENCH_HPP
+
+# include <map>
+# include "flat_map.hpp"
+# include "map.hpp"
+# include "vector.hpp"
+# include "bench.hpp"
+# include "map_bench.hpp"
+# include "btree_bench.hpp"
+
+namespace bench {
+
+    /**
+     * A flat_map is filled with one range insert, inserting the keys one by one in random order takes quadratic time
+     */
+    template<typename Key, typename Compare, typename Alloc, typename T>
+    void fill_map(ft::flat_map<Key, int, Compare, Alloc> &m, const Input<T> &in) {
+        ft::vector< ft::pair<Key, int> > pairs;
+
+        pairs.reserve(in.size());
+        for (size_t i = 0; i < in.size(); i++)
+            pairs.push_back(ft::pair<Key, int>(in.shuffled[i], static_cast<int>(i)));
+        m.insert(pairs.begin(), pairs.end());
+    }
+
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    struct PairSequence< ft::flat_map<Key, T, Compare, Alloc> > {
+        typedef ft::vector< ft::pair<Key, T> > type;
+    };
+
+    template<typename T>
+    void flat_bench(const Report &report) {
+        typedef ft::flat_map<T, int> ft_type;
+        typedef std::map<T, int>     std_type;
+        typedef ft::map<T, int>      tree_type;
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+            compare<MapBuildSorted, ft_type, std_type>(report, "flat", "build_asc", in);
+            compare<MapBuildShuffled, ft_type, std_type>(report, "flat", "build_rand", in);
+            compare<MapFind, ft_type, std_type>(report, "flat", "find", in);
+            compare<MapFindLatency, ft_type, std_type>(report, "flat", "find_lat", in);
+            compare<MapScan, ft_type, std_type>(report, "flat", "scan", in);
+            compare<MapIterate, ft_type, std_type>(report, "flat", "iterate", in);
+            compare<MapCopy, ft_type, std_type>(report, "flat", "copy", in);
+            compare<MapBuildShuffled, ft_type, tree_type>(report, "flat/map", "build_rand", in);
+            compare<MapFind, ft_type, tree_type>(report, "flat/map", "find", in);
+            compare<MapScan, ft_type, tree_type>(report, "flat/map", "scan", in);
+            compare<MapIterate, ft_type, tree_type>(report, "flat/map", "iterate", in);
+        }
+    }
+
+    /**
+     * ft::flat_map against std::map, then against ft::map: in the flat/map rows
+     * the std columns hold the ft::map times. The flat maps are built with a range insert
+     */
+    inline void flat_bench(const Report &report) {
+        report.section("flat");
+        flat_bench<int>(report);
+        flat_bench<std::string>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_FLAT_BENCH_HPP
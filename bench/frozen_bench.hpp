@@ -0,0 +1,59 @@
+#ifndef FT_CONTAINERS_FROZEN_BENCH_HPP
+# define FT_CONTAINERS_FROZEN_BENCH_HPP
+
+# include <map>
+# include "frozen_map.hpp"
+# include "flat_map.hpp"
+# include "map.hpp"
+# include "bench.hpp"
+# include "map_bench.hpp"
+# include "btree_bench.hpp"
+# include "flat_bench.hpp"
+
+namespace bench {
+
+    /**
+     * A frozen_map is filled by freezing an ft::map built from the keys
+     */
+    template<typename Key, typename Compare, typename Alloc, typename T>
+    void fill_map(ft::frozen_map<Key, int, Compare, Alloc> &m, const Input<T> &in) {
+        ft::map<Key, int, Compare, Alloc> tree;
+
+        fill_map(tree, in);
+        m = ft::frozen_map<Key, int, Compare, Alloc>(tree);
+    }
+
+    template<typename T>
+    void frozen_bench(const Report &report) {
+        typedef ft::frozen_map<T, int> ft_type;
+        typedef std::map<T, int>       std_type;
+        typedef ft::map<T, int>        tree_type;
+        typedef ft::flat_map<T, int>   flat_type;
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+            compare<MapFind, ft_type, std_type>(report, "frozen", "find", in);
+            compare<MapFindLatency, ft_type, std_type>(report, "frozen", "find_lat", in);
+            compare<MapScan, ft_type, std_type>(report, "frozen", "scan", in);
+            compare<MapIterate, ft_type, std_type>(report, "frozen", "iterate", in);
+            compare<MapCopy, ft_type, std_type>(report, "frozen", "copy", in);
+            compare<MapFind, ft_type, tree_type>(report, "frozen/map", "find", in);
+            compare<MapFindLatency, ft_type, tree_type>(report, "frozen/map", "find_lat", in);
+            compare<MapFind, ft_type, flat_type>(report, "frozen/flat", "find", in);
+            compare<MapFindLatency, ft_type, flat_type>(report, "frozen/flat", "find_lat", in);
+        }
+    }
+
+    /**
+     * ft::frozen_map against std::map, then against ft::map and ft::flat_map: in the frozen/map and frozen/flat rows
+     * the std columns hold the ft::map and ft::flat_map times. The frozen maps are frozen from an ft::map
+     */
+    inline void frozen_bench(const Report &report) {
+        report.section("frozen");
+        frozen_bench<int>(report);
+        frozen_bench<std::string>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_FROZEN_BENCH_HPP
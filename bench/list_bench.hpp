@@ -0,0 +1,150 @@
+#ifndef FT_CONTAINERS_LIST_BENCH_HPP
+# define FT_CONTAINERS_LIST_BENCH_HPP
+
+# include <list>
+# include "list.hpp"
+# include "bench.hpp"
+
+namespace bench {
+
+    /**
+     * push_back every element into an empty list
+     */
+    template<typename List>
+    struct ListInsert: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            List l;
+            for (size_t i = 0; i < in.size(); i++)
+                l.push_back(in.shuffled[i]);
+            consume(l.empty());
+            return (in.size());
+        }
+    };
+
+    /**
+     * pop_front every element of a filled list
+     */
+    template<typename List>
+    struct ListErase: Workload {
+        List l;
+
+        template<typename T>
+        void reset(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                l.push_back(in.shuffled[i]);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            while (!l.empty())
+                l.pop_front();
+            return (in.size());
+        }
+    };
+
+    /**
+     * Walk the whole list with iterators
+     */
+    template<typename List>
+    struct ListIterate: Workload {
+        List l;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                l.push_back(in.shuffled[i]);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            for (typename List::const_iterator it = l.begin(); it != l.end(); it++)
+                sum += weight(*it);
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Copy construct a filled list
+     */
+    template<typename List>
+    struct ListCopy: ListIterate<List> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            List copy(this->l);
+            consume(copy.empty());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Copy assign a filled list to a list of the same size, as when refreshing a snapshot
+     */
+    template<typename List>
+    struct ListAssign: ListIterate<List> {
+        List copy;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            ListIterate<List>::prepare(in);
+            copy = this->l;
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            copy = this->l;
+            consume(copy.empty());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Sort a list filled in random order
+     */
+    template<typename List>
+    struct ListSort: Workload {
+        List l;
+
+        template<typename T>
+        void reset(const Input<T> &in) {
+            l.clear();
+            for (size_t i = 0; i < in.size(); i++)
+                l.push_back(in.shuffled[i]);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            l.sort();
+            consume(weight(l.front()));
+            return (in.size());
+        }
+    };
+
+    template<typename T>
+    void list_bench(const Report &report) {
+        typedef ft::list<T>  ft_type;
+        typedef std::list<T> std_type;
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+            compare<ListInsert, ft_type, std_type>(report, "list", "insert", in);
+            compare<ListErase, ft_type, std_type>(report, "list", "erase", in);
+            compare<ListIterate, ft_type, std_type>(report, "list", "iterate", in);
+            compare<ListCopy, ft_type, std_type>(report, "list", "copy", in);
+            compare<ListAssign, ft_type, std_type>(report, "list", "assign", in);
+            compare<ListSort, ft_type, std_type>(report, "list", "sort", in);
+        }
+    }
+
+    inline void list_bench(const Report &report) {
+        report.section("list");
+        list_bench<int>(report);
+        list_bench<std::string>(report);
+        list_bench<Blob>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_LIST_BENCH_HPP
@@ -0,0 +1,483 @@
+#ifndef FT_CONTAINERS_MAP_BENCH_HPP
+# define FT_CONTAINERS_MAP_BENCH_HPP
+
+# include <map>
+# include <vector>
+# include "map.hpp"
+# include "vector.hpp"
+# include "bench.hpp"
+
+namespace bench {
+
+    /**
+     * Fill a map with the input keys in random order
+     */
+    template<typename Map, typename T>
+    void fill_map(Map &m, const Input<T> &in) {
+        for (size_t i = 0; i < in.size(); i++)
+            m.insert(typename Map::value_type(in.shuffled[i], static_cast<int>(i)));
+    }
+
+    /**
+     * Insert every key into an empty map
+     */
+    template<typename Map>
+    struct MapInsert: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Map m;
+            fill_map(m, in);
+            consume(m.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Insert the keys in ascending order, each one hinted with end()
+     */
+    template<typename Map>
+    struct MapInsertHintSorted: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Map m;
+            for (size_t i = 0; i < in.size(); i++)
+                m.insert(m.end(), typename Map::value_type(in.sorted[i], static_cast<int>(i)));
+            consume(m.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Insert the keys in descending order, each one hinted with begin()
+     */
+    template<typename Map>
+    struct MapInsertHintReverse: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Map m;
+            for (size_t i = in.size(); i > 0; i--)
+                m.insert(m.begin(), typename Map::value_type(in.sorted[i - 1], static_cast<int>(i)));
+            consume(m.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Sequence of key-value pairs the range constructor of a map accepts:
+     * ft::map takes ft iterators only, std::map takes std iterators
+     */
+    template<typename Map>
+    struct PairSequence {
+        typedef std::vector< std::pair<typename Map::key_type, typename Map::mapped_type> > type;
+    };
+
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    struct PairSequence< ft::map<Key, T, Compare, Alloc, NodePolicy> > {
+        typedef ft::vector< ft::pair<Key, T> > type;
+    };
+
+    /**
+     * Construct a map from a range of keys in ascending order
+     */
+    template<typename Map>
+    struct MapBuildSorted: Workload {
+        typename PairSequence<Map>::type pairs;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                pairs.push_back(typename PairSequence<Map>::type::value_type(in.sorted[i], static_cast<int>(i)));
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Map m(pairs.begin(), pairs.end());
+            consume(m.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Construct a map from a range of keys in random order
+     */
+    template<typename Map>
+    struct MapBuildShuffled: MapBuildSorted<Map> {
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                this->pairs.push_back(typename PairSequence<Map>::type::value_type(in.shuffled[i], static_cast<int>(i)));
+        }
+    };
+
+    /**
+     * Erase every key of a filled map
+     */
+    template<typename Map>
+    struct MapErase: Workload {
+        Map m;
+
+        template<typename T>
+        void reset(const Input<T> &in) {
+            fill_map(m, in);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                m.erase(in.sorted[i]);
+            consume(m.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Pop the smallest key of a filled map until it is empty, the way a priority queue is drained
+     */
+    template<typename Map>
+    struct MapPopMin: MapErase<Map> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            while (!this->m.empty())
+                this->m.erase(this->m.begin());
+            consume(this->m.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Find every key of a filled map in random order
+     */
+    template<typename Map>
+    struct MapFind: Workload {
+        Map m;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            fill_map(m, in);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            for (size_t i = 0; i < in.size(); i++)
+                sum += m.find(in.shuffled[i])->second;
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Find every key of a filled map, the next key to look up depends on the value found,
+     * so the lookups cannot overlap and the time per operation is the latency of one descent
+     */
+    template<typename Map>
+    struct MapFindLatency: MapFind<Map> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t j = 0;
+            for (size_t i = 0; i < in.size(); i++)
+                j = static_cast<size_t>(this->m.find(in.shuffled[j])->second) + 1;
+            consume(j);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Look up a batch of keys: ft::map with find_batch, other maps with one find per key
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy,
+             typename ForwardIterator, typename OutputIterator>
+    void map_find_batch(const ft::map<Key, T, Compare, Alloc, NodePolicy> &m, ForwardIterator first, ForwardIterator last,
+                        OutputIterator out) {
+        m.find_batch(first, last, out);
+    }
+
+    template<typename Map, typename ForwardIterator, typename OutputIterator>
+    void map_find_batch(const Map &m, ForwardIterator first, ForwardIterator last, OutputIterator out) {
+        for (; first != last; ++first, ++out)
+            *out = m.find(*first);
+    }
+
+    /**
+     * An ft::map that map_find_batch looks up with one find per key,
+     * to compare find_batch with a find loop on the same tree
+     */
+    template<typename Map>
+    struct FindLoop: Map {};
+
+    /**
+     * Find every key of a filled map in random order, in batches of a few hundred keys
+     */
+    template<typename Map>
+    struct MapFindBatch: MapFind<Map> {
+        enum { batch = 256 };
+
+        std::vector<typename Map::key_type> keys;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            MapFind<Map>::prepare(in);
+            keys = in.shuffled;
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            typename Map::const_iterator found[batch];
+            size_t                       sum = 0;
+
+            for (size_t i = 0; i < in.size(); i += batch) {
+                size_t n = in.size() - i < static_cast<size_t>(batch) ? in.size() - i : static_cast<size_t>(batch);
+
+                map_find_batch(this->m, keys.begin() + i, keys.begin() + i + n, found);
+                for (size_t j = 0; j < n; j++)
+                    sum += found[j]->second;
+            }
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Same batches as MapFindBatch, each one sorted
+     */
+    template<typename Map>
+    struct MapFindBatchSorted: MapFindBatch<Map> {
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            MapFindBatch<Map>::prepare(in);
+            const size_t batch = MapFindBatch<Map>::batch;
+
+            for (size_t i = 0; i < in.size(); i += batch)
+                std::sort(this->keys.begin() + i, this->keys.begin() + (in.size() - i < batch ? in.size() : i + batch));
+        }
+    };
+
+    /**
+     * Get the range of every key of a filled map in random order
+     */
+    template<typename Map>
+    struct MapEqualRange: MapFind<Map> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            for (size_t i = 0; i < in.size(); i++)
+                sum += this->m.equal_range(in.shuffled[i]).first->second;
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Access every key of a filled map with operator[] in random order, every key is present
+     */
+    template<typename Map>
+    struct MapSubscriptHit: MapFind<Map> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            for (size_t i = 0; i < in.size(); i++)
+                sum += this->m[in.shuffled[i]];
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Walk the whole map in key order
+     */
+    template<typename Map>
+    struct MapIterate: MapFind<Map> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            for (typename Map::const_iterator it = this->m.begin(); it != this->m.end(); it++)
+                sum += weight(it->first);
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Mapped value of the element at a position: ft::map walks down the subtree counts
+     * of an order_statistics tree, std::map advances an iterator from begin()
+     */
+    template<typename Key, typename Compare, typename Alloc>
+    int map_nth(const ft::map<Key, int, Compare, Alloc, ft::order_statistics> &m, size_t n) {
+        return (m.nth(n)->second);
+    }
+
+    template<typename Map>
+    int map_nth(const Map &m, size_t n) {
+        typename Map::const_iterator it = m.begin();
+
+        std::advance(it, n);
+        return (it->second);
+    }
+
+    /**
+     * Get the element at every position of a filled map in a scattered order
+     */
+    template<typename Map>
+    struct MapNth: MapFind<Map> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            for (size_t i = 0; i < in.size(); i++)
+                sum += map_nth(this->m, i * 7919 % in.size());
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Move the keys not before a random key into a second map and back: ft::map splits and joins the trees,
+     * std::map inserts the range into the other map and erases it
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void map_split_join(ft::map<Key, T, Compare, Alloc, NodePolicy> &m, const Key &k) {
+        ft::map<Key, T, Compare, Alloc, NodePolicy> upper;
+
+        m.split(k, upper);
+        m.join(upper);
+    }
+
+    template<typename Map>
+    void map_split_join(Map &m, const typename Map::key_type &k) {
+        typename Map::iterator it = m.lower_bound(k);
+        Map                    upper(it, m.end());
+
+        m.erase(it, m.end());
+        m.insert(upper.begin(), upper.end());
+    }
+
+    /**
+     * Split a filled map at a few random keys and join it back each time
+     */
+    template<typename Map>
+    struct MapSplitJoin: MapFind<Map> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            const size_t ops = 16;
+
+            for (size_t i = 0; i < ops; i++)
+                map_split_join(this->m, in.shuffled[i % in.size()]);
+            consume(this->m.size());
+            return (ops);
+        }
+    };
+
+    /**
+     * Move the element with a key into another map: ft::map hands the node over with extract and insert,
+     * std::map copies the element into a new node and erases the old one
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void map_move_node(ft::map<Key, T, Compare, Alloc, NodePolicy> &from, ft::map<Key, T, Compare, Alloc, NodePolicy> &to,
+                       const Key &k) {
+        to.insert(from.extract(k));
+    }
+
+    template<typename Map>
+    void map_move_node(Map &from, Map &to, const typename Map::key_type &k) {
+        typename Map::iterator it = from.find(k);
+
+        to.insert(*it);
+        from.erase(it);
+    }
+
+    /**
+     * Move every element of a filled map into a second map in random order, then swap the maps
+     */
+    template<typename Map>
+    struct MapMoveNode: MapFind<Map> {
+        Map other;
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                map_move_node(this->m, other, in.shuffled[i]);
+            this->m.swap(other);
+            consume(this->m.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Copy construct a filled map
+     */
+    template<typename Map>
+    struct MapCopy: MapFind<Map> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Map copy(this->m);
+            consume(copy.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Copy assign a filled map to a map of the same size, as when refreshing a snapshot
+     */
+    template<typename Map>
+    struct MapAssign: MapFind<Map> {
+        Map copy;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            MapFind<Map>::prepare(in);
+            copy = this->m;
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            copy = this->m;
+            consume(copy.size());
+            return (in.size());
+        }
+    };
+
+    template<typename T>
+    void map_bench(const Report &report) {
+        typedef ft::map<T, int>  ft_type;
+        typedef std::map<T, int> std_type;
+        typedef ft::map<T, int, ft::less<T>, std::allocator< ft::pair<const T, int> >, ft::order_statistics> os_type;
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+            compare<MapInsert, ft_type, std_type>(report, "map", "insert", in);
+            compare<MapInsertHintSorted, ft_type, std_type>(report, "map", "hint_asc", in);
+            compare<MapInsertHintReverse, ft_type, std_type>(report, "map", "hint_desc", in);
+            compare<MapBuildSorted, ft_type, std_type>(report, "map", "build_asc", in);
+            compare<MapBuildShuffled, ft_type, std_type>(report, "map", "build_rand", in);
+            compare<MapErase, ft_type, std_type>(report, "map", "erase", in);
+            compare<MapPopMin, ft_type, std_type>(report, "map", "pop_min", in);
+            compare<MapMoveNode, ft_type, std_type>(report, "map", "move_node", in);
+            compare<MapFind, ft_type, std_type>(report, "map", "find", in);
+            compare<MapFindLatency, ft_type, std_type>(report, "map", "find_lat", in);
+            compare<MapFindBatch, ft_type, std_type>(report, "map", "find_batch", in);
+            compare<MapFindBatchSorted, ft_type, std_type>(report, "map", "batch_asc", in);
+            compare<MapFindBatch, ft_type, FindLoop<ft_type> >(report, "map/loop", "find_batch", in);
+            compare<MapFindBatchSorted, ft_type, FindLoop<ft_type> >(report, "map/loop", "batch_asc", in);
+            compare<MapEqualRange, ft_type, std_type>(report, "map", "equal_range", in);
+            compare<MapSubscriptHit, ft_type, std_type>(report, "map", "index_hit", in);
+            compare<MapIterate, ft_type, std_type>(report, "map", "iterate", in);
+            compare<MapCopy, ft_type, std_type>(report, "map", "copy", in);
+            compare<MapAssign, ft_type, std_type>(report, "map", "assign", in);
+            compare<MapInsert, os_type, std_type>(report, "map", "os_insert", in);
+            compare<MapErase, os_type, std_type>(report, "map", "os_erase", in);
+            if (n <= 10000)
+                compare<MapNth, os_type, std_type>(report, "map", "nth", in);
+            if (n <= 100000)
+                compare<MapSplitJoin, ft_type, std_type>(report, "map", "split_join", in);
+        }
+    }
+
+    inline void map_bench(const Report &report) {
+        report.section("map");
+        map_bench<int>(report);
+        map_bench<std::string>(report);
+        map_bench<Blob>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_MAP_BENCH_HPP
@@ -0,0 +1,148 @@
+#ifndef FT_CONTAINERS_MOVE_BENCH_HPP
+# define FT_CONTAINERS_MOVE_BENCH_HPP
+
+# include <string>
+# include <vector>
+# include <map>
+# include "vector.hpp"
+# include "map.hpp"
+# include "bench.hpp"
+
+namespace bench {
+
+    /**
+     * push_back a temporary into an empty vector: the temporary and every element
+     * relocated on growth are moved in a C++11 build and copied in a C++98 one
+     */
+    template<typename Vector>
+    struct VectorPushTemporary: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Vector v;
+            for (size_t i = 0; i < in.size(); i++)
+                v.push_back(typename Vector::value_type(in.shuffled[i]));
+            consume(v.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Insert at the front of a vector, every insert shifts the whole vector by one slot
+     */
+    template<typename Vector>
+    struct VectorInsertFront: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Vector v;
+            for (size_t i = 0; i < in.size(); i++)
+                v.insert(v.begin(), in.shuffled[i]);
+            consume(v.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * push_back small vectors into a vector of vectors
+     */
+    template<typename Vector>
+    struct VectorPushNested: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Vector v;
+            for (size_t i = 0; i < in.size(); i++)
+                v.push_back(typename Vector::value_type(16, in.shuffled[i]));
+            consume(v.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Insert temporary key-value pairs into an empty map
+     */
+    template<typename Map>
+    struct MapInsertTemporary: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Map m;
+            for (size_t i = 0; i < in.size(); i++)
+                m.insert(typename Map::value_type(in.shuffled[i], in.shuffled[i]));
+            consume(m.size());
+            return (in.size());
+        }
+    };
+
+# if FT_CXX11
+    /**
+     * Construct the elements in place at the end of an empty vector
+     */
+    template<typename Vector>
+    struct VectorEmplace: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Vector v;
+            for (size_t i = 0; i < in.size(); i++)
+                v.emplace_back(in.shuffled[i].size(), 'x');
+            consume(v.size());
+            return (in.size());
+        }
+    };
+# endif
+
+# if __cplusplus >= 201703L
+    /**
+     * try_emplace every key twice, the second call finds the key and must not touch its arguments.
+     * std::map has try_emplace since C++17 only
+     */
+    template<typename Map>
+    struct MapTryEmplace: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Map m;
+            for (size_t i = 0; i < in.size(); i++)
+                m.try_emplace(in.shuffled[i], in.shuffled[i]);
+            for (size_t i = 0; i < in.size(); i++)
+                m.try_emplace(in.shuffled[i], in.shuffled[i]);
+            consume(m.size());
+            return (2 * in.size());
+        }
+    };
+# endif
+
+    /**
+     * Workloads whose cost depends on whether elements are moved or copied,
+     * run it once with the default build and once with make STD=c++11 to compare
+     */
+    inline void move_bench(const Report &report) {
+        typedef std::string                                T;
+        typedef ft::vector<T>                              ft_vector;
+        typedef std::vector<T>                             std_vector;
+        typedef ft::vector< ft::vector<int> >              ft_nested;
+        typedef std::vector< std::vector<int> >            std_nested;
+        typedef ft::map<T, T>                              ft_map;
+        typedef std::map<T, T>                             std_map;
+
+        report.section(FT_CXX11 ? "move (c++11)" : "move (c++98)");
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+            compare<VectorPushTemporary, ft_vector, std_vector>(report, "vector", "push_tmp", in);
+            if (n <= 10000)
+                compare<VectorInsertFront, ft_vector, std_vector>(report, "vector", "ins_front", in);
+# if FT_CXX11
+            compare<VectorEmplace, ft_vector, std_vector>(report, "vector", "emplace", in);
+# endif
+            compare<MapInsertTemporary, ft_map, std_map>(report, "map", "insert_tmp", in);
+# if __cplusplus >= 201703L
+            compare<MapTryEmplace, ft_map, std_map>(report, "map", "try_emplace", in);
+# endif
+        }
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<int> in(n);
+            compare<VectorPushNested, ft_nested, std_nested>(report, "vec<vec>", "push_tmp", in);
+        }
+    }
+
+}
+
+#endif //FT_CONTAINERS_MOVE_BENCH_HPP
@@ -0,0 +1,80 @@
+#ifndef FT_CONTAINERS_POOL_BENCH_HPP
+# define FT_CONTAINERS_POOL_BENCH_HPP
+
+# include <map>
+# include <set>
+# include <list>
+# include "pool_allocator.hpp"
+# include "bench.hpp"
+# include "list_bench.hpp"
+# include "map_bench.hpp"
+# include "set_bench.hpp"
+
+namespace bench {
+
+    /**
+     * Erase and insert back every key of a filled map, each step frees a node and allocates one
+     */
+    template<typename Map>
+    struct MapChurn: MapFind<Map> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++) {
+                this->m.erase(in.shuffled[i]);
+                this->m.insert(typename Map::value_type(in.shuffled[i], static_cast<int>(i)));
+            }
+            consume(this->m.size());
+            return (2 * in.size());
+        }
+    };
+
+    /**
+     * Rotate a filled list: pop the front element and push it back
+     */
+    template<typename List>
+    struct ListChurn: ListIterate<List> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++) {
+                this->l.pop_front();
+                this->l.push_back(in.shuffled[i]);
+            }
+            consume(this->l.size());
+            return (2 * in.size());
+        }
+    };
+
+    template<typename T>
+    void pool_bench(const Report &report) {
+        typedef ft::map<T, int, ft::less<T>, ft::pool_allocator< ft::pair<const T, int> > > ft_map;
+        typedef std::map<T, int>                                                          std_map;
+        typedef ft::set<T, ft::less<T>, ft::pool_allocator<T> >                           ft_set;
+        typedef std::set<T>                                                               std_set;
+        typedef ft::list<T, ft::pool_allocator<T> >                                       ft_list;
+        typedef std::list<T>                                                              std_list;
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+            compare<MapInsert, ft_map, std_map>(report, "map", "insert", in);
+            compare<MapErase, ft_map, std_map>(report, "map", "erase", in);
+            compare<MapChurn, ft_map, std_map>(report, "map", "churn", in);
+            compare<MapIterate, ft_map, std_map>(report, "map", "iterate", in);
+            compare<SetInsert, ft_set, std_set>(report, "set", "insert", in);
+            compare<ListInsert, ft_list, std_list>(report, "list", "insert", in);
+            compare<ListChurn, ft_list, std_list>(report, "list", "churn", in);
+        }
+    }
+
+    /**
+     * Node containers with ft::pool_allocator against the std containers with std::allocator,
+     * compare with the rows of the map, set and list sections to see the gain of the pool
+     */
+    inline void pool_bench(const Report &report) {
+        report.section("pool (ft with pool_allocator)");
+        pool_bench<int>(report);
+        pool_bench<std::string>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_POOL_BENCH_HPP
@@ -0,0 +1,216 @@
+#ifndef FT_CONTAINERS_SET_BENCH_HPP
+# define FT_CONTAINERS_SET_BENCH_HPP
+
+# include <set>
+# include <algorithm>
+# include <iterator>
+# include "set.hpp"
+# include "bench.hpp"
+
+namespace bench {
+
+    /**
+     * Fill a set with the input values in random order
+     */
+    template<typename Set, typename T>
+    void fill_set(Set &s, const Input<T> &in) {
+        for (size_t i = 0; i < in.size(); i++)
+            s.insert(in.shuffled[i]);
+    }
+
+    /**
+     * Insert every value into an empty set
+     */
+    template<typename Set>
+    struct SetInsert: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Set s;
+            fill_set(s, in);
+            consume(s.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Erase every value of a filled set
+     */
+    template<typename Set>
+    struct SetErase: Workload {
+        Set s;
+
+        template<typename T>
+        void reset(const Input<T> &in) {
+            fill_set(s, in);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                s.erase(in.sorted[i]);
+            consume(s.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Find every value of a filled set in random order
+     */
+    template<typename Set>
+    struct SetFind: Workload {
+        Set s;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            fill_set(s, in);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            for (size_t i = 0; i < in.size(); i++)
+                sum += weight(*s.find(in.shuffled[i]));
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Walk the whole set in order
+     */
+    template<typename Set>
+    struct SetIterate: SetFind<Set> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            for (typename Set::const_iterator it = this->s.begin(); it != this->s.end(); it++)
+                sum += weight(*it);
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Copy construct a filled set
+     */
+    template<typename Set>
+    struct SetCopy: SetFind<Set> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Set copy(this->s);
+            consume(copy.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Union and intersection of two sets: the ft functions merge both sets and build the result in linear time,
+     * std::set_union and std::set_intersection insert every element of the result at the end of the std::set
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_union_of(const ft::set<T, Compare, Alloc, NodePolicy> &x, const ft::set<T, Compare, Alloc, NodePolicy> &y,
+                      ft::set<T, Compare, Alloc, NodePolicy> &result) {
+        ft::set_union(x, y, result);
+    }
+
+    template<typename Set>
+    void set_union_of(const Set &x, const Set &y, Set &result) {
+        result.clear();
+        std::set_union(x.begin(), x.end(), y.begin(), y.end(), std::inserter(result, result.end()));
+    }
+
+# if FT_CXX11
+    /**
+     * An ft::set that set_union_of merges on as many threads as the hardware runs,
+     * to compare the parallel union with the sequential one on the same sets
+     */
+    template<typename Set>
+    struct ParallelSet: Set {};
+
+    template<typename Set>
+    void set_union_of(const ParallelSet<Set> &x, const ParallelSet<Set> &y, ParallelSet<Set> &result) {
+        ft::set_union(ft::parallel, x, y, result);
+    }
+# endif
+
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_intersection_of(const ft::set<T, Compare, Alloc, NodePolicy> &x, const ft::set<T, Compare, Alloc, NodePolicy> &y,
+                             ft::set<T, Compare, Alloc, NodePolicy> &result) {
+        ft::set_intersection(x, y, result);
+    }
+
+    template<typename Set>
+    void set_intersection_of(const Set &x, const Set &y, Set &result) {
+        result.clear();
+        std::set_intersection(x.begin(), x.end(), y.begin(), y.end(), std::inserter(result, result.end()));
+    }
+
+    /**
+     * Union of two sets that share a third of their values, one holds the first two thirds of the input
+     * in random order and the other one the last two thirds
+     */
+    template<typename Set>
+    struct SetUnion: Workload {
+        Set x;
+        Set y;
+        Set result;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            for (size_t i = 0; i < in.size() * 2 / 3; i++)
+                x.insert(in.shuffled[i]);
+            for (size_t i = in.size() / 3; i < in.size(); i++)
+                y.insert(in.shuffled[i]);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &) {
+            set_union_of(x, y, result);
+            consume(result.size());
+            return (x.size() + y.size());
+        }
+    };
+
+    /**
+     * Intersection of the same two sets
+     */
+    template<typename Set>
+    struct SetIntersection: SetUnion<Set> {
+        template<typename T>
+        size_t run(const Input<T> &) {
+            set_intersection_of(this->x, this->y, this->result);
+            consume(this->result.size());
+            return (this->x.size() + this->y.size());
+        }
+    };
+
+    template<typename T>
+    void set_bench(const Report &report) {
+        typedef ft::set<T>  ft_type;
+        typedef std::set<T> std_type;
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+            compare<SetInsert, ft_type, std_type>(report, "set", "insert", in);
+            compare<SetErase, ft_type, std_type>(report, "set", "erase", in);
+            compare<SetFind, ft_type, std_type>(report, "set", "find", in);
+            compare<SetIterate, ft_type, std_type>(report, "set", "iterate", in);
+            compare<SetCopy, ft_type, std_type>(report, "set", "copy", in);
+            compare<SetUnion, ft_type, std_type>(report, "set", "union", in);
+            compare<SetIntersection, ft_type, std_type>(report, "set", "intersect", in);
+# if FT_CXX11
+            compare<SetUnion, ParallelSet<ft_type>, ft_type>(report, "set/seq", "par_union", in);
+# endif
+        }
+    }
+
+    inline void set_bench(const Report &report) {
+        report.section("set");
+        set_bench<int>(report);
+        set_bench<std::string>(report);
+        set_bench<Blob>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_SET_BENCH_HPP
@@ -0,0 +1,93 @@
+#ifndef FT_CONTAINERS_STACK_BENCH_HPP
+# define FT_CONTAINERS_STACK_BENCH_HPP
+
+# include <stack>
+# include "stack.hpp"
+# include "bench.hpp"
+
+namespace bench {
+
+    /**
+     * Push every element onto an empty stack
+     */
+    template<typename Stack>
+    struct StackInsert: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Stack st;
+            for (size_t i = 0; i < in.size(); i++)
+                st.push(in.shuffled[i]);
+            consume(st.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Read and pop every element of a filled stack
+     */
+    template<typename Stack>
+    struct StackErase: Workload {
+        Stack st;
+
+        template<typename T>
+        void reset(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                st.push(in.shuffled[i]);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            while (!st.empty()) {
+                sum += weight(st.top());
+                st.pop();
+            }
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Copy construct a filled stack
+     */
+    template<typename Stack>
+    struct StackCopy: Workload {
+        Stack st;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                st.push(in.shuffled[i]);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Stack copy(st);
+            consume(copy.size());
+            return (in.size());
+        }
+    };
+
+    template<typename T>
+    void stack_bench(const Report &report) {
+        typedef ft::stack<T>  ft_type;
+        typedef std::stack<T> std_type;
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+            compare<StackInsert, ft_type, std_type>(report, "stack", "insert", in);
+            compare<StackErase, ft_type, std_type>(report, "stack", "erase", in);
+            compare<StackCopy, ft_type, std_type>(report, "stack", "copy", in);
+        }
+    }
+
+    inline void stack_bench(const Report &report) {
+        report.section("stack");
+        stack_bench<int>(report);
+        stack_bench<std::string>(report);
+        stack_bench<Blob>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_STACK_BENCH_HPP
@@ -0,0 +1,107 @@
+#ifndef FT_CONTAINERS_UNORDERED_BENCH_HPP
+# define FT_CONTAINERS_UNORDERED_BENCH_HPP
+
+# include "unordered_map.hpp"
+# include "map.hpp"
+# include "bench.hpp"
+# include "map_bench.hpp"
+# include "pool_bench.hpp"
+
+/**
+ * The std side is std::unordered_map, or std::tr1::unordered_map in a C++98 build with libstdc++.
+ * Without either only the rows against ft::map are run
+ */
+# if FT_CXX11
+#  include <unordered_map>
+#  define FT_BENCH_STD_UNORDERED_MAP std::unordered_map
+# elif defined(__GLIBCXX__)
+#  include <tr1/unordered_map>
+#  define FT_BENCH_STD_UNORDERED_MAP std::tr1::unordered_map
+# endif
+
+namespace bench {
+
+    /**
+     * Insert every key into an empty map that reserved room for all of them,
+     * through rehash since the tr1 map has no reserve
+     */
+    template<typename Map>
+    struct UMapInsertReserved: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Map m;
+            m.rehash(static_cast<size_t>(static_cast<float>(in.size()) / m.max_load_factor()) + 1);
+            fill_map(m, in);
+            consume(m.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Look up keys that are not in the map: the map holds the first half of the keys
+     * and the second half is searched, so every lookup scans a whole probe sequence
+     */
+    template<typename Map>
+    struct UMapFindMiss: Workload {
+        Map m;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            for (size_t i = 0; i < in.size() / 2; i++)
+                m.insert(typename Map::value_type(in.shuffled[i], static_cast<int>(i)));
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            for (size_t i = in.size() / 2; i < in.size(); i++)
+                sum += m.count(in.shuffled[i]);
+            consume(sum);
+            return (in.size() - in.size() / 2);
+        }
+    };
+
+    template<typename T>
+    void unordered_bench(const Report &report) {
+        typedef ft::unordered_map<T, int>                 ft_type;
+        typedef ft::map<T, int>                           tree_type;
+# ifdef FT_BENCH_STD_UNORDERED_MAP
+        typedef FT_BENCH_STD_UNORDERED_MAP<T, int>        std_type;
+# endif
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+# ifdef FT_BENCH_STD_UNORDERED_MAP
+            compare<MapInsert, ft_type, std_type>(report, "umap", "insert", in);
+            compare<UMapInsertReserved, ft_type, std_type>(report, "umap", "insert_rsv", in);
+            compare<MapErase, ft_type, std_type>(report, "umap", "erase", in);
+            compare<MapFind, ft_type, std_type>(report, "umap", "find", in);
+            compare<UMapFindMiss, ft_type, std_type>(report, "umap", "find_miss", in);
+            compare<MapFindLatency, ft_type, std_type>(report, "umap", "find_lat", in);
+            compare<MapSubscriptHit, ft_type, std_type>(report, "umap", "index_hit", in);
+            compare<MapChurn, ft_type, std_type>(report, "umap", "churn", in);
+            compare<MapIterate, ft_type, std_type>(report, "umap", "iterate", in);
+            compare<MapCopy, ft_type, std_type>(report, "umap", "copy", in);
+# endif
+            compare<MapInsert, ft_type, tree_type>(report, "umap/map", "insert", in);
+            compare<MapErase, ft_type, tree_type>(report, "umap/map", "erase", in);
+            compare<MapFind, ft_type, tree_type>(report, "umap/map", "find", in);
+            compare<UMapFindMiss, ft_type, tree_type>(report, "umap/map", "find_miss", in);
+            compare<MapFindLatency, ft_type, tree_type>(report, "umap/map", "find_lat", in);
+            compare<MapChurn, ft_type, tree_type>(report, "umap/map", "churn", in);
+        }
+    }
+
+    /**
+     * ft::unordered_map against the std hash map, then against ft::map: in the umap/map rows
+     * the std columns hold the ft::map times
+     */
+    inline void unordered_bench(const Report &report) {
+        report.section("unordered");
+        unordered_bench<int>(report);
+        unordered_bench<std::string>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_UNORDERED_BENCH_HPP
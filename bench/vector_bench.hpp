@@ -0,0 +1,127 @@
+#ifndef FT_CONTAINERS_VECTOR_BENCH_HPP
+# define FT_CONTAINERS_VECTOR_BENCH_HPP
+
+# include <vector>
+# include "vector.hpp"
+# include "bench.hpp"
+
+namespace bench {
+
+    /**
+     * push_back every element into an empty vector
+     */
+    template<typename Vector>
+    struct VectorInsert: Workload {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Vector v;
+            for (size_t i = 0; i < in.size(); i++)
+                v.push_back(in.shuffled[i]);
+            consume(v.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * pop_back every element of a filled vector
+     */
+    template<typename Vector>
+    struct VectorErase: Workload {
+        Vector v;
+
+        template<typename T>
+        void reset(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                v.push_back(in.shuffled[i]);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            while (!v.empty())
+                v.pop_back();
+            return (in.size());
+        }
+    };
+
+    /**
+     * Walk the whole vector with iterators
+     */
+    template<typename Vector>
+    struct VectorIterate: Workload {
+        Vector v;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            for (size_t i = 0; i < in.size(); i++)
+                v.push_back(in.shuffled[i]);
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            size_t sum = 0;
+            for (typename Vector::iterator it = v.begin(); it != v.end(); it++)
+                sum += weight(*it);
+            consume(sum);
+            return (in.size());
+        }
+    };
+
+    /**
+     * Copy construct a filled vector
+     */
+    template<typename Vector>
+    struct VectorCopy: VectorIterate<Vector> {
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            Vector copy(this->v);
+            consume(copy.size());
+            return (in.size());
+        }
+    };
+
+    /**
+     * Copy assign a filled vector to a vector of the same size, as when refreshing a snapshot
+     */
+    template<typename Vector>
+    struct VectorAssign: VectorIterate<Vector> {
+        Vector copy;
+
+        template<typename T>
+        void prepare(const Input<T> &in) {
+            VectorIterate<Vector>::prepare(in);
+            copy = this->v;
+        }
+
+        template<typename T>
+        size_t run(const Input<T> &in) {
+            copy = this->v;
+            consume(copy.size());
+            return (in.size());
+        }
+    };
+
+    template<typename T>
+    void vector_bench(const Report &report) {
+        typedef ft::vector<T>  ft_type;
+        typedef std::vector<T> std_type;
+
+        for (size_t n = 10; n <= report.max_size<T>(); n *= 10) {
+            Input<T> in(n);
+            compare<VectorInsert, ft_type, std_type>(report, "vector", "insert", in);
+            compare<VectorErase, ft_type, std_type>(report, "vector", "erase", in);
+            compare<VectorIterate, ft_type, std_type>(report, "vector", "iterate", in);
+            compare<VectorCopy, ft_type, std_type>(report, "vector", "copy", in);
+            compare<VectorAssign, ft_type, std_type>(report, "vector", "assign", in);
+        }
+    }
+
+    inline void vector_bench(const Report &report) {
+        report.section("vector");
+        vector_bench<int>(report);
+        vector_bench<std::string>(report);
+        vector_bench<Blob>(report);
+    }
+
+}
+
+#endif //FT_CONTAINERS_VECTOR_BENCH_HPP
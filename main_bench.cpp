@@ -0,0 +1,63 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include "bench.hpp"
+#include "vector_bench.hpp"
+#include "list_bench.hpp"
+#include "map_bench.hpp"
+#include "set_bench.hpp"
+#include "stack_bench.hpp"
+#include "alloc_bench.hpp"
+#include "move_bench.hpp"
+#include "pool_bench.hpp"
+#include "churn_bench.hpp"
+#include "unordered_bench.hpp"
+#include "btree_bench.hpp"
+#include "flat_bench.hpp"
+#include "frozen_bench.hpp"
+
+/**
+ * Usage: containers_bench [max_size] [section]
+ *   max_size Largest workload size, sizes go from 10 up by powers of ten (default 10^7)
+ *   section  Run only one section: vector, list, map, set, stack, alloc, move, pool, churn, unordered, btree, flat or frozen
+ */
+int main(int argc, char **argv) {
+    size_t      max_size = 10000000;
+    std::string filter;
+
+    if (argc > 1)
+        max_size = std::strtoul(argv[1], NULL, 10);
+    if (argc > 2)
+        filter = argv[2];
+
+    bench::Report report(max_size, filter);
+
+    if (report.enabled("vector"))
+        bench::vector_bench(report);
+    if (report.enabled("list"))
+        bench::list_bench(report);
+    if (report.enabled("map"))
+        bench::map_bench(report);
+    if (report.enabled("set"))
+        bench::set_bench(report);
+    if (report.enabled("stack"))
+        bench::stack_bench(report);
+    if (report.enabled("alloc"))
+        bench::alloc_bench(report);
+    if (report.enabled("move"))
+        bench::move_bench(report);
+    if (report.enabled("pool"))
+        bench::pool_bench(report);
+    if (report.enabled("churn"))
+        bench::churn_bench(report);
+    if (report.enabled("unordered"))
+        bench::unordered_bench(report);
+    if (report.enabled("btree"))
+        bench::btree_bench(report);
+    if (report.enabled("flat"))
+        bench::flat_bench(report);
+    if (report.enabled("frozen"))
+        bench::frozen_bench(report);
+
+    return (0);
+}
@@ -5,6 +5,16 @@
 #include "map.hpp"
 #include "stack.hpp"
 #include "set.hpp"
+#include "unordered_map.hpp"
+#include "unordered_set.hpp"
+#include "flat_map.hpp"
+#include "flat_set.hpp"
+#include "btree_map.hpp"
+#include "btree_set.hpp"
+#include "frozen_map.hpp"
+#include "frozen_set.hpp"
+#include "algorithm.hpp"
+#include "pool_allocator.hpp"
 
 template<typename T>
 void print_list(const ft::list<T> &lst) {
@@ -88,6 +98,105 @@ void print_set_reverse(const ft::set<T> st) {
     std::cout << std::endl;
 }
 
+template<typename T, typename Hash>
+void print_unordered_set(const ft::unordered_set<T, Hash> &st) {
+    print_set(ft::set<T>(st.begin(), st.end()));
+}
+
+template<typename Key, typename T>
+void print_unordered_map(const ft::unordered_map<Key, T> &mp) {
+    print_map(ft::map<Key, T>(mp.begin(), mp.end()));
+}
+
+template<typename T>
+void print_flat_set(const ft::flat_set<T> &st) {
+    typename ft::flat_set<T>::const_iterator it;
+    for (it = st.begin(); it != st.end(); it++) {
+        std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+}
+
+template<typename T>
+void print_flat_set_reverse(const ft::flat_set<T> &st) {
+    typename ft::flat_set<T>::const_reverse_iterator it;
+    for (it = st.rbegin(); it != st.rend(); it++) {
+        std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+}
+
+template<typename Key, typename T>
+void print_flat_map(const ft::flat_map<Key, T> &mp) {
+    typename ft::flat_map<Key, T>::const_iterator it;
+    for (it = mp.begin(); it != mp.end(); it++) {
+        std::cout << "(" << it->first << ": " << it->second << ") ";
+    }
+    std::cout << std::endl;
+}
+
+template<typename T>
+void print_btree_set(const ft::btree_set<T> &st) {
+    typename ft::btree_set<T>::const_iterator it;
+    for (it = st.begin(); it != st.end(); it++) {
+        std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+}
+
+template<typename Key, typename T>
+void print_btree_map(const ft::btree_map<Key, T> &mp) {
+    typename ft::btree_map<Key, T>::const_iterator it;
+    for (it = mp.begin(); it != mp.end(); it++) {
+        std::cout << "(" << it->first << ": " << it->second << ") ";
+    }
+    std::cout << std::endl;
+}
+
+template<typename T>
+void print_frozen_set(const ft::frozen_set<T> &st) {
+    typename ft::frozen_set<T>::const_iterator it;
+    for (it = st.begin(); it != st.end(); it++) {
+        std::cout << *it << " ";
+    }
+    std::cout << std::endl;
+}
+
+template<typename Key, typename T>
+void print_frozen_map(const ft::frozen_map<Key, T> &mp) {
+    typename ft::frozen_map<Key, T>::const_iterator it;
+    for (it = mp.begin(); it != mp.end(); it++) {
+        std::cout << "(" << it->first << ": " << it->second << ") ";
+    }
+    std::cout << std::endl;
+}
+
+template<typename InputIterator>
+void print_range(InputIterator first, InputIterator last) {
+    for (; first != last; first++) {
+        std::cout << *first << " ";
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * Hash function that sends every key to the same bucket
+ */
+struct same_hash {
+    size_t operator()(int) const {
+        return (42);
+    }
+};
+
+/**
+ * Hash function that sends every key to the last bucket of an ft::unordered_set of up to 2^20 buckets
+ */
+struct last_bucket_hash {
+    size_t operator()(int) const {
+        return (121001);
+    }
+};
+
 bool is_even(int n) {
     return (n % 2 == 0);
 }
@@ -1160,6 +1269,1213 @@ void set_test() {
 
 }
 
+void unordered_test() {
+    /**
+     * insert, operator[], find, count, erase
+     */
+    ft::unordered_map<std::string, int> mp;
+    mp["one"] = 1;
+    mp["two"] = 2;
+    mp["three"] = 3;
+    std::cout << mp.insert(ft::make_pair(std::string("four"), 4)).second << " ";
+    std::cout << mp.insert(ft::make_pair(std::string("one"), 10)).second << std::endl;
+    print_unordered_map(mp);
+    std::cout << mp.size() << " " << mp.count("two") << " " << mp.count("five") << std::endl;
+    std::cout << mp.find("three")->second << " " << (mp.find("five") == mp.end()) << std::endl;
+    std::cout << mp.erase("two") << " " << mp.erase("two") << std::endl;
+    mp.erase(mp.find("one"));
+    print_unordered_map(mp);
+
+    /**
+     * Copy constructor, copy assignment, swap, clear
+     */
+    ft::unordered_map<std::string, int> mp2(mp);
+    mp2["five"] = 5;
+    print_unordered_map(mp2);
+    mp = mp2;
+    mp2["six"] = 6;
+    print_unordered_map(mp);
+    mp.swap(mp2);
+    print_unordered_map(mp);
+    print_unordered_map(mp2);
+    mp2.clear();
+    std::cout << mp2.empty() << " " << mp2.size() << " " << mp2.count("five") << std::endl;
+
+    /**
+     * Many elements, erase, rehash
+     */
+    ft::unordered_set<int> st;
+    for (int i = 0; i < 1000; i++)
+        st.insert(i * 7 % 1009);
+    for (int i = 0; i < 1009; i += 3)
+        st.erase(i);
+    std::cout << st.size() << " " << st.count(7) << " " << st.count(9) << std::endl;
+    st.rehash(4096);
+    std::cout << st.size() << " " << st.count(7) << " " << st.count(9) << std::endl;
+
+    long sum = 0;
+    for (ft::unordered_set<int>::iterator it = st.begin(); it != st.end(); it++)
+        sum += *it;
+    std::cout << sum << std::endl;
+
+    ft::unordered_set<int> st2(st.begin(), st.end());
+    st2.erase(st2.begin(), st2.end());
+    std::cout << st2.empty() << std::endl;
+
+    /**
+     * Degenerate hash functions: every key collides, in the middle and at the end of the table
+     */
+    ft::unordered_set<int, same_hash>        same;
+    ft::unordered_set<int, last_bucket_hash> last;
+    for (int i = 0; i < 2000; i++) {
+        same.insert(i);
+        last.insert(i);
+    }
+    for (int i = 0; i < 2000; i += 2) {
+        same.erase(i);
+        last.erase(i);
+    }
+    std::cout << same.size() << " " << last.size() << std::endl;
+    std::cout << same.count(1) << " " << same.count(2) << " " << last.count(1999) << " " << last.count(1998) << std::endl;
+    std::cout << (same.bucket_count() <= 4 * 2000) << " " << (last.bucket_count() <= 4 * 2000) << std::endl;
+
+    ft::unordered_set<int, last_bucket_hash> small;
+    for (int i = 10; i > 0; i--)
+        small.insert(i * 3);
+    small.erase(9);
+    print_unordered_set(small);
+}
+
+void flat_test() {
+    /**
+     * Range constructor from unsorted keys with duplicates, operator[], insert, find, count
+     */
+    int keys[] = {42, 7, 19, 7, 3, 88, 42, 61, 25, 3};
+    ft::vector<int> vct;
+    for (int i = 0; i < 10; i++)
+        vct.push_back(keys[i]);
+    ft::flat_set<int> st(vct.begin(), vct.end());
+    print_flat_set(st);
+    std::cout << st.size() << " " << st.count(7) << " " << st.count(8) << std::endl;
+    std::cout << st.insert(50).second << " ";
+    std::cout << st.insert(50).second << " " << *st.find(50) << std::endl;
+    std::cout << *st.find(19) << " " << (st.find(20) == st.end()) << std::endl;
+
+    ft::flat_map<std::string, int> mp;
+    mp["delta"] = 4;
+    mp["alpha"] = 1;
+    mp["charlie"] = 3;
+    std::cout << mp.insert(ft::make_pair(std::string("bravo"), 2)).second << " ";
+    std::cout << mp.insert(ft::make_pair(std::string("alpha"), 10)).second << std::endl;
+    mp["delta"] += 40;
+    print_flat_map(mp);
+    std::cout << mp.find("charlie")->second << " " << mp.count("echo") << " ";
+    std::cout << mp["echo"] << " " << mp.size() << std::endl;
+
+    /**
+     * Range insert merged with the present elements
+     */
+    int more[] = {1, 100, 42, 30, 7, 2, 99};
+    vct.clear();
+    for (int i = 0; i < 7; i++)
+        vct.push_back(more[i]);
+    st.insert(vct.begin(), vct.end());
+    print_flat_set(st);
+    print_flat_set_reverse(st);
+
+    /**
+     * lower_bound, upper_bound, equal_range
+     */
+    std::cout << *st.lower_bound(20) << " " << *st.upper_bound(42) << " " << *st.lower_bound(42) << " ";
+    std::cout << (st.lower_bound(101) == st.end()) << std::endl;
+    std::cout << *st.equal_range(61).first << " " << *st.equal_range(61).second << " ";
+    std::cout << (st.equal_range(62).first == st.equal_range(62).second) << std::endl;
+    ft::flat_map<std::string, int>::const_iterator cit = mp.lower_bound("b");
+    std::cout << cit->first << " " << mp.upper_bound("charlie")->first << std::endl;
+
+    /**
+     * erase by key, position and range, swap, clear
+     */
+    std::cout << st.erase(88) << " " << st.erase(88) << std::endl;
+    st.erase(st.begin());
+    st.erase(st.find(30), st.find(61));
+    print_flat_set(st);
+    mp.erase(mp.find("alpha"));
+    print_flat_map(mp);
+
+    ft::flat_set<int> st2;
+    for (int i = 0; i < 1000; i++)
+        st2.insert(i * 7 % 1009);
+    for (int i = 0; i < 1009; i += 3)
+        st2.erase(i);
+    long sum = 0;
+    for (ft::flat_set<int>::iterator it = st2.begin(); it != st2.end(); it++)
+        sum += *it;
+    std::cout << st2.size() << " " << sum << " " << *st2.lower_bound(500) << std::endl;
+
+    st.swap(st2);
+    std::cout << st.size() << " " << st2.size() << std::endl;
+    print_flat_set(st2);
+    st.clear();
+    std::cout << st.empty() << " " << st.size() << " " << (st.begin() == st.end()) << std::endl;
+
+    /**
+     * Copy constructor and copy assignment, into a larger and a smaller container
+     */
+    ft::flat_map<std::string, int> mp2(mp);
+    mp2["foxtrot"] = 6;
+    mp2["golf"] = 7;
+    mp = mp2;
+    mp2.erase("bravo");
+    print_flat_map(mp);
+    mp2 = mp;
+    print_flat_map(mp2);
+    mp.erase(mp.begin(), mp.find("echo"));
+    mp2 = mp;
+    const ft::flat_map<std::string, int> &same = mp2;
+    mp2 = same;
+    print_flat_map(mp2);
+
+    ft::flat_set<int> st3(st2);
+    st2.insert(1000);
+    st3 = st2;
+    print_flat_set(st3);
+    st3 = st;
+    std::cout << st3.empty() << " " << st3.size() << std::endl;
+}
+
+void btree_test() {
+    /**
+     * insert, operator[], find, count, erase on a few elements
+     */
+    ft::btree_map<int, std::string> mp;
+    mp[5] = "five";
+    mp[1] = "one";
+    mp[3] = "three";
+    std::cout << mp.insert(ft::make_pair(4, std::string("four"))).second << " ";
+    std::cout << mp.insert(ft::make_pair(1, std::string("uno"))).second << std::endl;
+    print_btree_map(mp);
+    std::cout << mp.find(3)->second << " " << (mp.find(2) == mp.end()) << " " << mp.count(5) << std::endl;
+    std::cout << mp.erase(3) << " " << mp.erase(3) << std::endl;
+    mp.erase(mp.begin());
+    print_btree_map(mp);
+
+    /**
+     * Enough elements to split nodes on insert and merge them on erase
+     */
+    ft::btree_set<int> st;
+    for (int i = 0; i < 5000; i++)
+        st.insert(i * 37 % 5003);
+    std::cout << st.size() << " " << *st.begin() << " " << *st.rbegin() << std::endl;
+    for (int i = 0; i < 5003; i++) {
+        if (i % 5 != 0)
+            st.erase(i);
+    }
+    long sum = 0;
+    for (ft::btree_set<int>::iterator it = st.begin(); it != st.end(); it++)
+        sum += *it;
+    long rsum = 0;
+    for (ft::btree_set<int>::reverse_iterator it = st.rbegin(); it != st.rend(); it++)
+        rsum += *it;
+    std::cout << st.size() << " " << sum << " " << rsum << std::endl;
+
+    /**
+     * lower_bound, upper_bound, equal_range, range erase
+     */
+    std::cout << *st.lower_bound(2001) << " " << *st.upper_bound(2000) << " " << *st.lower_bound(2000) << " ";
+    std::cout << (st.lower_bound(5001) == st.end()) << std::endl;
+    std::cout << *st.equal_range(1000).first << " " << *st.equal_range(1000).second << " ";
+    std::cout << (st.equal_range(1001).first == st.equal_range(1001).second) << std::endl;
+    st.erase(st.lower_bound(100), st.lower_bound(4900));
+    print_btree_set(st);
+
+    /**
+     * Range constructor, copy, assignment, swap, clear
+     */
+    ft::btree_set<int> st2(st.begin(), st.end());
+    st2.insert(7);
+    ft::btree_set<int> st3(st2);
+    st3.erase(0);
+    st = st3;
+    st3.clear();
+    print_btree_set(st);
+    st.swap(st3);
+    std::cout << st.empty() << " " << st3.size() << " " << st3.count(7) << " " << st3.count(0) << std::endl;
+
+    ft::btree_map<int, std::string> mp2;
+    for (int i = 0; i < 200; i++)
+        mp2[i % 50] += "x";
+    mp2.erase(mp2.find(10), mp2.find(45));
+    mp = mp2;
+    print_btree_map(mp);
+}
+
+void frozen_test() {
+    /**
+     * Frozen from a map: find, count, bounds, iteration both ways
+     */
+    ft::map<std::string, int> mp;
+    mp["kilo"] = 11;
+    mp["alpha"] = 1;
+    mp["mike"] = 13;
+    mp["echo"] = 5;
+    mp["golf"] = 7;
+    ft::frozen_map<std::string, int> fmp(mp);
+    mp["zulu"] = 26;
+    print_frozen_map(fmp);
+    std::cout << fmp.size() << " " << fmp.find("golf")->second << " " << (fmp.find("zulu") == fmp.end()) << " ";
+    std::cout << fmp.count("echo") << " " << fmp.count("bravo") << std::endl;
+    std::cout << fmp.lower_bound("b")->first << " " << fmp.upper_bound("kilo")->first << " ";
+    std::cout << (fmp.upper_bound("mike") == fmp.end()) << std::endl;
+    for (ft::frozen_map<std::string, int>::reverse_iterator it = fmp.rbegin(); it != fmp.rend(); it++)
+        std::cout << it->first << " ";
+    std::cout << std::endl;
+
+    /**
+     * Sizes around powers of two, built from a sorted range: every key and every gap between keys is looked up
+     */
+    int sizes[] = {0, 1, 2, 3, 7, 8, 9, 15, 16, 17, 63, 64, 100, 1000};
+    for (int s = 0; s < 14; s++) {
+        ft::vector<int> keys;
+        for (int i = 0; i < sizes[s]; i++)
+            keys.push_back(i * 2);
+        ft::frozen_set<int> fst(ft::assume_sorted, keys.begin(), keys.end());
+        long found = 0;
+        long bounds = 0;
+        for (int k = -1; k <= sizes[s] * 2; k++) {
+            found += fst.count(k);
+            if (fst.lower_bound(k) != fst.end())
+                bounds += *fst.lower_bound(k);
+            if (fst.upper_bound(k) != fst.end())
+                bounds += *fst.upper_bound(k);
+            if (fst.equal_range(k).first != fst.equal_range(k).second)
+                bounds++;
+        }
+        long sum = 0;
+        for (ft::frozen_set<int>::iterator it = fst.begin(); it != fst.end(); it++)
+            sum += *it;
+        std::cout << sizes[s] << ": " << fst.size() << " " << found << " " << bounds << " " << sum << std::endl;
+    }
+
+    /**
+     * Frozen from a set, copy, assignment, swap
+     */
+    ft::set<int> st;
+    for (int i = 0; i < 20; i++)
+        st.insert(i * 7 % 20);
+    ft::frozen_set<int> fst(st);
+    ft::frozen_set<int> fst2(fst);
+    ft::frozen_set<int> fst3;
+    std::cout << fst3.empty() << " " << (fst3.begin() == fst3.end()) << " " << (fst3.find(1) == fst3.end()) << std::endl;
+    fst3 = fst2;
+    print_frozen_set(fst3);
+    ft::frozen_set<int> fst4;
+    fst4.swap(fst3);
+    std::cout << fst3.size() << " " << fst4.size() << " " << *fst4.find(13) << std::endl;
+}
+
+void node_handle_test() {
+    /**
+     * extract by key and by iterator, insert the node into another map, change the key of a node
+     */
+    ft::map<int, std::string> mp;
+    mp[1] = "one";
+    mp[2] = "two";
+    mp[3] = "three";
+    mp[4] = "four";
+    mp[5] = "five";
+    ft::map<int, std::string> mp2;
+
+    ft::map<int, std::string>::node_type nh = mp.extract(3);
+    std::cout << nh.empty() << " " << nh.key() << " " << nh.mapped() << " " << mp.size() << std::endl;
+    ft::map<int, std::string>::insert_return_type ret = mp2.insert(nh);
+    std::cout << ret.inserted << " " << ret.position->second << " " << nh.empty() << std::endl;
+    nh = mp.extract(mp.begin());
+    nh.key() = 10;
+    mp2.insert(nh);
+    std::cout << mp.extract(42).empty() << " " << mp.size() << " " << mp2.size() << std::endl;
+    print_map(mp);
+    print_map(mp2);
+
+    /**
+     * Inserting a node whose key is present gives the node back, insert with a hint
+     */
+    nh = mp.extract(2);
+    nh.key() = 3;
+    ret = mp2.insert(nh);
+    std::cout << ret.inserted << " " << ret.position->second << " " << ret.node.empty() << " " << ret.node.mapped() << std::endl;
+    ret.node.key() = 7;
+    ft::map<int, std::string>::iterator it = mp2.insert(mp2.end(), ret.node);
+    std::cout << it->first << " " << it->second << " " << ret.node.empty() << std::endl;
+    print_map(mp2);
+
+    /**
+     * merge: moves the elements whose key is absent, the others stay in the source
+     */
+    mp[3] = "drei";
+    mp[7] = "sieben";
+    mp2.merge(mp);
+    print_map(mp2);
+    print_map(mp);
+
+    ft::set<int> st;
+    ft::set<int> st2;
+    for (int i = 0; i < 20; i += 2)
+        st.insert(i);
+    for (int i = 0; i < 30; i += 3)
+        st2.insert(i);
+    st.merge(st2);
+    print_set(st);
+    print_set(st2);
+
+    /**
+     * set nodes, a handle destroyed while it owns its node
+     */
+    ft::set<int>::node_type sn = st.extract(st.find(16));
+    std::cout << sn.value() << " " << st.count(16) << std::endl;
+    std::cout << st2.insert(sn).inserted << " " << st2.count(16) << " " << sn.empty() << std::endl;
+    {
+        ft::set<int>::node_type lost = st2.extract(st2.begin());
+        std::cout << lost.value() << " " << st2.size() << std::endl;
+    }
+    print_set(st2);
+}
+
+void order_statistics_test() {
+    typedef ft::set<int, ft::less<int>, std::allocator<int>, ft::order_statistics> os_set;
+    typedef ft::map<int, int, ft::less<int>, std::allocator< ft::pair<const int, int> >, ft::order_statistics> os_map;
+
+    /**
+     * nth, rank and count_range after inserts and erases that rotate the tree
+     */
+    os_set st;
+    for (int i = 0; i < 500; i++)
+        st.insert(i * 13 % 503);
+    for (int i = 0; i < 503; i += 4)
+        st.erase(i);
+    st.erase(st.begin());
+    std::cout << st.size() << " " << *st.nth(0) << " " << *st.nth(st.size() / 2) << " " << *st.nth(st.size() - 1) << " ";
+    std::cout << (st.nth(st.size()) == st.end()) << std::endl;
+
+    long sum = 0;
+    for (os_set::size_type n = 0; n < st.size(); n += 7)
+        sum += *st.nth(n) * static_cast<long>(n);
+    long ranks = 0;
+    for (int v = -1; v < 510; v++)
+        ranks += st.rank(v);
+    long ranges = 0;
+    for (int lo = -5; lo < 510; lo += 11)
+        ranges += st.count_range(lo, lo + 37);
+    std::cout << sum << " " << ranks << " " << ranges << " " << st.count_range(0, 503) << " " << st.count_range(7, 7) << std::endl;
+
+    /**
+     * The subtree sizes follow copies and clears
+     */
+    os_set st2(st);
+    st2.insert(1000);
+    os_set st3;
+    st3 = st2;
+    st3.erase(st3.nth(1));
+    std::cout << *st3.nth(1) << " " << st3.rank(1000) << " " << st3.count_range(100, 1001) << std::endl;
+    st3.clear();
+    std::cout << (st3.nth(0) == st3.end()) << " " << st3.rank(5) << std::endl;
+
+    /**
+     * Maps
+     */
+    os_map mp;
+    for (int i = 0; i < 100; i++)
+        mp[i * 3] = i;
+    mp.erase(mp.nth(10), mp.nth(20));
+    std::cout << mp.nth(10)->first << " " << mp.nth(10)->second << " " << mp.rank(90) << " " << mp.count_range(0, 90) << std::endl;
+}
+
+void split_join_test() {
+    typedef ft::set<int, ft::less<int>, std::allocator<int>, ft::order_statistics> os_set;
+
+    /**
+     * Split at keys present and absent, before the first and past the last element, then join back
+     */
+    ft::set<int> st;
+    for (int i = 0; i < 300; i++)
+        st.insert(i * 7 % 307);
+    st.erase(150);
+    int keys[] = {150, 151, -10, 0, 300, 400, 1, 299};
+    for (int k = 0; k < 8; k++) {
+        ft::set<int> upper;
+        upper.insert(12345);
+        st.split(keys[k], upper);
+        std::cout << keys[k] << ": " << st.size() << " " << upper.size() << " ";
+        std::cout << (st.empty() ? -1 : *st.rbegin()) << " " << (upper.empty() ? -1 : *upper.begin()) << " ";
+        st.join(upper);
+        std::cout << st.size() << " " << upper.size() << std::endl;
+    }
+    long sum = 0;
+    for (ft::set<int>::iterator it = st.begin(); it != st.end(); it++)
+        sum += *it;
+    std::cout << sum << std::endl;
+
+    /**
+     * Pieces split off one after the other and joined in another order, with order statistics
+     */
+    os_set os;
+    for (int i = 0; i < 1000; i++)
+        os.insert(i);
+    os_set a;
+    os_set b;
+    os_set c;
+    os.split(750, c);
+    os.split(500, b);
+    os.split(250, a);
+    std::cout << os.size() << " " << a.size() << " " << b.size() << " " << c.size() << " " << *a.nth(10) << " " << c.rank(800) << std::endl;
+    b.join(c);
+    os.join(a);
+    b.insert(1000);
+    os.erase(0);
+    os.join(b);
+    std::cout << os.size() << " " << *os.nth(499) << " " << os.rank(750) << " " << os.count_range(100, 900) << " " << b.empty() << std::endl;
+
+    /**
+     * Joining overlapping sets moves the elements one at a time, equivalent keys stay behind
+     */
+    ft::set<int> odd;
+    ft::set<int> third;
+    for (int i = 1; i < 40; i += 2)
+        odd.insert(i);
+    for (int i = 0; i < 40; i += 3)
+        third.insert(i);
+    odd.join(third);
+    print_set(odd);
+    print_set(third);
+
+    /**
+     * Maps
+     */
+    ft::map<std::string, int> mp;
+    mp["apple"] = 1;
+    mp["banana"] = 2;
+    mp["cherry"] = 3;
+    mp["date"] = 4;
+    mp["elder"] = 5;
+    ft::map<std::string, int> mp2;
+    mp.split("c", mp2);
+    print_map(mp);
+    print_map(mp2);
+    mp2["zest"] = 26;
+    mp.join(mp2);
+    print_map(mp);
+}
+
+void find_batch_test() {
+    /**
+     * A tree large enough for the interleaved descents, a sorted dense batch, a shuffled batch, a small tree
+     */
+    ft::set<int> st;
+    for (int i = 0; i < 10000; i++)
+        st.insert(i * 7919 % 10007 * 2);
+    ft::set<int> small;
+    for (int i = 0; i < 100; i++)
+        small.insert(i * 2);
+
+    ft::vector<int> sorted;
+    for (int i = -3; i < 2500; i++) {
+        sorted.push_back(i);
+        if (i % 5 == 0)
+            sorted.push_back(i);
+    }
+    ft::vector<int> shuffled;
+    for (int i = 0; i < 1003; i++)
+        shuffled.push_back(i * 6007 % 20021 - 3);
+
+    ft::vector<int> *batches[] = {&sorted, &shuffled};
+    for (int b = 0; b < 2; b++) {
+        ft::vector<int> &keys = *batches[b];
+        ft::vector<ft::set<int>::iterator> found(keys.size());
+        ft::vector<ft::set<int>::iterator> found_small(keys.size());
+        st.find_batch(keys.begin(), keys.end(), found.begin());
+        small.find_batch(keys.begin(), keys.end(), found_small.begin());
+        size_t hits = 0;
+        size_t hits_small = 0;
+        size_t wrong = 0;
+        long sum = 0;
+        for (size_t i = 0; i < keys.size(); i++) {
+            if (found[i] != st.end()) {
+                hits++;
+                sum += *found[i];
+            }
+            if (found_small[i] != small.end())
+                hits_small++;
+            if (found[i] != st.find(keys[i]) || found_small[i] != small.find(keys[i]))
+                wrong++;
+        }
+        std::cout << keys.size() << " " << hits << " " << hits_small << " " << sum << " " << wrong << std::endl;
+    }
+
+    /**
+     * Maps, an empty batch
+     */
+    ft::map<std::string, int> mp;
+    mp["one"] = 1;
+    mp["two"] = 2;
+    mp["three"] = 3;
+    std::string names[] = {"two", "zero", "three", "one", "four"};
+    ft::vector<std::string> keys;
+    for (int i = 0; i < 5; i++)
+        keys.push_back(names[i]);
+    ft::vector<ft::map<std::string, int>::iterator> found(5);
+    mp.find_batch(keys.begin(), keys.end(), found.begin());
+    for (int i = 0; i < 5; i++)
+        std::cout << (found[i] == mp.end() ? 0 : found[i]->second) << " ";
+    std::cout << std::endl;
+    mp.find_batch(keys.end(), keys.end(), found.begin());
+    std::cout << (found[0] == mp.find("two")) << std::endl;
+}
+
+void set_algebra_test() {
+    /**
+     * Sorted ranges into an output iterator
+     */
+    int odd[] = {1, 3, 5, 7, 9, 11, 13};
+    int fib[] = {1, 2, 3, 5, 8, 13, 21};
+    ft::vector<int> v1;
+    ft::vector<int> v2;
+    for (int i = 0; i < 7; i++) {
+        v1.push_back(odd[i]);
+        v2.push_back(fib[i]);
+    }
+    ft::vector<int> out(20);
+    print_range(out.begin(), ft::set_union(v1.begin(), v1.end(), v2.begin(), v2.end(), out.begin()));
+    print_range(out.begin(), ft::set_intersection(v1.begin(), v1.end(), v2.begin(), v2.end(), out.begin()));
+    print_range(out.begin(), ft::set_difference(v1.begin(), v1.end(), v2.begin(), v2.end(), out.begin()));
+    print_range(out.begin(), ft::set_symmetric_difference(v1.begin(), v1.end(), v2.begin(), v2.end(), out.begin()));
+    print_range(out.begin(), ft::set_union(v1.begin(), v1.begin(), v2.begin(), v2.end(), out.begin()));
+
+    /**
+     * Sets into a result set, which may be one of the operands
+     */
+    ft::set<int> a;
+    ft::set<int> b;
+    ft::set<int> r;
+    for (int i = 0; i < 40; i += 2)
+        a.insert(i);
+    for (int i = 0; i < 40; i += 3)
+        b.insert(i);
+    r.insert(1000);
+    ft::set_union(a, b, r);
+    print_set(r);
+    ft::set_intersection(a, b, r);
+    print_set(r);
+    ft::set_difference(a, b, r);
+    print_set(r);
+    ft::set_symmetric_difference(a, b, r);
+    print_set(r);
+    ft::set_intersection(a, r, r);
+    print_set(r);
+    ft::set_difference(b, a, a);
+    print_set(a);
+    ft::set_union(r, r, r);
+    print_set(r);
+
+    /**
+     * Maps: an element in both maps is taken from the first one
+     */
+    ft::map<int, std::string> m1;
+    ft::map<int, std::string> m2;
+    ft::map<int, std::string> mr;
+    m1[1] = "one";
+    m1[2] = "two";
+    m1[3] = "three";
+    m2[2] = "deux";
+    m2[3] = "trois";
+    m2[4] = "quatre";
+    ft::set_union(m1, m2, mr);
+    print_map(mr);
+    ft::set_intersection(m2, m1, mr);
+    print_map(mr);
+    ft::set_symmetric_difference(m1, m2, mr);
+    print_map(mr);
+    ft::set_difference(m2, m1, m2);
+    print_map(m2);
+
+#if __cplusplus >= 201103L
+    /**
+     * Parallel operations, on operands large enough to be cut between threads and on small ones
+     */
+    ft::set<int> big1;
+    ft::set<int> big2;
+    for (int i = 0; i < 100000; i++) {
+        big1.insert(i * 2);
+        big2.insert(i * 3);
+    }
+    size_t threads[] = {1, 2, 3, 5, 8};
+    for (int t = 0; t < 5; t++) {
+        ft::set<int> res;
+        ft::set_union(ft::parallel_t(threads[t]), big1, big2, res);
+        std::cout << threads[t] << ": " << res.size() << " " << *res.rbegin() << " ";
+        ft::set_intersection(ft::parallel_t(threads[t]), big1, big2, res);
+        std::cout << res.size() << " " << *res.rbegin() << " ";
+        ft::set_difference(ft::parallel_t(threads[t]), big1, big2, res);
+        std::cout << res.size() << " " << *res.begin() << " ";
+        ft::set_symmetric_difference(ft::parallel_t(threads[t]), big1, big2, res);
+        long sum = 0;
+        for (ft::set<int>::iterator it = res.begin(); it != res.end(); it++)
+            sum += *it;
+        std::cout << res.size() << " " << sum << std::endl;
+    }
+    ft::set<int> big3(big1);
+    ft::set_union(ft::parallel, big3, big2, big3);
+    std::cout << big3.size() << std::endl;
+    ft::set_intersection(ft::parallel, a, b, r);
+    print_set(r);
+#endif
+}
+
+void assign_test() {
+    /**
+     * Copy assignment into a larger, a smaller and an equal-sized container, then into itself
+     */
+    ft::map<int, std::string> small;
+    ft::map<int, std::string> medium;
+    ft::map<int, std::string> large;
+    for (int i = 0; i < 3; i++)
+        small[i * 5] = std::string(i + 1, 's');
+    for (int i = 0; i < 6; i++)
+        medium[i * 2] = std::string(i + 1, 'm');
+    for (int i = 0; i < 9; i++)
+        large[20 - i] = std::string(i + 1, 'l');
+    ft::map<int, std::string> mp(large);
+    mp = medium;
+    print_map(mp);
+    mp = small;
+    print_map(mp);
+    mp = large;
+    print_map(mp);
+    ft::map<int, std::string> mp2(medium);
+    mp2[1] = "x";
+    mp2.erase(0);
+    mp2 = medium;
+    print_map(mp2);
+    const ft::map<int, std::string> &same = mp2;
+    mp2 = same;
+    mp2[1] = "y";
+    print_map(mp2);
+
+    ft::set<std::string> st;
+    ft::set<std::string> st_small;
+    ft::set<std::string> st_large;
+    for (int i = 0; i < 4; i++)
+        st_small.insert(std::string(i + 1, 'a' + i));
+    for (int i = 0; i < 10; i++)
+        st_large.insert(std::string(10 - i, 'z' - i));
+    st = st_large;
+    print_set(st);
+    st = st_small;
+    print_set(st);
+    st.insert("q");
+    st = st_small;
+    print_set(st);
+    st = ft::set<std::string>();
+    std::cout << st.size() << std::endl;
+    st = st_large;
+    print_set(st);
+
+    ft::list<std::string> lst;
+    ft::list<std::string> lst_small;
+    ft::list<std::string> lst_large;
+    for (int i = 0; i < 3; i++)
+        lst_small.push_back(std::string(i + 2, 'k'));
+    for (int i = 0; i < 7; i++)
+        lst_large.push_front(std::string(i + 1, 'p'));
+    lst = lst_large;
+    print_list(lst);
+    lst = lst_small;
+    print_list(lst);
+    lst.back() = "changed";
+    lst = lst_small;
+    print_list(lst);
+    lst = lst_large;
+    print_list(lst);
+    lst = ft::list<std::string>();
+    std::cout << lst.size() << " " << lst.empty() << std::endl;
+}
+
+#if __cplusplus >= 201103L
+void move_test() {
+    /**
+     * vector: rvalue push_back and insert, emplace, emplace_back, move constructor and move assignment
+     */
+    ft::vector<std::string> vct;
+    std::string str(20, 'a');
+    vct.push_back(std::move(str));
+    std::cout << str.empty() << " " << vct.back() << std::endl;
+    for (int i = 0; i < 10; i++)
+        vct.emplace_back(i + 1, 'b' + i);
+    vct.emplace(vct.begin() + 2, 3, 'z');
+    vct.emplace(vct.begin(), vct[4]);
+    vct.insert(vct.end(), std::string("end"));
+    print_vector(vct);
+    ft::vector<std::string> vct2(std::move(vct));
+    std::cout << vct.empty() << " " << vct2.size() << " " << vct2.front() << std::endl;
+    vct.emplace_back("reused");
+    vct2 = std::move(vct);
+    std::cout << vct.empty() << " " << vct2.size() << " " << vct2.back() << std::endl;
+
+    /**
+     * list
+     */
+    ft::list<std::string> lst;
+    lst.emplace_back(3, 'x');
+    lst.emplace_front(2, 'y');
+    lst.emplace(++lst.begin(), "middle");
+    lst.push_back(std::string("last"));
+    print_list(lst);
+    ft::list<std::string> lst2(std::move(lst));
+    std::cout << lst.empty() << " " << lst2.size() << std::endl;
+    lst = std::move(lst2);
+    lst.push_front("first");
+    print_list(lst);
+
+    /**
+     * map and set: emplace, emplace_hint, try_emplace, rvalue insert
+     */
+    ft::map<int, std::string> mp;
+    std::cout << mp.emplace(1, "one").second << " " << mp.emplace(1, "uno").second << std::endl;
+    mp.emplace_hint(mp.end(), 5, "five");
+    std::string two("two");
+    std::cout << mp.try_emplace(2, std::move(two)).second << " " << two.empty() << std::endl;
+    std::string dup("dup");
+    std::cout << mp.try_emplace(2, std::move(dup)).second << " " << dup << std::endl;
+    mp.try_emplace(3, 4, 't');
+    mp.insert(ft::make_pair(4, std::string("four")));
+    print_map(mp);
+    ft::map<int, std::string> mp2(std::move(mp));
+    std::cout << mp.empty() << " " << mp2.size() << std::endl;
+    mp[7] = "seven";
+    mp = std::move(mp2);
+    print_map(mp);
+
+    ft::set<std::string> st;
+    st.emplace(4, 'e');
+    st.emplace_hint(st.begin(), "abc");
+    std::string key("key");
+    st.insert(std::move(key));
+    print_set(st);
+    ft::set<std::string> st2;
+    st2 = std::move(st);
+    std::cout << st.empty() << " " << st2.size() << " " << st2.count("key") << std::endl;
+}
+#endif
+
+/**
+ * Record looked up by its id alone through a transparent comparator
+ */
+struct employee {
+    int         id;
+    std::string name;
+
+    employee(int i, const std::string &n): id(i), name(n) {}
+};
+
+struct employee_less {
+    typedef void is_transparent;
+
+    bool operator()(const employee &x, const employee &y) const {
+        return (x.id < y.id);
+    }
+    bool operator()(const employee &x, int y) const {
+        return (x.id < y);
+    }
+    bool operator()(int x, const employee &y) const {
+        return (x < y.id);
+    }
+};
+
+void transparent_test() {
+    /**
+     * String keys looked up with a const char *
+     */
+    ft::map<std::string, int, ft::less<> > mp;
+    mp["apple"] = 1;
+    mp["banana"] = 2;
+    mp["cherry"] = 3;
+    std::cout << mp.find("banana")->second << " " << (mp.find("durian") == mp.end()) << " ";
+    std::cout << mp.count("apple") << " " << mp.count("apricot") << std::endl;
+    std::cout << mp.lower_bound("b")->first << " " << mp.upper_bound("banana")->first << " ";
+    std::cout << mp.equal_range("cherry").first->second << " " << (mp.equal_range("cherry").second == mp.end()) << std::endl;
+    const ft::map<std::string, int, ft::less<> > &cmp = mp;
+    std::cout << cmp.find("apple")->second << " " << cmp.lower_bound("c")->first << std::endl;
+
+    /**
+     * Records looked up by id
+     */
+    ft::set<employee, employee_less> staff;
+    staff.insert(employee(42, "Ada"));
+    staff.insert(employee(7, "Grace"));
+    staff.insert(employee(19, "Linus"));
+    staff.insert(employee(3, "Ken"));
+    std::cout << staff.find(19)->name << " " << (staff.find(20) == staff.end()) << " ";
+    std::cout << staff.count(7) << " " << staff.count(8) << std::endl;
+    std::cout << staff.lower_bound(10)->name << " " << staff.upper_bound(19)->name << " ";
+    std::cout << (staff.upper_bound(42) == staff.end()) << " " << staff.equal_range(3).first->name << std::endl;
+}
+
+void hint_test() {
+    /**
+     * Ascending keys at end(), descending keys at begin(), hints next to the key, wrong hints, a present key
+     */
+    ft::map<int, int> mp;
+    for (int i = 0; i < 100; i++)
+        mp.insert(mp.end(), ft::make_pair(i * 2, i));
+    for (int i = 0; i < 50; i++)
+        mp.insert(mp.begin(), ft::make_pair(-1 - i * 2, i));
+    ft::map<int, int>::iterator it = mp.insert(mp.find(10), ft::make_pair(11, 11));
+    std::cout << it->first << " " << it->second << " ";
+    it = mp.insert(mp.find(10), ft::make_pair(9, 9));
+    std::cout << it->first << " " << it->second << " ";
+    it = mp.insert(mp.begin(), ft::make_pair(151, 151));
+    std::cout << it->first << " " << it->second << " ";
+    it = mp.insert(mp.end(), ft::make_pair(-200, 200));
+    std::cout << it->first << " " << it->second << " ";
+    it = mp.insert(mp.find(40), ft::make_pair(40, 999));
+    std::cout << it->first << " " << it->second << " ";
+    it = mp.insert(mp.find(0), ft::make_pair(40, 999));
+    std::cout << it->first << " " << it->second << std::endl;
+
+    long keys = 0;
+    long values = 0;
+    int  prev = -1000;
+    int  unordered = 0;
+    for (it = mp.begin(); it != mp.end(); it++) {
+        keys += it->first;
+        values += it->second;
+        unordered += it->first <= prev;
+        prev = it->first;
+    }
+    std::cout << mp.size() << " " << keys << " " << values << " " << unordered << " ";
+    std::cout << mp.begin()->first << " " << mp.rbegin()->first << std::endl;
+
+    /**
+     * Each insert hinted with the result of the previous one
+     */
+    ft::set<int> st;
+    ft::set<int>::iterator pos = st.end();
+    for (int i = 0; i < 1000; i++)
+        pos = st.insert(pos, i * 7 % 1000);
+    for (int i = 0; i < 1000; i++)
+        pos = st.insert(pos, i);
+    long sum = 0;
+    for (pos = st.begin(); pos != st.end(); pos++)
+        sum += *pos;
+    std::cout << st.size() << " " << sum << " " << *st.begin() << " " << *st.rbegin() << std::endl;
+}
+
+void sorted_build_test() {
+    /**
+     * Construction from a sorted range trusted with assume_sorted, then modified
+     */
+    ft::vector< ft::pair<int, std::string> > pairs;
+    for (int i = 0; i < 1000; i++)
+        pairs.push_back(ft::make_pair(i * 2, std::string(i % 5 + 1, 'a' + i % 26)));
+    ft::map<int, std::string> mp(ft::assume_sorted, pairs.begin(), pairs.end());
+    std::cout << mp.size() << " " << mp.find(500)->second << " " << mp.begin()->first << " " << mp.rbegin()->first << " ";
+    std::cout << mp.count(501) << " " << mp.lower_bound(501)->first << std::endl;
+    mp.erase(mp.find(100), mp.find(1900));
+    mp[1] = "one";
+    mp.insert(ft::make_pair(2001, std::string("last")));
+    print_map(mp);
+
+    /**
+     * Ranges sorted up to some point, then unsorted with duplicates
+     */
+    ft::vector<int> keys;
+    for (int i = 0; i < 500; i++)
+        keys.push_back(i);
+    for (int i = 250; i >= 0; i -= 3)
+        keys.push_back(i);
+    keys.push_back(1000);
+    keys.push_back(600);
+    keys.push_back(-5);
+    ft::set<int> st(keys.begin(), keys.end());
+    std::cout << st.size() << " " << *st.begin() << " " << *st.rbegin() << " " << st.count(600) << " " << st.count(501) << std::endl;
+
+    ft::vector<int> dups;
+    for (int i = 0; i < 20; i++) {
+        dups.push_back(i);
+        dups.push_back(i);
+    }
+    ft::set<int> st2(dups.begin(), dups.end());
+    std::cout << st2.size() << " ";
+
+    /**
+     * Range insert into an empty set, sorted or trusted, and into a filled one
+     */
+    ft::set<int> st3;
+    st3.insert(keys.begin(), keys.begin() + 500);
+    ft::set<int> st4;
+    st4.insert(ft::assume_sorted, keys.begin() + 100, keys.begin() + 200);
+    st4.insert(ft::assume_sorted, keys.begin() + 300, keys.begin() + 400);
+    st4.insert(keys.begin(), keys.end());
+    ft::set<int> st5(ft::assume_sorted, keys.begin(), keys.begin());
+    std::cout << st3.size() << " " << *st3.rbegin() << " " << st4.size() << " " << st5.empty() << std::endl;
+    st5.insert(ft::assume_sorted, keys.begin(), keys.begin() + 10);
+    print_set(st5);
+}
+
+/**
+ * Orders strings by length, then alphabetically
+ */
+struct length_first {
+    bool operator()(const std::string &x, const std::string &y) const {
+        return (x.size() < y.size() || (x.size() == y.size() && x < y));
+    }
+};
+
+namespace ft {
+    /**
+     * length_first opts in to the three-way descents of map and set
+     */
+    template<>
+    struct three_way_compare<length_first, std::string> {
+        static const bool value = true;
+
+        static int compare(const length_first &, const std::string &x, const std::string &y) {
+            if (x.size() != y.size())
+                return (x.size() < y.size() ? -1 : 1);
+            return (x.compare(y));
+        }
+    };
+}
+
+void three_way_test() {
+    std::string words[] = {"pear", "fig", "apple", "kiwi", "banana", "fig", "plum", "date", "apple", "lime", "kiwi", "cherry"};
+
+    /**
+     * std::string keys under less, found and inserted with one comparison per node
+     */
+    ft::map<std::string, int, ft::less<std::string> > counts;
+    for (int i = 0; i < 12; i++)
+        counts[words[i]]++;
+    for (ft::map<std::string, int, ft::less<std::string> >::iterator it = counts.begin(); it != counts.end(); it++)
+        std::cout << it->first << ":" << it->second << " ";
+    std::cout << std::endl;
+    std::cout << counts.insert(ft::make_pair(std::string("fig"), 0)).second << " ";
+    std::cout << counts.insert(ft::make_pair(std::string("grape"), 0)).second << " " << counts.count("date") << " ";
+    std::cout << (counts.find("mango") == counts.end()) << " " << counts.equal_range("kiwi").first->second << " ";
+    std::cout << counts.erase("plum") << " " << counts.erase("plum") << " " << counts.size() << std::endl;
+
+    /**
+     * Floating point keys
+     */
+    ft::set<double, ft::less<double> > reals;
+    for (int i = 0; i < 200; i++) {
+        reals.insert(i * 0.5);
+        reals.insert(-i * 0.25);
+    }
+    std::cout << reals.size() << " " << reals.count(1.5) << " " << reals.count(-1.25) << " " << reals.count(0.1) << " ";
+    std::cout << *reals.lower_bound(0.3) << " " << *reals.upper_bound(-0.25) << " " << *reals.equal_range(99.5).first << std::endl;
+
+    /**
+     * A comparator that opts in
+     */
+    ft::set<std::string, length_first> by_length;
+    for (int i = 0; i < 12; i++)
+        by_length.insert(words[i]);
+    for (ft::set<std::string, length_first>::iterator it = by_length.begin(); it != by_length.end(); it++)
+        std::cout << *it << " ";
+    std::cout << std::endl;
+    std::cout << by_length.size() << " " << by_length.count("kiwi") << " " << by_length.count("pea") << " ";
+    std::cout << *by_length.lower_bound("zzzz") << " " << *by_length.upper_bound("fig") << " ";
+    by_length.erase("apple");
+    std::cout << *by_length.lower_bound("aaaaa") << std::endl;
+}
+
+/**
+ * Check the red-black invariants of a map or set and its height against the bound 2 * log2(n + 1)
+ */
+template<typename Tree>
+bool is_balanced(const Tree &tree) {
+    size_t bits = 0;
+
+    while ((static_cast<size_t>(1) << bits) <= tree.size())
+        bits++;
+    return (tree.verify() && tree.height() <= 2 * bits);
+}
+
+void erase_churn_test() {
+    /**
+     * Random inserts and erases, the tree is checked every few thousand steps
+     */
+    ft::map<int, int> mp;
+    unsigned int       seed = 42;
+    int                balanced = 0;
+    for (int step = 1; step <= 30000; step++) {
+        seed = seed * 1103515245u + 12345u;
+        int key = static_cast<int>((seed >> 16) % 2000);
+        if ((seed >> 8) % 3 == 0)
+            mp.erase(key);
+        else
+            mp[key] = step;
+        if (step % 5000 == 0)
+            balanced += is_balanced(mp);
+    }
+    long keys = 0;
+    long values = 0;
+    for (ft::map<int, int>::iterator it = mp.begin(); it != mp.end(); it++) {
+        keys += it->first;
+        values += it->second;
+    }
+    std::cout << mp.size() << " " << keys << " " << values << " " << balanced << std::endl;
+
+    /**
+     * Erase every other element through iterators, a range, then from the front until empty
+     */
+    ft::set<int> st;
+    for (int i = 0; i < 3000; i++)
+        st.insert(i * 17 % 3001);
+    for (ft::set<int>::iterator it = st.begin(); it != st.end();) {
+        st.erase(it++);
+        if (it != st.end())
+            it++;
+    }
+    std::cout << st.size() << " " << *st.begin() << " " << *st.rbegin() << " " << is_balanced(st) << " ";
+    st.erase(st.lower_bound(1000), st.lower_bound(2000));
+    std::cout << st.size() << " " << is_balanced(st) << " ";
+    for (int i = 0; i < 3001; i += 2)
+        st.erase(i * 7 % 3001);
+    std::cout << st.size() << " " << is_balanced(st) << " ";
+    while (!st.empty())
+        st.erase(st.begin());
+    std::cout << st.size() << " " << is_balanced(st) << std::endl;
+}
+
+/**
+ * Mapped type counting its constructions
+ */
+struct tracked {
+    static int constructions;
+    int        value;
+
+    tracked() : value(0) { constructions++; }
+    tracked(int v) : value(v) { constructions++; }
+    tracked(const tracked &other) : value(other.value) { constructions++; }
+};
+
+int tracked::constructions = 0;
+
+/**
+ * Constructions made by inserts of an existing key
+ */
+int duplicate_copies() {
+    return (tracked::constructions);
+}
+
+void no_temporary_test() {
+    ft::map<int, tracked> mp;
+    for (int i = 0; i < 10; i++)
+        mp.insert(ft::make_pair(i, tracked(i * 3)));
+
+    /**
+     * operator[] on existing keys builds no value
+     */
+    tracked::constructions = 0;
+    int sum = 0;
+    for (int i = 0; i < 10; i++)
+        sum += mp[i].value;
+    std::cout << sum << " " << tracked::constructions << std::endl;
+    mp[4].value = 100;
+    std::cout << mp[4].value << " " << tracked::constructions << std::endl;
+
+    /**
+     * insert and hinted insert of an existing key copy nothing
+     */
+    ft::pair<const int, tracked> dup(5, tracked(-1));
+    tracked::constructions = 0;
+    ft::pair<ft::map<int, tracked>::iterator, bool> res = mp.insert(dup);
+    std::cout << res.second << " " << res.first->second.value << " " << duplicate_copies() << std::endl;
+    ft::map<int, tracked>::iterator it = mp.insert(mp.find(5), dup);
+    std::cout << it->second.value << " " << duplicate_copies() << std::endl;
+    it = mp.insert(mp.begin(), dup);
+    std::cout << it->second.value << " " << duplicate_copies() << " " << mp.size() << std::endl;
+
+    /**
+     * A missing key copies the value once into the new element
+     */
+    ft::pair<const int, tracked> val(42, tracked(7));
+    tracked::constructions = 0;
+    res = mp.insert(val);
+    std::cout << res.second << " " << res.first->second.value << " " << tracked::constructions << " ";
+    std::cout << mp.size() << std::endl;
+    mp[50].value = 9;
+    std::cout << mp[50].value << " " << mp.size() << std::endl;
+
+    /**
+     * Same on a set
+     */
+    ft::set<int> st;
+    for (int i = 0; i < 5; i++)
+        st.insert(i);
+    ft::pair<ft::set<int>::iterator, bool> sres = st.insert(3);
+    std::cout << sres.second << " " << *sres.first << " ";
+    std::cout << *st.insert(st.end(), 4) << " " << st.size() << std::endl;
+}
+
+/**
+ * Containers drawing their nodes from the fixed size pools
+ */
+typedef ft::map<int, int, ft::less<int>, ft::pool_allocator<ft::pair<const int, int> > > pool_map;
+typedef ft::set<int, ft::less<int>, ft::pool_allocator<int> >                            pool_set;
+typedef ft::list<int, ft::pool_allocator<int> >                                          pool_list;
+
+void pool_allocator_test() {
+    /**
+     * Fill, erase part, refill into the freed nodes, clear
+     */
+    pool_map mp;
+    for (int i = 0; i < 5000; i++)
+        mp[i * 7 % 5000] = i;
+    mp.erase(mp.lower_bound(1000), mp.lower_bound(4000));
+    for (int i = 0; i < 5000; i += 2)
+        mp.erase(i);
+    std::cout << mp.size() << " " << mp.begin()->first << " " << mp.rbegin()->first << " ";
+    for (int i = 1500; i < 2500; i++)
+        mp.insert(ft::make_pair(i, -i));
+    long sum = 0;
+    for (pool_map::iterator it = mp.begin(); it != mp.end(); it++)
+        sum += it->first + it->second;
+    std::cout << mp.size() << " " << sum << " ";
+    mp.clear();
+    std::cout << mp.size() << " " << mp.empty() << std::endl;
+
+    /**
+     * Copies and swaps share the pools
+     */
+    pool_set st;
+    for (int i = 0; i < 300; i++)
+        st.insert(i * 13 % 301);
+    pool_set cp(st);
+    cp.erase(cp.begin(), cp.find(150));
+    st.swap(cp);
+    std::cout << st.size() << " " << *st.begin() << " " << cp.size() << " " << *cp.rbegin() << std::endl;
+
+    /**
+     * List
+     */
+    pool_list lst;
+    for (int i = 0; i < 1000; i++)
+        lst.push_back(i);
+    for (pool_list::iterator it = lst.begin(); it != lst.end();) {
+        if (*it % 3)
+            it = lst.erase(it);
+        else
+            it++;
+    }
+    lst.push_front(-1);
+    lst.reverse();
+    std::cout << lst.size() << " " << lst.front() << " " << lst.back() << " ";
+    lst.clear();
+    std::cout << lst.size() << std::endl;
+}
+
 int main() {
     std::cout << "====== LIST ======" << std::endl;
     list_test();
@@ -1176,6 +2492,62 @@ int main() {
     std::cout << std::endl << "====== SET ======" << std::endl;
     set_test();
 
+    std::cout << std::endl << "====== UNORDERED ======" << std::endl;
+    unordered_test();
+
+    std::cout << std::endl << "====== FLAT ======" << std::endl;
+    flat_test();
+
+    std::cout << std::endl << "====== BTREE ======" << std::endl;
+    btree_test();
+
+    std::cout << std::endl << "====== FROZEN ======" << std::endl;
+    frozen_test();
+
+    std::cout << std::endl << "====== NODE HANDLE ======" << std::endl;
+    node_handle_test();
+
+    std::cout << std::endl << "====== ORDER STATISTICS ======" << std::endl;
+    order_statistics_test();
+
+    std::cout << std::endl << "====== SPLIT JOIN ======" << std::endl;
+    split_join_test();
+
+    std::cout << std::endl << "====== FIND BATCH ======" << std::endl;
+    find_batch_test();
+
+    std::cout << std::endl << "====== SET ALGEBRA ======" << std::endl;
+    set_algebra_test();
+
+    std::cout << std::endl << "====== ASSIGN ======" << std::endl;
+    assign_test();
+
+#if __cplusplus >= 201103L
+    std::cout << std::endl << "====== MOVE ======" << std::endl;
+    move_test();
+#endif
+
+    std::cout << std::endl << "====== TRANSPARENT LOOKUP ======" << std::endl;
+    transparent_test();
+
+    std::cout << std::endl << "====== HINTED INSERT ======" << std::endl;
+    hint_test();
+
+    std::cout << std::endl << "====== SORTED BUILD ======" << std::endl;
+    sorted_build_test();
+
+    std::cout << std::endl << "====== THREE WAY COMPARE ======" << std::endl;
+    three_way_test();
+
+    std::cout << std::endl << "====== ERASE CHURN ======" << std::endl;
+    erase_churn_test();
+
+    std::cout << std::endl << "====== INSERT WITHOUT TEMPORARY ======" << std::endl;
+    no_temporary_test();
+
+    std::cout << std::endl << "====== POOL ALLOCATOR ======" << std::endl;
+    pool_allocator_test();
+
 //    while (1);
     return (0);
 }
@@ -1,6 +1,9 @@
 #ifndef FT_CONTAINERS_ALGORITHM_HPP
 # define FT_CONTAINERS_ALGORITHM_HPP
 
+# include "functional.hpp"
+# include "iterators/set_operation_iterator.hpp"
+
 namespace ft {
 
     template<typename T>
@@ -24,6 +27,120 @@ namespace ft {
         return (b);
     }
 
+    /**
+     * Copy the result of a set operation on two sorted ranges, merging them in one pass
+     * @param op     Operation
+     * @param first1 Start of the first range
+     * @param last1  End of the first range
+     * @param first2 Start of the second range
+     * @param last2  End of the second range
+     * @param result Start of the destination
+     * @param comp   Binary predicate both ranges are sorted by
+     * @return The end of the copied range
+     */
+    template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+    OutputIterator copy_set_operation(set_operation op, InputIterator1 first1, InputIterator1 last1,
+                                      InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp) {
+        set_operation_iterator<InputIterator1, InputIterator2, Compare> it(op, first1, last1, first2, last2, comp);
+        set_operation_iterator<InputIterator1, InputIterator2, Compare> end(op, last1, last1, last2, last2, comp);
+
+        for (; it != end; ++it, ++result)
+            *result = *it;
+        return (result);
+    }
+
+    /**
+     * Copy the union of two sorted ranges in linear time: elements of either range.
+     * An element found in both ranges is copied from the first one
+     * @param first1 Start of the first range
+     * @param last1  End of the first range
+     * @param first2 Start of the second range
+     * @param last2  End of the second range
+     * @param result Start of the destination
+     * @param comp   Binary predicate both ranges are sorted by, operator< if omitted
+     * @return The end of the copied range
+     */
+    template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+    OutputIterator set_union(InputIterator1 first1, InputIterator1 last1,
+                          InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp) {
+        return (copy_set_operation(set_union_op, first1, last1, first2, last2, result, comp));
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename OutputIterator>
+    OutputIterator set_union(InputIterator1 first1, InputIterator1 last1,
+                          InputIterator2 first2, InputIterator2 last2, OutputIterator result) {
+        return (copy_set_operation(set_union_op, first1, last1, first2, last2, result, less<>()));
+    }
+
+    /**
+     * Copy the intersection of two sorted ranges in linear time: elements of the first range that are also in the second one.
+     * An element found in both ranges is copied from the first one
+     * @param first1 Start of the first range
+     * @param last1  End of the first range
+     * @param first2 Start of the second range
+     * @param last2  End of the second range
+     * @param result Start of the destination
+     * @param comp   Binary predicate both ranges are sorted by, operator< if omitted
+     * @return The end of the copied range
+     */
+    template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+    OutputIterator set_intersection(InputIterator1 first1, InputIterator1 last1,
+                                 InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp) {
+        return (copy_set_operation(set_intersection_op, first1, last1, first2, last2, result, comp));
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename OutputIterator>
+    OutputIterator set_intersection(InputIterator1 first1, InputIterator1 last1,
+                                 InputIterator2 first2, InputIterator2 last2, OutputIterator result) {
+        return (copy_set_operation(set_intersection_op, first1, last1, first2, last2, result, less<>()));
+    }
+
+    /**
+     * Copy the difference of two sorted ranges in linear time: elements of the first range that are not in the second one.
+     * An element found in both ranges is copied from the first one
+     * @param first1 Start of the first range
+     * @param last1  End of the first range
+     * @param first2 Start of the second range
+     * @param last2  End of the second range
+     * @param result Start of the destination
+     * @param comp   Binary predicate both ranges are sorted by, operator< if omitted
+     * @return The end of the copied range
+     */
+    template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+    OutputIterator set_difference(InputIterator1 first1, InputIterator1 last1,
+                               InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp) {
+        return (copy_set_operation(set_difference_op, first1, last1, first2, last2, result, comp));
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename OutputIterator>
+    OutputIterator set_difference(InputIterator1 first1, InputIterator1 last1,
+                               InputIterator2 first2, InputIterator2 last2, OutputIterator result) {
+        return (copy_set_operation(set_difference_op, first1, last1, first2, last2, result, less<>()));
+    }
+
+    /**
+     * Copy the symmetric difference of two sorted ranges in linear time: elements that are in exactly one of the ranges.
+     * An element found in both ranges is copied from the first one
+     * @param first1 Start of the first range
+     * @param last1  End of the first range
+     * @param first2 Start of the second range
+     * @param last2  End of the second range
+     * @param result Start of the destination
+     * @param comp   Binary predicate both ranges are sorted by, operator< if omitted
+     * @return The end of the copied range
+     */
+    template<typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Compare>
+    OutputIterator set_symmetric_difference(InputIterator1 first1, InputIterator1 last1,
+                                         InputIterator2 first2, InputIterator2 last2, OutputIterator result, Compare comp) {
+        return (copy_set_operation(set_symmetric_difference_op, first1, last1, first2, last2, result, comp));
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename OutputIterator>
+    OutputIterator set_symmetric_difference(InputIterator1 first1, InputIterator1 last1,
+                                         InputIterator2 first2, InputIterator2 last2, OutputIterator result) {
+        return (copy_set_operation(set_symmetric_difference_op, first1, last1, first2, last2, result, less<>()));
+    }
+
 }
 
 #endif //FT_CONTAINERS_ALGORITHM_HPP
@@ -0,0 +1,1507 @@
+#ifndef FT_CONTAINERS_BTREE_HPP
+# define FT_CONTAINERS_BTREE_HPP
+
+namespace ft {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc> class BTree;
+    template<typename T> struct BTreeNode;
+}
+
+# include <memory>
+# include <new>
+# include <cstring>
+# include "algorithm.hpp"
+# include "iterators/btree_iterator.hpp"
+# include "utility.hpp"
+# include "functional.hpp"
+# include "type_traits.hpp"
+
+/**
+ * Target size in bytes of the element array of a B-tree node, a few cache lines.
+ * A node holds as many elements as fit, and at least 3
+ */
+# ifndef FT_BTREE_NODE_SIZE
+#  define FT_BTREE_NODE_SIZE 256
+# endif
+
+namespace ft {
+
+    /**
+     * B-tree node.
+     * The elements are stored sorted in one array of raw storage that the tree constructs and destroys itself,
+     * a leaf is nothing more. Internal nodes are BTreeInternalNode and add the child pointers,
+     * child i holding the elements between elements i - 1 and i
+     * @tparam T Type of the elements
+     */
+    template<typename T>
+    struct BTreeNode {
+        enum {
+            capacity = (FT_BTREE_NODE_SIZE - 2 * sizeof(void*)) / sizeof(T) < 3 ? 3 : (FT_BTREE_NODE_SIZE - 2 * sizeof(void*)) / sizeof(T)
+        };
+
+        BTreeNode      *parent;
+        unsigned short position;
+        unsigned short count;
+        bool           leaf;
+
+        union {
+            char        bytes[sizeof(T) * capacity];
+            long double align_ld;
+            long long   align_ll;
+            void        *align_ptr;
+        }              storage;
+
+        explicit BTreeNode(bool is_leaf);
+
+        T              *valptr(size_t i);
+        const T        *valptr(size_t i) const;
+        T              &value(size_t i);
+        const T        &value(size_t i) const;
+        BTreeNode      *&child(size_t i);
+        BTreeNode      *child(size_t i) const;
+    };
+
+    /**
+     * Internal B-tree node, a node followed by count + 1 child pointers
+     * @tparam T Type of the elements
+     */
+    template<typename T>
+    struct BTreeInternalNode: BTreeNode<T> {
+        BTreeNode<T> *children[BTreeNode<T>::capacity + 1];
+
+        BTreeInternalNode();
+    };
+
+    /**
+     * Constructor of an empty node
+     * @param is_leaf Whether the node is a leaf
+     */
+    template<typename T>
+    BTreeNode<T>::BTreeNode(bool is_leaf): parent(NULL), position(0), count(0), leaf(is_leaf) {}
+
+    template<typename T>
+    BTreeInternalNode<T>::BTreeInternalNode(): BTreeNode<T>(false) {
+        for (size_t i = 0; i <= BTreeNode<T>::capacity; i++)
+            children[i] = NULL;
+    }
+
+    /**
+     * Get pointer to the storage of an element
+     * @param i Index of the element, may be capacity for the end of the array
+     * @return Pointer to the element, valid only once the tree has constructed it
+     */
+    template<typename T>
+    T *BTreeNode<T>::valptr(size_t i) {
+        return (reinterpret_cast<T*>(storage.bytes) + i);
+    }
+
+    template<typename T>
+    const T *BTreeNode<T>::valptr(size_t i) const {
+        return (reinterpret_cast<const T*>(storage.bytes) + i);
+    }
+
+    template<typename T>
+    T &BTreeNode<T>::value(size_t i) {
+        return (*valptr(i));
+    }
+
+    template<typename T>
+    const T &BTreeNode<T>::value(size_t i) const {
+        return (*valptr(i));
+    }
+
+    /**
+     * Get a child of an internal node
+     * @param i Index of the child, from 0 to count
+     */
+    template<typename T>
+    BTreeNode<T> *&BTreeNode<T>::child(size_t i) {
+        return (static_cast<BTreeInternalNode<T>*>(this)->children[i]);
+    }
+
+    template<typename T>
+    BTreeNode<T> *BTreeNode<T>::child(size_t i) const {
+        return (static_cast<const BTreeInternalNode<T>*>(this)->children[i]);
+    }
+
+    /**
+     * B-tree container.
+     * Every node holds up to BTreeNode::capacity sorted elements side by side, so a lookup reads a few contiguous
+     * cache lines per level instead of one node per comparison, and an in-order scan reads the elements in place.
+     * All leaves are at the same depth. A full node is split in two around its middle element, which moves up
+     * into the parent; a node split at its first or last position keeps all the elements on the other side,
+     * so sorted insertions fill the nodes. Erasing an element of an internal node replaces it with its predecessor,
+     * and a node left less than half full is merged with a sibling or takes elements from it.
+     * Elements move inside and between nodes, so insert and erase invalidate every iterator, pointer and reference
+     * @tparam Key        Type of the keys
+     * @tparam T          Type of the elements
+     * @tparam KeyOfValue Function object that returns the key of an element, ft::identity or ft::select1st
+     * @tparam Compare    A binary predicate that takes two element keys as arguments and returns a bool
+     * @tparam Alloc      Type of the allocator object used to define the storage allocation model
+     */
+    template< typename Key, typename T, typename KeyOfValue, typename Compare = ft::less<Key>, typename Alloc = std::allocator<T> >
+    class BTree {
+    public:
+        typedef Key                                                          key_type;
+        typedef T                                                            value_type;
+        typedef Alloc                                                        allocator_type;
+        typedef typename Alloc::template rebind< BTreeNode<T> >::other         leaf_allocator_type;
+        typedef typename Alloc::template rebind< BTreeInternalNode<T> >::other internal_allocator_type;
+        typedef Compare                                                      key_compare;
+        typedef btree_iterator<T, T*, T&>                                    iterator;
+        typedef btree_iterator<T, const T*, const T&>                        const_iterator;
+        typedef ft::reverse_iterator<iterator>                               reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                         const_reverse_iterator;
+        typedef ptrdiff_t                                                    difference_type;
+        typedef size_t                                                       size_type;
+
+    private:
+        typedef BTreeNode<value_type>         node_type;
+        typedef BTreeInternalNode<value_type> internal_node_type;
+
+        enum {
+            capacity = node_type::capacity,
+            min_count = node_type::capacity / 2
+        };
+
+        allocator_type          _alloc;
+        leaf_allocator_type     _leaf_alloc;
+        internal_allocator_type _internal_alloc;
+        key_compare             _comp;
+        node_type               *_root;
+        node_type               *_leftmost;
+        node_type               *_rightmost;
+        size_type               _size;
+
+        static const key_type &_key(const node_type *node, size_type i);
+        node_type             *_create_node(bool leaf);
+        void                  _destroy_node(node_type *node);
+        void                  _clear_node(node_type *node);
+        node_type             *_clone(const node_type *node, node_type *parent);
+        void                  _relink_ends();
+        void                  _relocate(value_type *dst, value_type *src, size_type n);
+        void                  _relocate(value_type *dst, value_type *src, size_type n, ft::true_type);
+        void                  _relocate(value_type *dst, value_type *src, size_type n, ft::false_type);
+        static void           _move_children(node_type *dst, size_type j, node_type *src, size_type i, size_type n);
+        template<typename K>
+        size_type             _node_lower_bound(const node_type *node, const K &k) const;
+        template<typename K>
+        size_type             _node_upper_bound(const node_type *node, const K &k) const;
+        iterator              _climb(node_type *node, size_type i) const;
+        template<typename K>
+        iterator              _find(const K &k) const;
+        template<typename K>
+        iterator              _lower_bound(const K &k) const;
+        template<typename K>
+        iterator              _upper_bound(const K &k) const;
+        pair<iterator, bool>  _insert_position(const key_type &k) const;
+        pair<iterator, bool>  _insert_position(iterator position, const key_type &k) const;
+        node_type             *_split(node_type *node, size_type i);
+        iterator              _make_room(node_type *node, size_type i);
+# if FT_CXX11
+        template<typename... Args>
+        iterator              _emplace_at(iterator position, Args&&... args);
+# else
+        iterator              _emplace_at(iterator position, const value_type &val);
+# endif
+        void                  _erase(node_type *node, size_type i);
+        void                  _close_gap(node_type *node, size_type i);
+        void                  _rebalance(node_type *node);
+        void                  _merge(node_type *left);
+        void                  _rotate_left(node_type *left, size_type k);
+        void                  _rotate_right(node_type *left, size_type k);
+        bool                  _verify_node(const node_type *node, const key_type *lo, const key_type *hi,
+                                           size_type levels, size_type &n) const;
+
+    public:
+        BTree(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        BTree(const BTree &src);
+# if FT_CXX11
+        BTree(BTree &&src);
+# endif
+
+        ~BTree();
+
+        BTree                                &operator=(const BTree &other);
+# if FT_CXX11
+        BTree                                &operator=(BTree &&other);
+# endif
+
+        iterator                             begin();
+        const_iterator                       begin() const;
+
+        iterator                             end();
+        const_iterator                       end() const;
+
+        reverse_iterator                     rbegin();
+        const_reverse_iterator               rbegin() const;
+
+        reverse_iterator                     rend();
+        const_reverse_iterator               rend() const;
+
+        bool                                 empty() const;
+        size_type                            size() const;
+        size_type                            max_size() const;
+
+        pair<iterator, bool>                 insert(const value_type &val);
+        iterator                             insert(iterator position, const value_type &val);
+# if FT_CXX11
+        pair<iterator, bool>                 insert(value_type &&val);
+        iterator                             insert(iterator position, value_type &&val);
+        template<typename... Args>
+        pair<iterator, bool>                 emplace(Args&&... args);
+        template<typename... Args>
+        iterator                             emplace_hint(iterator position, Args&&... args);
+# endif
+        template<typename InputIterator>
+        void                                 insert(InputIterator first, InputIterator last,
+                                                    typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        void                                 insert(assume_sorted_t, InputIterator first, InputIterator last);
+
+        void                                 erase(iterator position);
+        size_type                            erase(const key_type &k);
+        void                                 erase(iterator first, iterator last);
+
+        void                                 swap(BTree &x);
+        void                                 clear();
+
+        key_compare                          key_comp() const;
+
+        template<typename K>
+        iterator                             find(const K &k);
+        template<typename K>
+        const_iterator                       find(const K &k) const;
+
+        template<typename K>
+        size_type                            count(const K &k) const;
+
+        template<typename K>
+        iterator                             lower_bound(const K &k);
+        template<typename K>
+        const_iterator                       lower_bound(const K &k) const;
+
+        template<typename K>
+        iterator                             upper_bound(const K &k);
+        template<typename K>
+        const_iterator                       upper_bound(const K &k) const;
+
+        template<typename K>
+        pair<iterator, iterator>             equal_range(const K &k);
+        template<typename K>
+        pair<const_iterator, const_iterator> equal_range(const K &k) const;
+
+        allocator_type                       get_allocator() const;
+
+        size_type                            height() const;
+        bool                                 verify() const;
+    };
+
+    /**
+     * Get key of an element
+     * @param node Node
+     * @param i    Index of the element in the node
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    const typename BTree<Key, T, KeyOfValue, Compare, Alloc>::key_type &BTree<Key, T, KeyOfValue, Compare, Alloc>::_key(const node_type *node, size_type i) {
+        return (KeyOfValue()(node->value(i)));
+    }
+
+    /**
+     * Creates an empty node, with the allocator of its kind
+     * @param leaf Whether the node is a leaf
+     * @return New node
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::node_type *BTree<Key, T, KeyOfValue, Compare, Alloc>::_create_node(bool leaf) {
+        if (leaf) {
+            node_type *node = _leaf_alloc.allocate(1);
+            new(static_cast<void*>(node)) node_type(true);
+            return (node);
+        }
+
+        internal_node_type *node = _internal_alloc.allocate(1);
+        new(static_cast<void*>(node)) internal_node_type();
+        return (node);
+    }
+
+    /**
+     * Free a node, its elements must have been destroyed or moved out
+     * @param node Node
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_destroy_node(node_type *node) {
+        if (node->leaf) {
+            _leaf_alloc.destroy(node);
+            _leaf_alloc.deallocate(node, 1);
+        } else {
+            _internal_alloc.destroy(static_cast<internal_node_type*>(node));
+            _internal_alloc.deallocate(static_cast<internal_node_type*>(node), 1);
+        }
+    }
+
+    /**
+     * Destroy the elements of a subtree and free its nodes, missing children are skipped
+     * @param node Root of the subtree
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_clear_node(node_type *node) {
+        if (!node->leaf) {
+            for (size_type i = 0; i <= node->count; i++)
+                if (node->child(i))
+                    _clear_node(node->child(i));
+        }
+        for (size_type i = 0; i < node->count; i++)
+            _alloc.destroy(node->valptr(i));
+        _destroy_node(node);
+    }
+
+    /**
+     * Copy a subtree node by node, with the same shape. If an element fails to copy, the partial copy is freed
+     * @param node   Root of the subtree
+     * @param parent Parent of the copy
+     * @return Copy of the subtree
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::node_type *BTree<Key, T, KeyOfValue, Compare, Alloc>::_clone(const node_type *node, node_type *parent) {
+        node_type *copy = _create_node(node->leaf);
+
+        copy->parent = parent;
+        copy->position = node->position;
+        try {
+            for (; copy->count < node->count; copy->count++)
+                _alloc.construct(copy->valptr(copy->count), node->value(copy->count));
+            if (!node->leaf) {
+                for (size_type i = 0; i <= node->count; i++)
+                    copy->child(i) = _clone(node->child(i), copy);
+            }
+        } catch (...) {
+            _clear_node(copy);
+            throw;
+        }
+        return (copy);
+    }
+
+    /**
+     * Recompute the leftmost and rightmost leaves, after the whole tree was replaced
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_relink_ends() {
+        _leftmost = _root;
+        _rightmost = _root;
+        if (!_root)
+            return;
+        while (!_leftmost->leaf)
+            _leftmost = _leftmost->child(0);
+        while (!_rightmost->leaf)
+            _rightmost = _rightmost->child(_rightmost->count);
+    }
+
+    /**
+     * Move n consecutive elements to raw storage, in the same node or to another one
+     * @param dst Destination of the first element
+     * @param src First element to move
+     * @param n   Number of elements
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_relocate(value_type *dst, value_type *src, size_type n) {
+        if (dst == src || !n)
+            return;
+        _relocate(dst, src, n, ft::integral_constant<bool, ft::is_trivially_relocatable<T>::value>());
+    }
+
+    /**
+     * Bulk relocation of trivially relocatable elements
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_relocate(value_type *dst, value_type *src, size_type n, ft::true_type) {
+        std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+    }
+
+    /**
+     * Element by element relocation: copy (or move, in C++11) construct into the destination, then destroy the source.
+     * The walk direction makes sure a destination slot is always raw memory when it gets constructed
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_relocate(value_type *dst, value_type *src, size_type n, ft::false_type) {
+        if (dst < src) {
+            for (size_type i = 0; i < n; i++) {
+                ft::allocator_construct(_alloc, dst + i, FT_MOVE(src[i]));
+                _alloc.destroy(src + i);
+            }
+        } else {
+            for (size_type i = n; i > 0; i--) {
+                ft::allocator_construct(_alloc, dst + i - 1, FT_MOVE(src[i - 1]));
+                _alloc.destroy(src + i - 1);
+            }
+        }
+    }
+
+    /**
+     * Move n consecutive child pointers, in the same node or to another one, and update the moved children
+     * @param dst Destination node
+     * @param j   Index of the first destination child
+     * @param src Source node
+     * @param i   Index of the first child to move
+     * @param n   Number of children
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_move_children(node_type *dst, size_type j, node_type *src, size_type i, size_type n) {
+        if (!n)
+            return;
+        std::memmove(static_cast<void*>(&dst->child(j)), static_cast<const void*>(&src->child(i)), n * sizeof(node_type*));
+        for (size_type c = j; c < j + n; c++) {
+            dst->child(c)->parent = dst;
+            dst->child(c)->position = static_cast<unsigned short>(c);
+        }
+    }
+
+    /**
+     * Binary search of a node
+     * @param node Node
+     * @param k    Key
+     * @return The index of the first element of the node whose key does not go before k, count if there is none
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::size_type BTree<Key, T, KeyOfValue, Compare, Alloc>::_node_lower_bound(const node_type *node, const K &k) const {
+        size_type first = 0;
+        size_type n = node->count;
+
+        while (n > 0) {
+            size_type half = n / 2;
+
+            if (_comp(_key(node, first + half), k)) {
+                first += half + 1;
+                n -= half + 1;
+            } else
+                n = half;
+        }
+        return (first);
+    }
+
+    /**
+     * Binary search of a node
+     * @param node Node
+     * @param k    Key
+     * @return The index of the first element of the node whose key goes after k, count if there is none
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::size_type BTree<Key, T, KeyOfValue, Compare, Alloc>::_node_upper_bound(const node_type *node, const K &k) const {
+        size_type first = 0;
+        size_type n = node->count;
+
+        while (n > 0) {
+            size_type half = n / 2;
+
+            if (!_comp(k, _key(node, first + half))) {
+                first += half + 1;
+                n -= half + 1;
+            } else
+                n = half;
+        }
+        return (first);
+    }
+
+    /**
+     * Turn a position in a leaf into an iterator: a position past the last element of the leaf
+     * is the first ancestor element to its right, or end()
+     * @param node Leaf
+     * @param i    Index in the leaf, up to count
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::_climb(node_type *node, size_type i) const {
+        while (i == node->count && node->parent) {
+            i = node->position;
+            node = node->parent;
+        }
+        if (i == node->count)
+            return (iterator(_rightmost, _rightmost->count));
+        return (iterator(node, i));
+    }
+
+    /**
+     * Search an element with a key equivalent to k, stops at the first node that holds it
+     * @param k Key
+     * @return An iterator to the element, or end()
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::_find(const K &k) const {
+        node_type *node = _root;
+
+        while (node) {
+            size_type i = _node_lower_bound(node, k);
+
+            if (i < node->count && !_comp(k, _key(node, i)))
+                return (iterator(node, i));
+            if (node->leaf)
+                break;
+            node = node->child(i);
+        }
+        if (!_rightmost)
+            return (iterator());
+        return (iterator(_rightmost, _rightmost->count));
+    }
+
+    /**
+     * Search the first element whose key does not go before k, always down to a leaf
+     * @param k Key
+     * @return An iterator to the element, or end()
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::_lower_bound(const K &k) const {
+        node_type *node = _root;
+        size_type i;
+
+        if (!node)
+            return (iterator());
+        while (true) {
+            i = _node_lower_bound(node, k);
+            if (node->leaf)
+                break;
+            node = node->child(i);
+        }
+        return (_climb(node, i));
+    }
+
+    /**
+     * Search the first element whose key goes after k, always down to a leaf
+     * @param k Key
+     * @return An iterator to the element, or end()
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::_upper_bound(const K &k) const {
+        node_type *node = _root;
+        size_type i;
+
+        if (!node)
+            return (iterator());
+        while (true) {
+            i = _node_upper_bound(node, k);
+            if (node->leaf)
+                break;
+            node = node->child(i);
+        }
+        return (_climb(node, i));
+    }
+
+    /**
+     * Find where an element with key k goes.
+     * New elements always go into a leaf, at an index that may be the count of the leaf
+     * @param k Key of the element
+     * @return The position in a leaf and true if there is no equivalent key in the tree, the position in the
+     *         empty tree is a null node. Otherwise an iterator to the equivalent element and false
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    pair<typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, bool> BTree<Key, T, KeyOfValue, Compare, Alloc>::_insert_position(const key_type &k) const {
+        node_type *node = _root;
+
+        if (!node)
+            return (ft::make_pair(iterator(), true));
+        while (true) {
+            size_type i = _node_lower_bound(node, k);
+
+            if (i < node->count && !_comp(k, _key(node, i)))
+                return (ft::make_pair(iterator(node, i), false));
+            if (node->leaf)
+                return (ft::make_pair(iterator(node, i), true));
+            node = node->child(i);
+        }
+    }
+
+    /**
+     * Find where an element with key k goes, starting from a hint.
+     * If the key goes right before or right after the hint, the position is found with one or two comparisons:
+     * between two consecutive elements, one of them is in a leaf and the position is next to it
+     * @param position Hint
+     * @param k        Key of the element
+     * @return The position in a leaf and true if there is no equivalent key in the tree,
+     *         otherwise an iterator to the equivalent element and false
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    pair<typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, bool> BTree<Key, T, KeyOfValue, Compare, Alloc>::_insert_position(iterator position, const key_type &k) const {
+        if (!_root)
+            return (ft::make_pair(iterator(), true));
+
+        node_type *node = position.baseNode();
+        size_type i = position.position();
+
+        if (position == iterator(_rightmost, _rightmost->count)) {
+            if (_comp(_key(_rightmost, _rightmost->count - 1), k))
+                return (ft::make_pair(position, true));
+        } else if (_comp(k, _key(node, i))) {
+            if (node == _leftmost && i == 0)
+                return (ft::make_pair(position, true));
+
+            iterator prev = position;
+            --prev;
+            if (_comp(_key(prev.baseNode(), prev.position()), k)) {
+                if (node->leaf)
+                    return (ft::make_pair(position, true));
+                return (ft::make_pair(iterator(prev.baseNode(), prev.position() + 1), true));
+            }
+        } else if (!_comp(_key(node, i), k))
+            return (ft::make_pair(position, false));
+        else {
+            iterator next = position;
+            ++next;
+            if (next == iterator(_rightmost, _rightmost->count) || _comp(k, _key(next.baseNode(), next.position()))) {
+                if (node->leaf)
+                    return (ft::make_pair(iterator(node, i + 1), true));
+                return (ft::make_pair(next, true));
+            }
+        }
+        return (_insert_position(k));
+    }
+
+    /**
+     * Split a full node in two, the element at the split point moves up into the parent and the elements after it
+     * into a new right sibling. A full parent is split first, a full root gets a new root above it.
+     * The split point is the middle, except when the new element goes first or last: then the node keeps
+     * no element or all but one, which fills the nodes when the elements come in order
+     * @param node Full node
+     * @param i    Index where an element is about to be inserted into node
+     * @return The new right sibling
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::node_type *BTree<Key, T, KeyOfValue, Compare, Alloc>::_split(node_type *node, size_type i) {
+        if (node != _root && node->parent->count == capacity)
+            _split(node->parent, node->position);
+
+        node_type *sibling = _create_node(node->leaf);
+
+        if (node == _root) {
+            try {
+                _root = _create_node(false);
+            } catch (...) {
+                _destroy_node(sibling);
+                throw;
+            }
+            _root->child(0) = node;
+            node->parent = _root;
+            node->position = 0;
+        }
+
+        node_type *parent = node->parent;
+        size_type pos = node->position;
+        size_type mid = i == capacity ? capacity - 1 : (i == 0 ? 0 : capacity / 2);
+
+        _relocate(sibling->valptr(0), node->valptr(mid + 1), capacity - mid - 1);
+        if (!node->leaf)
+            _move_children(sibling, 0, node, mid + 1, capacity - mid);
+        sibling->count = static_cast<unsigned short>(capacity - mid - 1);
+
+        _relocate(parent->valptr(pos + 1), parent->valptr(pos), parent->count - pos);
+        _move_children(parent, pos + 2, parent, pos + 1, parent->count - pos);
+        _relocate(parent->valptr(pos), node->valptr(mid), 1);
+        parent->child(pos + 1) = sibling;
+        sibling->parent = parent;
+        sibling->position = static_cast<unsigned short>(pos + 1);
+        parent->count++;
+        node->count = static_cast<unsigned short>(mid);
+
+        if (node == _rightmost)
+            _rightmost = sibling;
+        return (sibling);
+    }
+
+    /**
+     * Open a gap for a new element in a leaf, splitting it first if it is full
+     * @param node Leaf
+     * @param i    Index of the new element
+     * @return An iterator to the gap, raw storage already counted in the leaf
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::_make_room(node_type *node, size_type i) {
+        if (node->count == capacity) {
+            node_type *sibling = _split(node, i);
+
+            if (i > node->count) {
+                i -= node->count + 1;
+                node = sibling;
+            }
+        }
+        _relocate(node->valptr(i + 1), node->valptr(i), node->count - i);
+        node->count++;
+        return (iterator(node, i));
+    }
+
+# if FT_CXX11
+    /**
+     * Construct an element at a position returned by _insert_position. If the constructor throws, the gap is closed
+     * @param position Position in a leaf, or a null node for an empty tree
+     * @param args     Arguments forwarded to the constructor of the element
+     * @return An iterator to the new element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename... Args>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::_emplace_at(iterator position, Args&&... args) {
+        if (!position.baseNode()) {
+            _root = _create_node(true);
+            _leftmost = _root;
+            _rightmost = _root;
+            position = iterator(_root, 0);
+        }
+
+        iterator it = _make_room(position.baseNode(), position.position());
+
+        try {
+            ft::allocator_construct(_alloc, it.baseNode()->valptr(it.position()), std::forward<Args>(args)...);
+        } catch (...) {
+            _close_gap(it.baseNode(), it.position());
+            throw;
+        }
+        _size++;
+        return (it);
+    }
+# else
+    /**
+     * Construct an element at a position returned by _insert_position. If the constructor throws, the gap is closed
+     * @param position Position in a leaf, or a null node for an empty tree
+     * @param val      Value to be copied to the element
+     * @return An iterator to the new element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::_emplace_at(iterator position, const value_type &val) {
+        if (!position.baseNode()) {
+            _root = _create_node(true);
+            _leftmost = _root;
+            _rightmost = _root;
+            position = iterator(_root, 0);
+        }
+
+        iterator it = _make_room(position.baseNode(), position.position());
+
+        try {
+            _alloc.construct(it.baseNode()->valptr(it.position()), val);
+        } catch (...) {
+            _close_gap(it.baseNode(), it.position());
+            throw;
+        }
+        _size++;
+        return (it);
+    }
+# endif
+
+    /**
+     * Destroy an element. In an internal node its predecessor, the last element of a leaf, takes its place,
+     * so the gap is always closed in a leaf
+     * @param node Node of the element
+     * @param i    Index of the element in the node
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_erase(node_type *node, size_type i) {
+        _alloc.destroy(node->valptr(i));
+        if (!node->leaf) {
+            node_type *leaf = node->child(i);
+
+            while (!leaf->leaf)
+                leaf = leaf->child(leaf->count);
+            _relocate(node->valptr(i), leaf->valptr(leaf->count - 1), 1);
+            node = leaf;
+            i = leaf->count - 1;
+        }
+        _size--;
+        _close_gap(node, i);
+    }
+
+    /**
+     * Shift the elements after a raw slot of a leaf back over it, then rebalance the leaf
+     * @param node Leaf
+     * @param i    Index of the raw slot
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_close_gap(node_type *node, size_type i) {
+        _relocate(node->valptr(i), node->valptr(i + 1), node->count - i - 1);
+        node->count--;
+        _rebalance(node);
+    }
+
+    /**
+     * Restore the fill of a node after it lost an element. A node less than half full is merged with a sibling
+     * when both fit in one node, which removes an element from the parent and may cascade up;
+     * otherwise it takes elements from its fuller sibling until both hold about as many.
+     * An empty root is replaced by its only child, or freed when it is a leaf
+     * @param node Node that lost an element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_rebalance(node_type *node) {
+        while (node != _root && node->count < min_count) {
+            node_type *parent = node->parent;
+            size_type pos = node->position;
+            node_type *left = pos > 0 ? parent->child(pos - 1) : NULL;
+            node_type *right = pos < parent->count ? parent->child(pos + 1) : NULL;
+
+            if (left && left->count + node->count < capacity)
+                _merge(left);
+            else if (right && node->count + right->count < capacity)
+                _merge(node);
+            else {
+                if (left && (!right || left->count >= right->count))
+                    _rotate_right(left, (left->count - node->count) / 2);
+                else
+                    _rotate_left(node, (right->count - node->count) / 2);
+                return;
+            }
+            node = parent;
+        }
+        if (node != _root || node->count)
+            return;
+        if (node->leaf) {
+            _root = NULL;
+            _leftmost = NULL;
+            _rightmost = NULL;
+        } else {
+            _root = node->child(0);
+            _root->parent = NULL;
+            _root->position = 0;
+        }
+        _destroy_node(node);
+    }
+
+    /**
+     * Merge a node, the element that separates it from its right sibling, and the right sibling, into the node
+     * @param left Node, left + right + 1 elements fit in it
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_merge(node_type *left) {
+        node_type *parent = left->parent;
+        size_type pos = left->position;
+        node_type *right = parent->child(pos + 1);
+        size_type n = left->count;
+
+        _relocate(left->valptr(n), parent->valptr(pos), 1);
+        _relocate(left->valptr(n + 1), right->valptr(0), right->count);
+        if (!left->leaf)
+            _move_children(left, n + 1, right, 0, right->count + 1);
+        left->count = static_cast<unsigned short>(n + 1 + right->count);
+
+        _relocate(parent->valptr(pos), parent->valptr(pos + 1), parent->count - pos - 1);
+        _move_children(parent, pos + 1, parent, pos + 2, parent->count - pos - 1);
+        parent->count--;
+
+        if (right == _rightmost)
+            _rightmost = left;
+        _destroy_node(right);
+    }
+
+    /**
+     * Move the first k elements of the right sibling of a node into the node, through the parent
+     * @param left Node
+     * @param k    Number of elements, at least 1 and less than the count of the sibling
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_rotate_left(node_type *left, size_type k) {
+        node_type *parent = left->parent;
+        size_type pos = left->position;
+        node_type *right = parent->child(pos + 1);
+        size_type n = left->count;
+
+        _relocate(left->valptr(n), parent->valptr(pos), 1);
+        _relocate(left->valptr(n + 1), right->valptr(0), k - 1);
+        _relocate(parent->valptr(pos), right->valptr(k - 1), 1);
+        _relocate(right->valptr(0), right->valptr(k), right->count - k);
+        if (!left->leaf) {
+            _move_children(left, n + 1, right, 0, k);
+            _move_children(right, 0, right, k, right->count - k + 1);
+        }
+        left->count = static_cast<unsigned short>(n + k);
+        right->count = static_cast<unsigned short>(right->count - k);
+    }
+
+    /**
+     * Move the last k elements of a node into its right sibling, through the parent
+     * @param left Node
+     * @param k    Number of elements, at least 1 and less than the count of the node
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::_rotate_right(node_type *left, size_type k) {
+        node_type *parent = left->parent;
+        size_type pos = left->position;
+        node_type *right = parent->child(pos + 1);
+        size_type n = left->count;
+
+        _relocate(right->valptr(k), right->valptr(0), right->count);
+        _relocate(right->valptr(k - 1), parent->valptr(pos), 1);
+        _relocate(right->valptr(0), left->valptr(n - k + 1), k - 1);
+        _relocate(parent->valptr(pos), left->valptr(n - k), 1);
+        if (!left->leaf) {
+            _move_children(right, k, right, 0, right->count + 1);
+            _move_children(right, 0, left, n - k + 1, k);
+        }
+        left->count = static_cast<unsigned short>(n - k);
+        right->count = static_cast<unsigned short>(right->count + k);
+    }
+
+    /**
+     * Empty container constructor
+     * @param comp  Comparison object
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    BTree<Key, T, KeyOfValue, Compare, Alloc>::BTree(const key_compare &comp, const allocator_type &alloc):
+    _alloc(alloc), _leaf_alloc(alloc), _internal_alloc(alloc), _comp(comp), _root(NULL), _leftmost(NULL), _rightmost(NULL), _size(0) {}
+
+    /**
+     * Copy constructor, the copy has the same shape
+     * @param src Another BTree object of the same type
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    BTree<Key, T, KeyOfValue, Compare, Alloc>::BTree(const BTree &src):
+    _alloc(src._alloc), _leaf_alloc(src._leaf_alloc), _internal_alloc(src._internal_alloc), _comp(src._comp),
+    _root(NULL), _leftmost(NULL), _rightmost(NULL), _size(0) {
+        if (src._root)
+            _root = _clone(src._root, NULL);
+        _size = src._size;
+        _relink_ends();
+    }
+
+# if FT_CXX11
+    /**
+     * Move constructor, takes over the nodes of src and leaves it empty
+     * @param src Another BTree object of the same type
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    BTree<Key, T, KeyOfValue, Compare, Alloc>::BTree(BTree &&src):
+    _alloc(src._alloc), _leaf_alloc(src._leaf_alloc), _internal_alloc(src._internal_alloc), _comp(src._comp),
+    _root(src._root), _leftmost(src._leftmost), _rightmost(src._rightmost), _size(src._size) {
+        src._root = NULL;
+        src._leftmost = NULL;
+        src._rightmost = NULL;
+        src._size = 0;
+    }
+# endif
+
+    /**
+     * Destructor
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    BTree<Key, T, KeyOfValue, Compare, Alloc>::~BTree() {
+        clear();
+    }
+
+    /**
+     * Copy container content, the current content is kept if the copy fails
+     * @param other A BTree object of the same type
+     * @return *this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    BTree<Key, T, KeyOfValue, Compare, Alloc> &BTree<Key, T, KeyOfValue, Compare, Alloc>::operator=(const BTree &other) {
+        if (this == &other)
+            return (*this);
+
+        BTree tmp(other);
+
+        swap(tmp);
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     * @param other A BTree object of the same type
+     * @return *this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    BTree<Key, T, KeyOfValue, Compare, Alloc> &BTree<Key, T, KeyOfValue, Compare, Alloc>::operator=(BTree &&other) {
+        if (this == &other)
+            return (*this);
+
+        clear();
+        swap(other);
+
+        return (*this);
+    }
+# endif
+
+    /**
+     * Return iterator to beginning
+     * @return An iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::begin() {
+        return (iterator(_leftmost, 0));
+    }
+
+    /**
+     * Return const iterator to beginning
+     * @return A const iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::begin() const {
+        return (const_iterator(_leftmost, 0));
+    }
+
+    /**
+     * Return iterator to end
+     * @return An iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::end() {
+        return (iterator(_rightmost, _rightmost ? _rightmost->count : 0));
+    }
+
+    /**
+     * Return const iterator to end
+     * @return A const iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::end() const {
+        return (const_iterator(_rightmost, _rightmost ? _rightmost->count : 0));
+    }
+
+    /**
+     * Return reverse iterator to reverse beginning
+     * @return A reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::reverse_iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::rbegin() {
+        return (reverse_iterator(end()));
+    }
+
+    /**
+     * Return const reverse iterator to reverse beginning
+     * @return A const reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::const_reverse_iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::rbegin() const {
+        return (const_reverse_iterator(end()));
+    }
+
+    /**
+     * Return reverse iterator to reverse end
+     * @return A reverse iterator to the reverse end of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::reverse_iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::rend() {
+        return (reverse_iterator(begin()));
+    }
+
+    /**
+     * Return const reverse iterator to reverse end
+     * @return A const reverse iterator to the reverse end of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::const_reverse_iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::rend() const {
+        return (const_reverse_iterator(begin()));
+    }
+
+    /**
+     * Test whether container is empty
+     * @return true if the container size is 0, false otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    bool BTree<Key, T, KeyOfValue, Compare, Alloc>::empty() const {
+        return (!_root);
+    }
+
+    /**
+     * Return container size
+     * @return The number of elements in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::size_type BTree<Key, T, KeyOfValue, Compare, Alloc>::size() const {
+        return (_size);
+    }
+
+    /**
+     * Return maximum size
+     * @return The maximum number of elements the container can hold as content
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::size_type BTree<Key, T, KeyOfValue, Compare, Alloc>::max_size() const {
+        return (_alloc.max_size());
+    }
+
+    /**
+     * Insert element, nothing is copied if an equivalent element is present
+     * @param val Value to be copied to the inserted element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    pair<typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, bool> BTree<Key, T, KeyOfValue, Compare, Alloc>::insert(const value_type &val) {
+        pair<iterator, bool> pos = _insert_position(KeyOfValue()(val));
+
+        if (!pos.second)
+            return (pos);
+        return (ft::make_pair(_emplace_at(pos.first, val), true));
+    }
+
+    /**
+     * Insert element with hint
+     * @param position Hint for the position where the element can be inserted,
+     *                 the search is skipped if the element goes right before or after position
+     * @param val      Value to be copied to the inserted element
+     * @return An iterator to the inserted or the already present element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::insert(iterator position, const value_type &val) {
+        pair<iterator, bool> pos = _insert_position(position, KeyOfValue()(val));
+
+        if (!pos.second)
+            return (pos.first);
+        return (_emplace_at(pos.first, val));
+    }
+
+# if FT_CXX11
+    /**
+     * Insert element, val is moved only if no equivalent element is present
+     * @param val Value to be moved to the inserted element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    pair<typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, bool> BTree<Key, T, KeyOfValue, Compare, Alloc>::insert(value_type &&val) {
+        pair<iterator, bool> pos = _insert_position(KeyOfValue()(val));
+
+        if (!pos.second)
+            return (pos);
+        return (ft::make_pair(_emplace_at(pos.first, std::move(val)), true));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::insert(iterator position, value_type &&val) {
+        pair<iterator, bool> pos = _insert_position(position, KeyOfValue()(val));
+
+        if (!pos.second)
+            return (pos.first);
+        return (_emplace_at(pos.first, std::move(val)));
+    }
+
+    /**
+     * Construct and insert element, the element is built first to get its key, then moved into the tree
+     * @param args Arguments forwarded to the constructor of the element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename... Args>
+    pair<typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, bool> BTree<Key, T, KeyOfValue, Compare, Alloc>::emplace(Args&&... args) {
+        return (insert(value_type(std::forward<Args>(args)...)));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename... Args>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::emplace_hint(iterator position, Args&&... args) {
+        return (insert(position, value_type(std::forward<Args>(args)...)));
+    }
+# endif
+
+    /**
+     * Insert elements, each one with end() as the hint: a sorted range is appended to the rightmost leaf
+     * with one comparison per element
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::insert(InputIterator first, InputIterator last,
+                                                           typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*) {
+        while (first != last) {
+            insert(end(), *first);
+            first++;
+        }
+    }
+
+    /**
+     * Insert a range sorted by key that holds no equivalent keys.
+     * An empty tree is filled from it without comparing the elements,
+     * otherwise every element is inserted with end() as the hint
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::insert(assume_sorted_t, InputIterator first, InputIterator last) {
+        if (!_root) {
+            for (; first != last; first++)
+                _emplace_at(end(), *first);
+            return;
+        }
+        insert(first, last);
+    }
+
+    /**
+     * Erase element
+     * @param position Iterator pointing to a single element to be removed from the tree
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::erase(iterator position) {
+        _erase(position.baseNode(), position.position());
+    }
+
+    /**
+     * Erase element
+     * @param k Key of the element to be removed from the tree
+     * @return Number of elements erased
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::size_type BTree<Key, T, KeyOfValue, Compare, Alloc>::erase(const key_type &k) {
+        iterator it = _find(k);
+
+        if (it == end())
+            return (0);
+        erase(it);
+        return (1);
+    }
+
+    /**
+     * Erase elements. Erasing moves the elements around, so the range is counted first
+     * and its elements are erased one by one from the lower bound of the key of the first one
+     * @param first Iterator to the initial position in a range
+     * @param last  Iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::erase(iterator first, iterator last) {
+        if (first == begin() && last == end()) {
+            clear();
+            return;
+        }
+
+        size_type n = ft::distance(first, last);
+
+        if (!n)
+            return;
+
+        key_type k = KeyOfValue()(*first);
+
+        while (n--) {
+            iterator it = _lower_bound(k);
+
+            _erase(it.baseNode(), it.position());
+        }
+    }
+
+    /**
+     * Swap content
+     * @param x Another BTree container of the same type as this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::swap(BTree &x) {
+        allocator_type          _alloc_tmp = this->_alloc;
+        leaf_allocator_type     _leaf_alloc_tmp = this->_leaf_alloc;
+        internal_allocator_type _internal_alloc_tmp = this->_internal_alloc;
+        key_compare             _comp_tmp = this->_comp;
+        node_type               *_root_tmp = this->_root;
+        node_type               *_leftmost_tmp = this->_leftmost;
+        node_type               *_rightmost_tmp = this->_rightmost;
+        size_type               _size_tmp = this->_size;
+
+        this->_alloc = x._alloc;
+        this->_leaf_alloc = x._leaf_alloc;
+        this->_internal_alloc = x._internal_alloc;
+        this->_comp = x._comp;
+        this->_root = x._root;
+        this->_leftmost = x._leftmost;
+        this->_rightmost = x._rightmost;
+        this->_size = x._size;
+
+        x._alloc = _alloc_tmp;
+        x._leaf_alloc = _leaf_alloc_tmp;
+        x._internal_alloc = _internal_alloc_tmp;
+        x._comp = _comp_tmp;
+        x._root = _root_tmp;
+        x._leftmost = _leftmost_tmp;
+        x._rightmost = _rightmost_tmp;
+        x._size = _size_tmp;
+    }
+
+    /**
+     * Clear content
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void BTree<Key, T, KeyOfValue, Compare, Alloc>::clear() {
+        if (_root)
+            _clear_node(_root);
+        _root = NULL;
+        _leftmost = NULL;
+        _rightmost = NULL;
+        _size = 0;
+    }
+
+    /**
+     * Return key comparison object
+     * @return The comparison object
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::key_compare BTree<Key, T, KeyOfValue, Compare, Alloc>::key_comp() const {
+        return (_comp);
+    }
+
+    /**
+     * Get iterator to element
+     * @param k Key to be searched for
+     * @return An iterator to the element, if an element with a key equivalent to k is found, or end otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::find(const K &k) {
+        return (_find(k));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::find(const K &k) const {
+        return (_find(k));
+    }
+
+    /**
+     * Count elements with a specific key
+     * @param k Key to search for
+     * @return 1 if the container contains an element with a key equivalent to k, and zero otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::size_type BTree<Key, T, KeyOfValue, Compare, Alloc>::count(const K &k) const {
+        return (_find(k) != end());
+    }
+
+    /**
+     * Return iterator to lower bound
+     * @param k Key to search for
+     * @return An iterator to the first element whose key is not considered to go before k, or end
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::lower_bound(const K &k) {
+        return (_lower_bound(k));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::lower_bound(const K &k) const {
+        return (_lower_bound(k));
+    }
+
+    /**
+     * Return iterator to upper bound
+     * @param k Key to search for
+     * @return An iterator to the first element whose key is considered to go after k, or end
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::upper_bound(const K &k) {
+        return (_upper_bound(k));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator BTree<Key, T, KeyOfValue, Compare, Alloc>::upper_bound(const K &k) const {
+        return (_upper_bound(k));
+    }
+
+    /**
+     * Get range of equal elements, with one search: the upper bound is the element after the lower bound
+     * when the lower bound is equivalent to k
+     * @param k Key to search for
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    pair<typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, typename BTree<Key, T, KeyOfValue, Compare, Alloc>::iterator>
+    BTree<Key, T, KeyOfValue, Compare, Alloc>::equal_range(const K &k) {
+        iterator first = _lower_bound(k);
+        iterator last = first;
+
+        if (first != end() && !_comp(k, KeyOfValue()(*first)))
+            ++last;
+        return (ft::make_pair(first, last));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    pair<typename BTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator, typename BTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator>
+    BTree<Key, T, KeyOfValue, Compare, Alloc>::equal_range(const K &k) const {
+        const_iterator first = _lower_bound(k);
+        const_iterator last = first;
+
+        if (first != end() && !_comp(k, KeyOfValue()(*first)))
+            ++last;
+        return (ft::make_pair(first, last));
+    }
+
+    /**
+     * Get allocator
+     * @return The allocator
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::allocator_type BTree<Key, T, KeyOfValue, Compare, Alloc>::get_allocator() const {
+        return (_alloc);
+    }
+
+    /**
+     * Get height of the tree, every leaf is at the same depth
+     * @return The number of nodes on a path from the root down to a leaf
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename BTree<Key, T, KeyOfValue, Compare, Alloc>::size_type BTree<Key, T, KeyOfValue, Compare, Alloc>::height() const {
+        size_type h = 0;
+
+        for (const node_type *node = _root; node; node = node->leaf ? NULL : node->child(0))
+            h++;
+        return (h);
+    }
+
+    /**
+     * Check a subtree: every node but the root holds an element, the keys are sorted and between the bounds
+     * given by the parent, the child links point back to their parent and index, and the leaves are at the same depth
+     * @param node   Root of the subtree
+     * @param lo     Key every element must go after, or NULL
+     * @param hi     Key every element must go before, or NULL
+     * @param levels Number of levels the subtree must have
+     * @param n      Incremented by the number of elements of the subtree
+     * @return true if the subtree is valid
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    bool BTree<Key, T, KeyOfValue, Compare, Alloc>::_verify_node(const node_type *node, const key_type *lo, const key_type *hi,
+                                                                 size_type levels, size_type &n) const {
+        if ((node != _root && !node->count) || node->count > capacity || node->leaf != (levels == 1))
+            return (false);
+        for (size_type i = 0; i < node->count; i++) {
+            const key_type *prev = i ? &_key(node, i - 1) : lo;
+
+            if ((prev && !_comp(*prev, _key(node, i))) || (hi && !_comp(_key(node, i), *hi)))
+                return (false);
+        }
+        n += node->count;
+        if (node->leaf)
+            return (true);
+        for (size_type i = 0; i <= node->count; i++) {
+            const node_type *child = node->child(i);
+
+            if (!child || child->parent != node || child->position != i)
+                return (false);
+            if (!_verify_node(child, i ? &_key(node, i - 1) : lo, i < node->count ? &_key(node, i) : hi, levels - 1, n))
+                return (false);
+        }
+        return (true);
+    }
+
+    /**
+     * Check every invariant of the tree: the node fill and links, the key order, the depth of the leaves,
+     * the element count and the cached leftmost and rightmost leaves. Takes linear time
+     * @return true if the tree is valid
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    bool BTree<Key, T, KeyOfValue, Compare, Alloc>::verify() const {
+        if (!_root)
+            return (_size == 0 && !_leftmost && !_rightmost);
+        if (_root->parent)
+            return (false);
+
+        const node_type *leftmost = _root;
+        const node_type *rightmost = _root;
+        size_type       n = 0;
+
+        while (!leftmost->leaf)
+            leftmost = leftmost->child(0);
+        while (!rightmost->leaf)
+            rightmost = rightmost->child(rightmost->count);
+        if (leftmost != _leftmost || rightmost != _rightmost)
+            return (false);
+        if (!_verify_node(_root, NULL, NULL, height(), n))
+            return (false);
+        return (n == _size);
+    }
+
+}
+
+#endif //FT_CONTAINERS_BTREE_HPP
@@ -0,0 +1,308 @@
+#ifndef FT_CONTAINERS_COUNTING_ALLOCATOR_HPP
+# define FT_CONTAINERS_COUNTING_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <new>
+# include <limits>
+# include <ostream>
+# include <iomanip>
+# include "type_traits.hpp"
+
+namespace ft {
+
+    /**
+     * Allocation counters shared by all copies and rebinds of a counting_allocator
+     */
+    struct allocation_stats {
+        static const size_t buckets = 32;
+
+        size_t allocations;
+        size_t deallocations;
+        size_t allocated_bytes;
+        size_t live_bytes;
+        size_t peak_bytes;
+        size_t histogram[buckets];
+
+        allocation_stats();
+
+        void          reset();
+        void          on_allocate(size_t bytes);
+        void          on_deallocate(size_t bytes);
+        size_t        live_allocations() const;
+
+        static size_t bucket(size_t bytes);
+        static size_t bucket_limit(size_t bucket);
+    };
+
+    inline allocation_stats::allocation_stats() {
+        reset();
+    }
+
+    /**
+     * Zero every counter
+     */
+    inline void allocation_stats::reset() {
+        allocations = 0;
+        deallocations = 0;
+        allocated_bytes = 0;
+        live_bytes = 0;
+        peak_bytes = 0;
+        for (size_t i = 0; i < buckets; i++)
+            histogram[i] = 0;
+    }
+
+    inline void allocation_stats::on_allocate(size_t bytes) {
+        allocations++;
+        allocated_bytes += bytes;
+        live_bytes += bytes;
+        if (live_bytes > peak_bytes)
+            peak_bytes = live_bytes;
+        histogram[bucket(bytes)]++;
+    }
+
+    inline void allocation_stats::on_deallocate(size_t bytes) {
+        deallocations++;
+        live_bytes -= bytes;
+    }
+
+    /**
+     * Number of blocks allocated and not yet deallocated
+     */
+    inline size_t allocation_stats::live_allocations() const {
+        return (allocations - deallocations);
+    }
+
+    /**
+     * Histogram bucket of an allocation size: bucket k holds sizes in (2^(k-1), 2^k]
+     * @param bytes Allocation size
+     * @return Bucket index, the last bucket holds every larger size
+     */
+    inline size_t allocation_stats::bucket(size_t bytes) {
+        size_t k = 0;
+        while (k < buckets - 1 && (static_cast<size_t>(1) << k) < bytes)
+            k++;
+        return (k);
+    }
+
+    /**
+     * Largest allocation size counted in a bucket
+     */
+    inline size_t allocation_stats::bucket_limit(size_t bucket) {
+        return (static_cast<size_t>(1) << bucket);
+    }
+
+    /**
+     * Stats block shared by every default constructed counting_allocator, of any element type.
+     * Containers whose allocator was not given its own stats all count into it, so its counters are process-wide
+     * @return The shared stats
+     */
+    inline allocation_stats &default_allocation_stats() {
+        static allocation_stats stats;
+        return (stats);
+    }
+
+    /**
+     * Print an allocation report: counters and non-empty histogram buckets
+     */
+    inline std::ostream &operator<<(std::ostream &o, const allocation_stats &stats) {
+        o << "allocations:      " << stats.allocations << std::endl;
+        o << "deallocations:    " << stats.deallocations << std::endl;
+        o << "allocated bytes:  " << stats.allocated_bytes << std::endl;
+        o << "live bytes:       " << stats.live_bytes << std::endl;
+        o << "peak bytes:       " << stats.peak_bytes << std::endl;
+        o << "size histogram:" << std::endl;
+        for (size_t i = 0; i < allocation_stats::buckets; i++) {
+            if (!stats.histogram[i])
+                continue;
+            o << "  <= " << std::setw(10) << allocation_stats::bucket_limit(i) << " bytes: " << stats.histogram[i] << std::endl;
+        }
+        return (o);
+    }
+
+    /**
+     * Allocator that records every allocate/deallocate call into an allocation_stats object.
+     * Copies and rebinds share the same stats, so one stats object describes a whole container,
+     * including the nodes it allocates through a rebound allocator, as long as the container was given
+     * an allocator built on its own stats. Default constructed allocators all share default_allocation_stats()
+     * @tparam T Type of the elements
+     */
+    template<typename T>
+    class counting_allocator {
+    public:
+        typedef T         value_type;
+        typedef T         *pointer;
+        typedef const T   *const_pointer;
+        typedef T         &reference;
+        typedef const T   &const_reference;
+        typedef size_t    size_type;
+        typedef ptrdiff_t difference_type;
+
+        template<typename U>
+        struct rebind {
+            typedef counting_allocator<U> other;
+        };
+
+    private:
+        allocation_stats *_stats;
+
+        template<typename U> friend class counting_allocator;
+
+    public:
+        counting_allocator();
+        explicit counting_allocator(allocation_stats *stats);
+        counting_allocator(const counting_allocator &src);
+        template<typename U>
+        counting_allocator(const counting_allocator<U> &src);
+
+        ~counting_allocator();
+
+        counting_allocator      &operator=(const counting_allocator &other);
+
+        pointer                 address(reference x) const;
+        const_pointer           address(const_reference x) const;
+
+        pointer                 allocate(size_type n, const void *hint = 0);
+        void                    deallocate(pointer p, size_type n);
+
+        size_type               max_size() const;
+
+# if FT_CXX11
+        template<typename U, typename... Args>
+        void                    construct(U *p, Args&&... args);
+# else
+        void                    construct(pointer p, const_reference val);
+# endif
+        void                    destroy(pointer p);
+
+        allocation_stats        &stats() const;
+
+        static allocation_stats &default_stats();
+
+        template<typename U>
+        bool                    operator==(const counting_allocator<U> &other) const;
+        template<typename U>
+        bool                    operator!=(const counting_allocator<U> &other) const;
+    };
+
+    /**
+     * Stats used by allocators that were not given their own
+     * @return default_allocation_stats(), shared by every default constructed counting_allocator
+     */
+    template<typename T>
+    allocation_stats &counting_allocator<T>::default_stats() {
+        return (default_allocation_stats());
+    }
+
+    /**
+     * Default constructor, counts into the process-wide default_allocation_stats(), shared with every other
+     * default constructed allocator. Pass a stats object to count one container alone
+     */
+    template<typename T>
+    counting_allocator<T>::counting_allocator(): _stats(&default_allocation_stats()) {}
+
+    /**
+     * Constructor from stats object
+     * @param stats Stats to count into, must outlive the allocator and every container using it
+     */
+    template<typename T>
+    counting_allocator<T>::counting_allocator(allocation_stats *stats): _stats(stats) {}
+
+    template<typename T>
+    counting_allocator<T>::counting_allocator(const counting_allocator &src): _stats(src._stats) {}
+
+    template<typename T>
+    template<typename U>
+    counting_allocator<T>::counting_allocator(const counting_allocator<U> &src): _stats(src._stats) {}
+
+    template<typename T>
+    counting_allocator<T>::~counting_allocator() {}
+
+    template<typename T>
+    counting_allocator<T> &counting_allocator<T>::operator=(const counting_allocator &other) {
+        _stats = other._stats;
+        return (*this);
+    }
+
+    template<typename T>
+    typename counting_allocator<T>::pointer counting_allocator<T>::address(reference x) const {
+        return (&x);
+    }
+
+    template<typename T>
+    typename counting_allocator<T>::const_pointer counting_allocator<T>::address(const_reference x) const {
+        return (&x);
+    }
+
+    /**
+     * Allocate block of storage
+     * @param n Number of elements
+     * @return A pointer to the initial element in the block of storage
+     */
+    template<typename T>
+    typename counting_allocator<T>::pointer counting_allocator<T>::allocate(size_type n, const void *hint) {
+        (void)hint;
+        if (n > max_size())
+            throw std::bad_alloc();
+        pointer p = static_cast<pointer>(::operator new(n * sizeof(T)));
+        _stats->on_allocate(n * sizeof(T));
+        return (p);
+    }
+
+    /**
+     * Release block of storage
+     * @param p Pointer to a block of storage previously allocated with allocate
+     * @param n Number of elements allocated on the call to allocate for this block of storage
+     */
+    template<typename T>
+    void counting_allocator<T>::deallocate(pointer p, size_type n) {
+        _stats->on_deallocate(n * sizeof(T));
+        ::operator delete(p);
+    }
+
+    template<typename T>
+    typename counting_allocator<T>::size_type counting_allocator<T>::max_size() const {
+        return (std::numeric_limits<size_type>::max() / sizeof(T));
+    }
+
+# if FT_CXX11
+    template<typename T>
+    template<typename U, typename... Args>
+    void counting_allocator<T>::construct(U *p, Args&&... args) {
+        new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+# else
+    template<typename T>
+    void counting_allocator<T>::construct(pointer p, const_reference val) {
+        new(static_cast<void*>(p)) T(val);
+    }
+# endif
+
+    template<typename T>
+    void counting_allocator<T>::destroy(pointer p) {
+        p->~T();
+    }
+
+    /**
+     * Get stats
+     * @return The stats this allocator counts into
+     */
+    template<typename T>
+    allocation_stats &counting_allocator<T>::stats() const {
+        return (*_stats);
+    }
+
+    template<typename T>
+    template<typename U>
+    bool counting_allocator<T>::operator==(const counting_allocator<U> &other) const {
+        return (_stats == other._stats);
+    }
+
+    template<typename T>
+    template<typename U>
+    bool counting_allocator<T>::operator!=(const counting_allocator<U> &other) const {
+        return (_stats != other._stats);
+    }
+
+}
+
+#endif //FT_CONTAINERS_COUNTING_ALLOCATOR_HPP
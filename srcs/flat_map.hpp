@@ -0,0 +1,821 @@
+#ifndef FT_CONTAINERS_FLAT_MAP_HPP
+# define FT_CONTAINERS_FLAT_MAP_HPP
+
+# include <memory>
+# include "utility.hpp"
+# include "algorithm.hpp"
+# include "functional.hpp"
+# include "flat_tree.hpp"
+# include "iterator.hpp"
+
+namespace ft {
+
+    /**
+     * Associative container that store elements formed by a combination of a key value and a mapped value, following a specific order.
+     * Same interface as map, but the elements are stored sorted in one ft::vector, see FlatTree: memory per element
+     * is the element, lookups are a binary search over contiguous memory and iteration walks an array.
+     * Inserting or erasing an element shifts the elements after it, which invalidates every iterator and reference;
+     * build the container with the range constructor or a range insert, which sort and merge in one pass
+     * @tparam Key     Type of the keys
+     * @tparam T       Type of the mapped value
+     * @tparam Compare A binary predicate that takes two element keys as arguments and returns a bool
+     * @tparam Alloc   Type of the allocator object used to define the storage allocation model
+     */
+    template< typename Key, typename T, typename Compare = less<Key>, typename Alloc = std::allocator< pair<const Key, T> > >
+    class flat_map {
+    public:
+        typedef Key                                                                                key_type;
+        typedef T                                                                                  mapped_type;
+        typedef pair<const key_type, mapped_type>                                     value_type;
+        typedef Compare                                                                            key_compare;
+        typedef Alloc                                                                              allocator_type;
+        typedef typename allocator_type::reference                                                 reference;
+        typedef typename allocator_type::const_reference                                           const_reference;
+        typedef typename allocator_type::pointer                                                   pointer;
+        typedef typename allocator_type::const_pointer                                             const_pointer;
+
+        /**
+         * Value comparison object
+         */
+        class value_compare {
+            friend class flat_map;
+
+        protected:
+            key_compare _comp;
+            explicit value_compare(Compare c);
+
+        public:
+            typedef bool       result_type;
+            typedef value_type first_argument_type;
+            typedef value_type second_argument_type;
+
+            bool operator()(const value_type &x, const value_type &y) const;
+        };
+
+    private:
+        typedef FlatTree<key_type, value_type, ft::select1st<value_type>, key_compare, allocator_type> tree_type;
+
+        tree_type _tree;
+
+    public:
+        typedef typename tree_type::iterator                                                      iterator;
+        typedef typename tree_type::const_iterator                                    const_iterator;
+        typedef typename tree_type::reverse_iterator                                              reverse_iterator;
+        typedef typename tree_type::const_reverse_iterator                                        const_reverse_iterator;
+        typedef typename tree_type::difference_type                                               difference_type;
+        typedef typename tree_type::size_type                                                     size_type;
+
+        explicit flat_map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        template<typename InputIterator>
+        flat_map(InputIterator first, InputIterator last,
+            const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type(),
+            typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        flat_map(assume_sorted_t, InputIterator first, InputIterator last,
+            const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        flat_map(const flat_map &src);
+# if FT_CXX11
+        flat_map(flat_map &&src);
+# endif
+
+        ~flat_map();
+
+        flat_map                                  &operator=(const flat_map &other);
+# if FT_CXX11
+        flat_map                                  &operator=(flat_map &&other);
+# endif
+
+        iterator                             begin();
+        const_iterator                       begin() const;
+
+        iterator                             end();
+        const_iterator                       end() const;
+
+        reverse_iterator                     rbegin();
+        const_reverse_iterator               rbegin() const;
+
+        reverse_iterator                     rend();
+        const_reverse_iterator               rend() const;
+
+        bool                                 empty() const;
+        size_type                            size() const;
+        size_type                            max_size() const;
+        size_type                            capacity() const;
+        void                                 reserve(size_type n);
+
+        mapped_type                          &operator[](const key_type &k);
+
+        pair<iterator, bool>                 insert(const value_type &val);
+        iterator                             insert(iterator position, const value_type &val);
+# if FT_CXX11
+        pair<iterator, bool>                 insert(value_type &&val);
+        iterator                             insert(iterator position, value_type &&val);
+        template<typename... Args>
+        pair<iterator, bool>                 emplace(Args&&... args);
+        template<typename... Args>
+        iterator                             emplace_hint(iterator position, Args&&... args);
+        template<typename... Args>
+        pair<iterator, bool>                 try_emplace(const key_type &k, Args&&... args);
+        template<typename... Args>
+        pair<iterator, bool>                 try_emplace(key_type &&k, Args&&... args);
+# endif
+        template<typename InputIterator>
+        void                                 insert(InputIterator first, InputIterator last,
+                                    typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        void                                 insert(assume_sorted_t, InputIterator first, InputIterator last);
+
+        void                                 erase(iterator position);
+        size_type                            erase(const key_type &k);
+        void                                 erase(iterator first, iterator last);
+
+        void                                 swap(flat_map &x);
+        void                                 clear();
+
+
+        key_compare                          key_comp() const;
+        value_compare                        value_comp() const;
+
+        iterator                             find(const key_type &k);
+        const_iterator                       find(const key_type &k) const;
+
+        size_type                            count(const key_type &k) const;
+
+        iterator                             lower_bound(const key_type &k);
+        const_iterator                       lower_bound(const key_type &k) const;
+
+        iterator                             upper_bound(const key_type &k);
+        const_iterator                       upper_bound(const key_type &k) const;
+
+        pair<iterator, iterator>             equal_range(const key_type &k);
+        pair<const_iterator, const_iterator> equal_range(const key_type &k) const;
+
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                             find(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+                                             find(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+                                             count(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                             lower_bound(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+                                             lower_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                             upper_bound(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+                                             upper_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<iterator, iterator> >::type
+                                             equal_range(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<const_iterator, const_iterator> >::type
+                                             equal_range(const K &k) const;
+
+        allocator_type                       get_allocator() const;
+
+
+        bool                                 verify() const;
+    };
+
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key, T, Compare, Alloc>::value_compare::value_compare(Compare c): _comp(c) {}
+
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    bool flat_map<Key, T, Compare, Alloc>::value_compare::operator()(const value_type &x, const value_type &y) const {
+        return (_comp(x.first, y.first));
+    }
+
+    /**
+     * Empty container constructor (default constructor)
+     * @param comp  Binary predicate that, taking two element keys as argument, returns true if the first argument goes before
+     *              the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key, T, Compare, Alloc>::flat_map(const key_compare &comp, const allocator_type &alloc):
+                                        _tree(comp, alloc) {}
+
+    /**
+     * Range constructor
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     * @param comp  Binary predicate that, taking two element keys as argument, returns true if the first argument goes before
+     *              the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    flat_map<Key, T, Compare, Alloc>::flat_map(InputIterator first, InputIterator last,
+                                     const key_compare &comp, const allocator_type &alloc,
+                                     typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*):
+                                     _tree(comp, alloc) {
+        insert(first, last);
+    }
+
+    /**
+     * Sorted range constructor, appends the elements to the vector without comparing them
+     * @param first Input iterator to the initial position in a range sorted by key and holding no equivalent keys
+     * @param last  Input iterator to the final position in a range
+     * @param comp  Binary predicate that, taking two element keys as argument, returns true if the first argument goes before
+     *              the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    flat_map<Key, T, Compare, Alloc>::flat_map(assume_sorted_t, InputIterator first, InputIterator last,
+                                     const key_compare &comp, const allocator_type &alloc):
+                                     _tree(comp, alloc) {
+        _tree.insert(assume_sorted, first, last);
+    }
+
+    /**
+     * Copy constructor
+     * @param src Another flat_map object of the same type
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key, T, Compare, Alloc>::flat_map(const flat_map &src): _tree(src._tree) {}
+
+# if FT_CXX11
+    /**
+     * Move constructor, src is left empty
+     * @param src Another flat_map object of the same type
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key, T, Compare, Alloc>::flat_map(flat_map &&src): _tree(std::move(src._tree)) {}
+# endif
+
+    /**
+     * Destructor
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key, T, Compare, Alloc>::~flat_map() {}
+
+    /**
+     * Copy container content
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key, T, Compare, Alloc> &flat_map<Key, T, Compare, Alloc>::operator=(const flat_map &other) {
+        if (this == &other)
+            return (*this);
+        _tree = other._tree;
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    flat_map<Key, T, Compare, Alloc> &flat_map<Key, T, Compare, Alloc>::operator=(flat_map &&other) {
+        _tree = std::move(other._tree);
+        return (*this);
+    }
+# endif
+
+    /**
+     * Return iterator to beginning
+     * @return An iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::iterator flat_map<Key, T, Compare, Alloc>::begin() {
+        return (_tree.begin());
+    }
+
+    /**
+     * Return const iterator to beginning
+     * @return A const iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::const_iterator flat_map<Key, T, Compare, Alloc>::begin() const {
+        return (_tree.begin());
+    }
+
+    /**
+     * Return iterator to end
+     * @return An iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::iterator flat_map<Key, T, Compare, Alloc>::end() {
+        return (_tree.end());
+    }
+
+    /**
+     * Return const iterator to end
+     * @return A const iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::const_iterator flat_map<Key, T, Compare, Alloc>::end() const {
+        return (_tree.end());
+    }
+
+    /**
+     * Return reverse iterator to reverse beginning
+     * @return A reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::reverse_iterator flat_map<Key, T, Compare, Alloc>::rbegin() {
+        return (_tree.rbegin());
+    }
+
+    /**
+     * Return const reverse iterator to reverse beginning
+     * @return A const reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::const_reverse_iterator flat_map<Key, T, Compare, Alloc>::rbegin() const {
+        return (_tree.rbegin());
+    }
+
+    /**
+     * Return reverse iterator to reverse end
+     * @return A reverse iterator to the reverse end of the sequence container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::reverse_iterator flat_map<Key, T, Compare, Alloc>::rend() {
+        return (_tree.rend());
+    }
+
+    /**
+     * Return const reverse iterator to reverse end
+     * @return A const reverse iterator to the reverse end of the sequence container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::const_reverse_iterator flat_map<Key, T, Compare, Alloc>::rend() const {
+        return (_tree.rend());
+    }
+
+    /**
+     * Test whether container is empty
+     * @return true if the container size is 0, false otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    bool flat_map<Key, T, Compare, Alloc>::empty() const {
+        return (_tree.empty());
+    }
+
+    /**
+     * Return container size
+     * @return The number of elements in the container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::size_type flat_map<Key, T, Compare, Alloc>::size() const {
+        return (_tree.size());
+    }
+
+    /**
+     * Return maximum size
+     * @return The maximum number of elements a flat_map container can hold as content
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::size_type flat_map<Key, T, Compare, Alloc>::max_size() const {
+        return (_tree.max_size());
+    }
+
+    /**
+     * Return size of allocated storage capacity (extension)
+     * @return The number of elements the flat_map can hold before it reallocates
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::size_type flat_map<Key, T, Compare, Alloc>::capacity() const {
+        return (_tree.capacity());
+    }
+
+    /**
+     * Request a change in capacity (extension), reserving before a series of single inserts avoids the reallocations
+     * @param n Minimum capacity for the flat_map
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    void flat_map<Key, T, Compare, Alloc>::reserve(size_type n) {
+        _tree.reserve(n);
+    }
+
+    /**
+     * Access element, an existing element is found without building a value.
+     * A missing one is inserted with its lower bound as the hint
+     * @param k Key value of the element whose mapped value is accessed
+     * @return A reference to the mapped value of the element with a key value equivalent to k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::mapped_type &flat_map<Key, T, Compare, Alloc>::operator[](const key_type &k) {
+        iterator it = lower_bound(k);
+
+        if (it == end() || key_comp()(k, it->first))
+            it = _tree.insert(it, value_type(k, mapped_type()));
+        return (it->second);
+    }
+
+    /**
+     * Insert elements
+     * @param val Value to be copied to the inserted element
+     * @return A pair, with its member pair::first set to an iterator pointing to either the newly inserted element or
+     *         to the element with an equivalent key in the flat_map. The pair::second element in the pair is set to true
+     *         if a new element was inserted or false if an equivalent key already existed
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    pair<typename flat_map<Key, T, Compare, Alloc>::iterator, bool> flat_map<Key, T, Compare, Alloc>::insert(const value_type &val) {
+        return (_tree.insert(val));
+    }
+
+    /**
+     * Insert elements
+     * @param position Hint for the position where the element can be inserted
+     * @param val      Value to be copied to the inserted element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent key in the flat_map
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::iterator flat_map<Key, T, Compare, Alloc>::insert(flat_map::iterator position, const flat_map::value_type &val) {
+        return (_tree.insert(position, val));
+    }
+
+# if FT_CXX11
+    /**
+     * Insert elements
+     * @param val Value to be moved to the inserted element
+     * @return A pair, with its member pair::first set to an iterator pointing to either the newly inserted element or
+     *         to the element with an equivalent key in the flat_map. The pair::second element in the pair is set to true
+     *         if a new element was inserted or false if an equivalent key already existed
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    pair<typename flat_map<Key, T, Compare, Alloc>::iterator, bool> flat_map<Key, T, Compare, Alloc>::insert(value_type &&val) {
+        return (_tree.insert(std::move(val)));
+    }
+
+    /**
+     * Insert elements
+     * @param position Hint for the position where the element can be inserted
+     * @param val      Value to be moved to the inserted element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent key in the flat_map
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::iterator flat_map<Key, T, Compare, Alloc>::insert(iterator position, value_type &&val) {
+        return (_tree.insert(position, std::move(val)));
+    }
+
+    /**
+     * Construct and insert element
+     * @param args Arguments forwarded to the constructor of the new element
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename... Args>
+    pair<typename flat_map<Key, T, Compare, Alloc>::iterator, bool> flat_map<Key, T, Compare, Alloc>::emplace(Args&&... args) {
+        return (_tree.emplace(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Construct and insert element
+     * @param position Hint for the position where the element can be inserted
+     * @param args     Arguments forwarded to the constructor of the new element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent key in the flat_map
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename... Args>
+    typename flat_map<Key, T, Compare, Alloc>::iterator flat_map<Key, T, Compare, Alloc>::emplace_hint(iterator position, Args&&... args) {
+        return (_tree.emplace_hint(position, std::forward<Args>(args)...));
+    }
+
+    /**
+     * Insert element if the key is not present, nothing is constructed or moved from otherwise
+     * @param k    Key of the element
+     * @param args Arguments forwarded to the constructor of the mapped value
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename... Args>
+    pair<typename flat_map<Key, T, Compare, Alloc>::iterator, bool> flat_map<Key, T, Compare, Alloc>::try_emplace(const key_type &k, Args&&... args) {
+        iterator it = lower_bound(k);
+
+        if (it != end() && !key_comp()(k, it->first))
+            return (ft::make_pair(it, false));
+        return (ft::make_pair(_tree.emplace_hint(it, k, mapped_type(std::forward<Args>(args)...)), true));
+    }
+
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename... Args>
+    pair<typename flat_map<Key, T, Compare, Alloc>::iterator, bool> flat_map<Key, T, Compare, Alloc>::try_emplace(key_type &&k, Args&&... args) {
+        iterator it = lower_bound(k);
+
+        if (it != end() && !key_comp()(k, it->first))
+            return (ft::make_pair(it, false));
+        return (ft::make_pair(_tree.emplace_hint(it, std::move(k), mapped_type(std::forward<Args>(args)...)), true));
+    }
+# endif
+
+    /**
+     * Insert elements
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    void flat_map<Key, T, Compare, Alloc>::insert(InputIterator first, InputIterator last,
+                                             typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*) {
+        _tree.insert(first, last);
+    }
+
+    /**
+     * Insert elements from a range sorted by key that holds no equivalent keys,
+     * an empty flat_map is filled from it without comparing the elements
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    void flat_map<Key, T, Compare, Alloc>::insert(assume_sorted_t, InputIterator first, InputIterator last) {
+        _tree.insert(assume_sorted, first, last);
+    }
+
+    /**
+     * Erase elements
+     * @param position Iterator pointing to a single element to be removed from the flat_map
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    void flat_map<Key, T, Compare, Alloc>::erase(iterator position) {
+        _tree.erase(position);
+    }
+
+    /**
+     * Erase elements
+     * @param k Key of the element to be removed from the flat_map
+     * @return Number of elements erased
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::size_type flat_map<Key, T, Compare, Alloc>::erase(const key_type &k) {
+        return (_tree.erase(k));
+    }
+
+    /**
+     * Erase elements
+     * @param first Iterator to the initial position in a range
+     * @param last  Iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    void flat_map<Key, T, Compare, Alloc>::erase(flat_map::iterator first, flat_map::iterator last) {
+        _tree.erase(first, last);
+    }
+
+    /**
+     * Swap content
+     * @param x Another flat_map container of the same type as this
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    void flat_map<Key, T, Compare, Alloc>::swap(flat_map &x) {
+        _tree.swap(x._tree);
+    }
+
+    /**
+     * Clear content
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    void flat_map<Key, T, Compare, Alloc>::clear() {
+        _tree.clear();
+    }
+
+    /**
+     * Return key comparison object
+     * @return The comparison object
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::key_compare flat_map<Key, T, Compare, Alloc>::key_comp() const {
+        return (_tree.key_comp());
+    }
+
+    /**
+     * Return value comparison object
+     * @return The comparison object for element values
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::value_compare flat_map<Key, T, Compare, Alloc>::value_comp() const {
+        return (value_compare(_tree.key_comp()));
+    }
+
+    /**
+     * Get iterator to element
+     * @param k Key to be searched for
+     * @return An iterator to the element, if an element with specified key is found, or flat_map::end otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::iterator flat_map<Key, T, Compare, Alloc>::find(const key_type &k) {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Get const iterator to element
+     * @param k Key to be searched for
+     * @return A const iterator to the element, if an element with specified key is found, or flat_map::end otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::const_iterator flat_map<Key, T, Compare, Alloc>::find(const key_type &k) const {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Count elements with a specific key
+     * @param k Key to search for
+     * @return 1 if the container contains an element whose key is equivalent to k, or zero otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::size_type flat_map<Key, T, Compare, Alloc>::count(const key_type &k) const {
+        return (_tree.count(k));
+    }
+
+    /**
+     * Return iterator to lower bound
+     * @param k Key to search for
+     * @return An iterator to the the first element in the container whose key is not considered to go before k,
+     *         or flat_map::end if all keys are considered to go before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::iterator flat_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return const iterator to lower bound
+     * @param k Key to search for
+     * @return A const iterator to the the first element in the container whose key is not considered to go before k,
+     *         or flat_map::end if all keys are considered to go before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::const_iterator flat_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) const {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return iterator to upper bound
+     * @param k Key to search for
+     * @return An iterator to the the first element in the container whose key is considered to go after k,
+     *         or flat_map::end if no keys are considered to go after k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::iterator flat_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Return const iterator to upper bound
+     * @param k Key to search for
+     * @return An iterator to the the first element in the container whose key is considered to go after k,
+     *         or flat_map::end if no keys are considered to go after k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::const_iterator flat_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) const {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Get range of equal elements
+     * @param k Key to search for
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    pair<typename flat_map<Key, T, Compare, Alloc>::iterator, typename flat_map<Key, T, Compare, Alloc>::iterator> flat_map<Key, T, Compare, Alloc>::equal_range(const key_type &k) {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get const range of equal elements
+     * @param k Key to search for
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    pair<typename flat_map<Key, T, Compare, Alloc>::const_iterator, typename flat_map<Key, T, Compare, Alloc>::const_iterator> flat_map<Key, T, Compare, Alloc>::equal_range(const key_type &k) const {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get iterator to element, with a transparent comparison object
+     * @param k Value comparable with the keys, looked up without being converted to key_type
+     * @return An iterator to the element, if an element with a key equivalent to k is found, or flat_map::end otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_map<Key, T, Compare, Alloc>::iterator>::type
+    flat_map<Key, T, Compare, Alloc>::find(const K &k) {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Get const iterator to element, with a transparent comparison object
+     * @param k Value comparable with the keys, looked up without being converted to key_type
+     * @return A const iterator to the element, if an element with a key equivalent to k is found, or flat_map::end otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_map<Key, T, Compare, Alloc>::const_iterator>::type
+    flat_map<Key, T, Compare, Alloc>::find(const K &k) const {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Count elements with a key equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return 1 if the container contains an element whose key is equivalent to k, or zero otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_map<Key, T, Compare, Alloc>::size_type>::type
+    flat_map<Key, T, Compare, Alloc>::count(const K &k) const {
+        return (_tree.count(k));
+    }
+
+    /**
+     * Return iterator to lower bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return An iterator to the the first element in the container whose key is not considered to go before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_map<Key, T, Compare, Alloc>::iterator>::type
+    flat_map<Key, T, Compare, Alloc>::lower_bound(const K &k) {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return const iterator to lower bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return A const iterator to the the first element in the container whose key is not considered to go before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_map<Key, T, Compare, Alloc>::const_iterator>::type
+    flat_map<Key, T, Compare, Alloc>::lower_bound(const K &k) const {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return iterator to upper bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return An iterator to the the first element in the container whose key is considered to go after k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_map<Key, T, Compare, Alloc>::iterator>::type
+    flat_map<Key, T, Compare, Alloc>::upper_bound(const K &k) {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Return const iterator to upper bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return A const iterator to the the first element in the container whose key is considered to go after k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_map<Key, T, Compare, Alloc>::const_iterator>::type
+    flat_map<Key, T, Compare, Alloc>::upper_bound(const K &k) const {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Get range of elements with a key equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<typename flat_map<Key, T, Compare, Alloc>::iterator, typename flat_map<Key, T, Compare, Alloc>::iterator> >::type
+    flat_map<Key, T, Compare, Alloc>::equal_range(const K &k) {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get const range of elements with a key equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<typename flat_map<Key, T, Compare, Alloc>::const_iterator, typename flat_map<Key, T, Compare, Alloc>::const_iterator> >::type
+    flat_map<Key, T, Compare, Alloc>::equal_range(const K &k) const {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get allocator
+     * @return The allocator
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename flat_map<Key, T, Compare, Alloc>::allocator_type flat_map<Key, T, Compare, Alloc>::get_allocator() const {
+        return (_tree.get_allocator());
+    }
+
+    /**
+     * Check that the keys are sorted and unique (extension), takes linear time
+     * @return true if the container is valid
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    bool flat_map<Key, T, Compare, Alloc>::verify() const {
+        return (_tree.verify());
+    }
+
+}
+
+#endif //FT_CONTAINERS_FLAT_MAP_HPP
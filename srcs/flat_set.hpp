@@ -0,0 +1,648 @@
+#ifndef FT_CONTAINERS_FLAT_SET_HPP
+# define FT_CONTAINERS_FLAT_SET_HPP
+
+# include <memory>
+# include "algorithm.hpp"
+# include "functional.hpp"
+# include "flat_tree.hpp"
+# include "iterator.hpp"
+
+namespace ft {
+
+    /**
+     * Set container with the interface of set, stored sorted in one ft::vector, see FlatTree.
+     * Inserting or erasing an element shifts the elements after it, which invalidates every iterator and reference
+     * @tparam T       Type of the elements
+     * @tparam Compare A binary predicate that takes two arguments of the same type as the elements and returns a bool
+     * @tparam Alloc   Type of the allocator object used to define the storage allocation model
+     */
+    template< typename T, typename Compare = less<T>, typename Alloc = std::allocator<T> >
+    class flat_set {
+    public:
+        typedef T                                                   key_type;
+        typedef T                                                   value_type;
+        typedef Compare                                             key_compare;
+        typedef Compare                                             value_compare;
+        typedef Alloc                                               allocator_type;
+        typedef typename allocator_type::reference                  reference;
+        typedef typename allocator_type::const_reference            const_reference;
+        typedef typename allocator_type::pointer                    pointer;
+        typedef typename allocator_type::const_pointer              const_pointer;
+        typedef typename FlatTree<T, T, ft::identity<T>, Compare, Alloc>::iterator        iterator;
+        typedef typename FlatTree<T, T, ft::identity<T>, Compare, Alloc>::const_iterator  const_iterator;
+        typedef ft::reverse_iterator<iterator>                      reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                const_reverse_iterator;
+        typedef typename iterator_traits<iterator>::difference_type difference_type;
+        typedef size_t                                              size_type;
+
+    private:
+        FlatTree<key_type, value_type, ft::identity<value_type>, key_compare, allocator_type> _tree;
+
+        static iterator          _mutable(const_iterator it);
+
+    public:
+        explicit flat_set(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        template<typename InputIterator>
+        flat_set(InputIterator first, InputIterator last,
+            const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type(),
+            typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        flat_set(assume_sorted_t, InputIterator first, InputIterator last,
+            const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        flat_set(const flat_set &src);
+# if FT_CXX11
+        flat_set(flat_set &&src);
+# endif
+
+        ~flat_set();
+
+        flat_set                      &operator=(const flat_set &other);
+# if FT_CXX11
+        flat_set                      &operator=(flat_set &&other);
+# endif
+
+        iterator                 begin();
+        const_iterator           begin() const;
+
+        iterator                 end();
+        const_iterator           end() const;
+
+        reverse_iterator         rbegin();
+        const_reverse_iterator   rbegin() const;
+
+        reverse_iterator         rend();
+        const_reverse_iterator   rend() const;
+
+        bool                     empty() const;
+        size_type                size() const;
+        size_type                max_size() const;
+        size_type                capacity() const;
+        void                     reserve(size_type n);
+
+        pair<iterator, bool>     insert(const value_type &val);
+        iterator                 insert(iterator position, const value_type &val);
+# if FT_CXX11
+        pair<iterator, bool>     insert(value_type &&val);
+        iterator                 insert(iterator position, value_type &&val);
+        template<typename... Args>
+        pair<iterator, bool>     emplace(Args&&... args);
+        template<typename... Args>
+        iterator                 emplace_hint(iterator position, Args&&... args);
+# endif
+        template<typename InputIterator>
+        void                     insert(InputIterator first, InputIterator last,
+                                        typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        void                     insert(assume_sorted_t, InputIterator first, InputIterator last);
+
+        void                     erase(iterator position);
+        size_type                erase(const value_type &val);
+        void                     erase(iterator first, iterator last);
+
+        void                     swap(flat_set &x);
+        void                     clear();
+
+
+        key_compare              key_comp() const;
+        value_compare            value_comp() const;
+
+        iterator                 find(const value_type &val) const;
+        size_type                count(const value_type &val) const;
+
+        iterator                 lower_bound(const value_type &val) const;
+        iterator                 upper_bound(const value_type &val) const;
+        pair<iterator, iterator> equal_range(const value_type &val) const;
+
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                 find(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+                                 count(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                 lower_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                 upper_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<iterator, iterator> >::type
+                                 equal_range(const K &k) const;
+
+        allocator_type           get_allocator() const;
+
+
+        bool                     verify() const;
+    };
+
+    /**
+     * Iterator from a const iterator of the vector, the const lookups of a set return iterator
+     * @param it Const iterator
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::iterator flat_set<T, Compare, Alloc>::_mutable(const_iterator it) {
+        return (iterator(const_cast<value_type*>(it.base())));
+    }
+
+    /**
+     * Empty container constructor (default constructor)
+     * @param comp  Binary predicate that, taking two values of the same type of those contained in the flat_set,
+     *              returns true if the first argument goes before the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename T, typename Compare, typename Alloc>
+    flat_set<T, Compare, Alloc>::flat_set(const key_compare &comp, const allocator_type &alloc):
+    _tree(comp, alloc) {}
+
+    /**
+     * Range constructor
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     * @param comp  Binary predicate that, taking two values of the same type of those contained in the flat_set,
+     *              returns true if the first argument goes before the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    flat_set<T, Compare, Alloc>::flat_set(InputIterator first, InputIterator last,
+                                const key_compare &comp, const allocator_type &alloc,
+                                typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*):
+                                _tree(comp, alloc) {
+        _tree.insert(first, last);
+    }
+
+    /**
+     * Sorted range constructor, appends the elements to the vector without comparing them
+     * @param first Input iterator to the initial position in a range sorted by key and holding no equivalent keys
+     * @param last  Input iterator to the final position in a range
+     * @param comp  Binary predicate that, taking two values of the same type of those contained in the flat_set,
+     *              returns true if the first argument goes before the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    flat_set<T, Compare, Alloc>::flat_set(assume_sorted_t, InputIterator first, InputIterator last,
+                                const key_compare &comp, const allocator_type &alloc):
+                                _tree(comp, alloc) {
+        _tree.insert(assume_sorted, first, last);
+    }
+
+    /**
+     * Copy constructor
+     * @param src Another flat_set object of the same type
+     */
+    template<typename T, typename Compare, typename Alloc>
+    flat_set<T, Compare, Alloc>::flat_set(const flat_set &src): _tree(src._tree) {}
+
+# if FT_CXX11
+    /**
+     * Move constructor, src is left empty
+     * @param src Another flat_set object of the same type
+     */
+    template<typename T, typename Compare, typename Alloc>
+    flat_set<T, Compare, Alloc>::flat_set(flat_set &&src): _tree(std::move(src._tree)) {}
+# endif
+
+    /**
+     * Destructor
+     */
+    template<typename T, typename Compare, typename Alloc>
+    flat_set<T, Compare, Alloc>::~flat_set() {}
+
+    /**
+     * Copy container content
+     */
+    template<typename T, typename Compare, typename Alloc>
+    flat_set<T, Compare, Alloc> &flat_set<T, Compare, Alloc>::operator=(const flat_set &other) {
+        if (this == &other)
+            return (*this);
+        _tree = other._tree;
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     */
+    template<typename T, typename Compare, typename Alloc>
+    flat_set<T, Compare, Alloc> &flat_set<T, Compare, Alloc>::operator=(flat_set &&other) {
+        _tree = std::move(other._tree);
+        return (*this);
+    }
+# endif
+
+    /**
+     * Return iterator to beginning
+     * @return An iterator to the first element in the container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::iterator flat_set<T, Compare, Alloc>::begin() {
+        return (_tree.begin());
+    }
+
+    /**
+     * Return const iterator to beginning
+     * @return A const iterator to the first element in the container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::const_iterator flat_set<T, Compare, Alloc>::begin() const {
+        return (_tree.begin());
+    }
+
+    /**
+     * Return iterator to end
+     * @return An iterator to the past-the-end element in the container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::iterator flat_set<T, Compare, Alloc>::end() {
+        return (_tree.end());
+    }
+
+    /**
+     * Return const iterator to end
+     * @return A const iterator to the past-the-end element in the container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::const_iterator flat_set<T, Compare, Alloc>::end() const {
+        return (_tree.end());
+    }
+
+    /**
+     * Return reverse iterator to reverse beginning
+     * @return A reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::reverse_iterator flat_set<T, Compare, Alloc>::rbegin() {
+        return (_tree.rbegin());
+    }
+
+    /**
+     * Return const reverse iterator to reverse beginning
+     * @return A const reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::const_reverse_iterator flat_set<T, Compare, Alloc>::rbegin() const {
+        return (_tree.rbegin());
+    }
+
+    /**
+     * Return reverse iterator to reverse end
+     * @return A reverse iterator to the reverse end of the sequence container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::reverse_iterator flat_set<T, Compare, Alloc>::rend() {
+        return (_tree.rend());
+    }
+
+    /**
+     * Return const reverse iterator to reverse end
+     * @return A const reverse iterator to the reverse end of the sequence container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::const_reverse_iterator flat_set<T, Compare, Alloc>::rend() const {
+        return (_tree.rend());
+    }
+
+    /**
+     * Test whether container is empty
+     * @return true if the container size is 0, false otherwise
+     */
+    template<typename T, typename Compare, typename Alloc>
+    bool flat_set<T, Compare, Alloc>::empty() const {
+        return (_tree.empty());
+    }
+
+    /**
+     * Return container size
+     * @return The number of elements in the container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::size_type flat_set<T, Compare, Alloc>::size() const {
+        return (_tree.size());
+    }
+
+    /**
+     * Return maximum size
+     * @return The maximum number of elements a flat_set container can hold as content
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::size_type flat_set<T, Compare, Alloc>::max_size() const {
+        return (_tree.max_size());
+    }
+
+    /**
+     * Return size of allocated storage capacity (extension)
+     * @return The number of elements the flat_set can hold before it reallocates
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::size_type flat_set<T, Compare, Alloc>::capacity() const {
+        return (_tree.capacity());
+    }
+
+    /**
+     * Request a change in capacity (extension), reserving before a series of single inserts avoids the reallocations
+     * @param n Minimum capacity for the flat_set
+     */
+    template<typename T, typename Compare, typename Alloc>
+    void flat_set<T, Compare, Alloc>::reserve(size_type n) {
+        _tree.reserve(n);
+    }
+
+    /**
+     * Insert elements
+     * @param val Value to be copied to the inserted element
+     * @return A pair, with its member pair::first flat_set to an iterator pointing to either the newly inserted element or
+     *         to the element with an equivalent value in the flat_set. The pair::second element in the pair is flat_set to true
+     *         if a new element was inserted or false if an equivalent key already existed
+     */
+    template<typename T, typename Compare, typename Alloc>
+    pair<typename flat_set<T, Compare, Alloc>::iterator, bool> flat_set<T, Compare, Alloc>::insert(const value_type &val) {
+        return (_tree.insert(val));
+    }
+
+    /**
+     * Insert elements
+     * @param position Hint for the position where the element can be inserted
+     * @param val      Value to be copied to the inserted element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent value in the flat_set
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::iterator flat_set<T, Compare, Alloc>::insert(flat_set::iterator position, const value_type &val) {
+        return (_tree.insert(position, val));
+    }
+
+# if FT_CXX11
+    /**
+     * Insert element
+     * @param val Value to be moved to the inserted element
+     * @return A pair, with its member pair::first flat_set to an iterator pointing to either the newly inserted element or
+     *         to the element with an equivalent value in the flat_set. The pair::second element in the pair is flat_set to true
+     *         if a new element was inserted or false if an equivalent value already existed
+     */
+    template<typename T, typename Compare, typename Alloc>
+    pair<typename flat_set<T, Compare, Alloc>::iterator, bool> flat_set<T, Compare, Alloc>::insert(value_type &&val) {
+        return (_tree.insert(std::move(val)));
+    }
+
+    /**
+     * Insert element
+     * @param position Hint for the position where the element can be inserted
+     * @param val      Value to be moved to the inserted element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent value in the flat_set
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::iterator flat_set<T, Compare, Alloc>::insert(iterator position, value_type &&val) {
+        return (_tree.insert(position, std::move(val)));
+    }
+
+    /**
+     * Construct and insert element
+     * @param args Arguments forwarded to the constructor of the new element
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename... Args>
+    pair<typename flat_set<T, Compare, Alloc>::iterator, bool> flat_set<T, Compare, Alloc>::emplace(Args&&... args) {
+        return (_tree.emplace(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Construct and insert element
+     * @param position Hint for the position where the element can be inserted
+     * @param args     Arguments forwarded to the constructor of the new element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent value in the flat_set
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename... Args>
+    typename flat_set<T, Compare, Alloc>::iterator flat_set<T, Compare, Alloc>::emplace_hint(iterator position, Args&&... args) {
+        return (_tree.emplace_hint(position, std::forward<Args>(args)...));
+    }
+# endif
+
+    /**
+     * Insert elements
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    void flat_set<T, Compare, Alloc>::insert(InputIterator first, InputIterator last,
+                                        typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*) {
+        _tree.insert(first, last);
+    }
+
+    /**
+     * Insert elements from a range sorted by key that holds no equivalent keys,
+     * an empty flat_set is filled from it without comparing the elements
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    void flat_set<T, Compare, Alloc>::insert(assume_sorted_t, InputIterator first, InputIterator last) {
+        _tree.insert(assume_sorted, first, last);
+    }
+
+    /**
+     * Erase elements
+     * @param position Iterator pointing to a single element to be removed from the flat_set
+     */
+    template<typename T, typename Compare, typename Alloc>
+    void flat_set<T, Compare, Alloc>::erase(iterator position) {
+        _tree.erase(position);
+    }
+
+    /**
+     * Erase elements
+     * @param val Value of the element to be removed from the flat_set
+     * @return Number of elements erased
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::size_type flat_set<T, Compare, Alloc>::erase(const value_type &val) {
+        return (_tree.erase(val));
+    }
+
+    /**
+     * Erase elements
+     * @param first Iterator to the initial position in a range
+     * @param last  Iterator to the final position in a range
+     */
+    template<typename T, typename Compare, typename Alloc>
+    void flat_set<T, Compare, Alloc>::erase(flat_set::iterator first, flat_set::iterator last) {
+        _tree.erase(first, last);
+    }
+
+    /**
+    * Swap content
+    * @param x Another flat_set container of the same type as this
+    */
+    template<typename T, typename Compare, typename Alloc>
+    void flat_set<T, Compare, Alloc>::swap(flat_set &x) {
+        _tree.swap(x._tree);
+    }
+
+    /**
+    * Clear content
+    */
+    template<typename T, typename Compare, typename Alloc>
+    void flat_set<T, Compare, Alloc>::clear() {
+        _tree.clear();
+    }
+
+    /**
+     * Return key comparison object
+     * @return The comparison object
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::key_compare flat_set<T, Compare, Alloc>::key_comp() const {
+        return (_tree.key_comp());
+    }
+
+    /**
+     * Return value comparison object
+     * @return The comparison object for element values
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::value_compare flat_set<T, Compare, Alloc>::value_comp() const {
+        return (_tree.key_comp());
+    }
+
+    /**
+     * Get iterator to element
+     * @param val Value to be searched for
+     * @return An iterator to the element, if an element with specified value is found, or flat_set::end otherwise
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::iterator flat_set<T, Compare, Alloc>::find(const value_type &val) const {
+        return (_mutable(_tree.find(val)));
+    }
+
+    /**
+    * Count elements with a specific value
+    * @param val Value to search for
+    * @return 1 if the container contains an element whose value is equivalent to val, or zero otherwise
+    */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::size_type flat_set<T, Compare, Alloc>::count(const value_type &val) const {
+        return (_tree.count(val));
+    }
+
+    /**
+     * Return iterator to lower bound
+     * @param val Value to compare
+     * @return An iterator to the the first element in the container which is not considered to go before val,
+     *         or flat_set::end if all elements are considered to go before val
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::iterator flat_set<T, Compare, Alloc>::lower_bound(const value_type &val) const {
+        return (_mutable(_tree.lower_bound(val)));
+    }
+
+    /**
+     * Return iterator to upper bound
+     * @param val Value to compare
+     * @return An iterator to the the first element in the container which is considered to go after val,
+     *         or flat_set::end if no elements are considered to go after val
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::iterator flat_set<T, Compare, Alloc>::upper_bound(const value_type &val) const {
+        return (_mutable(_tree.upper_bound(val)));
+    }
+
+    /**
+     * Get range of equal elements
+     * @param val Value to search for
+     * @return pair, whose member pair::first is the lower bound of the range (the same as lower_bound),
+     *         and pair::second is the upper bound (the same as upper_bound)
+     */
+    template<typename T, typename Compare, typename Alloc>
+    pair <typename flat_set<T, Compare, Alloc>::iterator, typename flat_set<T, Compare, Alloc>::iterator>
+    flat_set<T, Compare, Alloc>::equal_range(const value_type &val) const {
+        pair<const_iterator, const_iterator> range = _tree.equal_range(val);
+
+        return (ft::make_pair(_mutable(range.first), _mutable(range.second)));
+    }
+
+    /**
+     * Get iterator to element, with a transparent comparison object
+     * @param k Value comparable with the elements, looked up without being converted to value_type
+     * @return An iterator to the element, if an element equivalent to k is found, or flat_set::end otherwise
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_set<T, Compare, Alloc>::iterator>::type
+    flat_set<T, Compare, Alloc>::find(const K &k) const {
+        return (_mutable(_tree.find(k)));
+    }
+
+    /**
+     * Count elements equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return 1 if the container contains an element equivalent to k, or zero otherwise
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_set<T, Compare, Alloc>::size_type>::type
+    flat_set<T, Compare, Alloc>::count(const K &k) const {
+        return (_tree.count(k));
+    }
+
+    /**
+     * Return iterator to lower bound, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return An iterator to the the first element in the container which is not considered to go before k
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_set<T, Compare, Alloc>::iterator>::type
+    flat_set<T, Compare, Alloc>::lower_bound(const K &k) const {
+        return (_mutable(_tree.lower_bound(k)));
+    }
+
+    /**
+     * Return iterator to upper bound, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return An iterator to the the first element in the container which is considered to go after k
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename flat_set<T, Compare, Alloc>::iterator>::type
+    flat_set<T, Compare, Alloc>::upper_bound(const K &k) const {
+        return (_mutable(_tree.upper_bound(k)));
+    }
+
+    /**
+     * Get range of elements equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<typename flat_set<T, Compare, Alloc>::iterator, typename flat_set<T, Compare, Alloc>::iterator> >::type
+    flat_set<T, Compare, Alloc>::equal_range(const K &k) const {
+        pair<const_iterator, const_iterator> range = _tree.equal_range(k);
+
+        return (ft::make_pair(_mutable(range.first), _mutable(range.second)));
+    }
+
+    /**
+     * Get allocator
+     * @return The allocator
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename flat_set<T, Compare, Alloc>::allocator_type flat_set<T, Compare, Alloc>::get_allocator() const {
+        return (_tree.get_allocator());
+    }
+
+    /**
+     * Check that the keys are sorted and unique (extension), takes linear time
+     * @return true if the container is valid
+     */
+    template<typename T, typename Compare, typename Alloc>
+    bool flat_set<T, Compare, Alloc>::verify() const {
+        return (_tree.verify());
+    }
+
+}
+
+#endif //FT_CONTAINERS_FLAT_SET_HPP
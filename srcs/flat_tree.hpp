@@ -0,0 +1,795 @@
+#ifndef FT_CONTAINERS_FLAT_TREE_HPP
+# define FT_CONTAINERS_FLAT_TREE_HPP
+
+# include <memory>
+# include "algorithm.hpp"
+# include "vector.hpp"
+# include "utility.hpp"
+# include "functional.hpp"
+# include "type_traits.hpp"
+
+/**
+ * Runs of at most this many elements are sorted by insertion in the bulk insert merge sort
+ */
+# ifndef FT_FLAT_TREE_INSERTION_SORT
+#  define FT_FLAT_TREE_INSERTION_SORT 16
+# endif
+
+namespace ft {
+
+    /**
+     * Sorted vector with the interface of a search tree.
+     * The elements live in one ft::vector in key order, without duplicates: memory per element is the element,
+     * iteration walks contiguous memory and lookups are a binary search written to compile to conditional moves.
+     * Inserting or erasing one element shifts the elements after it, so the container suits tables built once,
+     * or in bulk, and then mostly read. A range insert appends the new elements, sorts them and merges them
+     * with the old ones in one pass; a range that comes sorted after the current last key is only appended.
+     * Insert and erase invalidate every iterator, pointer and reference
+     * @tparam Key        Type of the keys
+     * @tparam T          Type of the elements
+     * @tparam KeyOfValue Function object that returns the key of an element, ft::identity or ft::select1st
+     * @tparam Compare    A binary predicate that takes two element keys as arguments and returns a bool
+     * @tparam Alloc      Type of the allocator object used to define the storage allocation model
+     */
+    template< typename Key, typename T, typename KeyOfValue, typename Compare = ft::less<Key>, typename Alloc = std::allocator<T> >
+    class FlatTree {
+    public:
+        typedef Key                                             key_type;
+        typedef T                                               value_type;
+        typedef Alloc                                           allocator_type;
+        typedef Compare                                         key_compare;
+        typedef ft::vector<T, Alloc>                            container_type;
+        typedef typename container_type::iterator               iterator;
+        typedef typename container_type::const_iterator         const_iterator;
+        typedef typename container_type::reverse_iterator       reverse_iterator;
+        typedef typename container_type::const_reverse_iterator const_reverse_iterator;
+        typedef typename container_type::difference_type        difference_type;
+        typedef typename container_type::size_type              size_type;
+
+    private:
+        typedef ft::vector<value_type*, typename Alloc::template rebind<value_type*>::other> pointer_vector;
+
+        container_type _data;
+        key_compare    _comp;
+
+        static const key_type &_key(const value_type &val);
+        template<typename K>
+        size_type             _lower_index(const K &k) const;
+        template<typename K>
+        size_type             _upper_index(const K &k) const;
+        template<typename K>
+        size_type             _find_index(const K &k) const;
+        pair<size_type, bool> _insert_index(const key_type &k) const;
+        pair<size_type, bool> _insert_index(iterator position, const key_type &k) const;
+        void                  _sort(pointer_vector &v, pointer_vector &buf, size_type first, size_type last) const;
+        void                  _merge_tail(size_type n);
+
+    public:
+        FlatTree(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        FlatTree(const FlatTree &src);
+# if FT_CXX11
+        FlatTree(FlatTree &&src);
+# endif
+
+        ~FlatTree();
+
+        FlatTree                             &operator=(const FlatTree &other);
+# if FT_CXX11
+        FlatTree                             &operator=(FlatTree &&other);
+# endif
+
+        iterator                             begin();
+        const_iterator                       begin() const;
+
+        iterator                             end();
+        const_iterator                       end() const;
+
+        reverse_iterator                     rbegin();
+        const_reverse_iterator               rbegin() const;
+
+        reverse_iterator                     rend();
+        const_reverse_iterator               rend() const;
+
+        bool                                 empty() const;
+        size_type                            size() const;
+        size_type                            max_size() const;
+        size_type                            capacity() const;
+        void                                 reserve(size_type n);
+
+        pair<iterator, bool>                 insert(const value_type &val);
+        iterator                             insert(iterator position, const value_type &val);
+# if FT_CXX11
+        pair<iterator, bool>                 insert(value_type &&val);
+        iterator                             insert(iterator position, value_type &&val);
+        template<typename... Args>
+        pair<iterator, bool>                 emplace(Args&&... args);
+        template<typename... Args>
+        iterator                             emplace_hint(iterator position, Args&&... args);
+# endif
+        template<typename InputIterator>
+        void                                 insert(InputIterator first, InputIterator last,
+                                                    typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        void                                 insert(assume_sorted_t, InputIterator first, InputIterator last);
+
+        void                                 erase(iterator position);
+        size_type                            erase(const key_type &k);
+        void                                 erase(iterator first, iterator last);
+
+        void                                 swap(FlatTree &x);
+        void                                 clear();
+
+        key_compare                          key_comp() const;
+
+        template<typename K>
+        iterator                             find(const K &k);
+        template<typename K>
+        const_iterator                       find(const K &k) const;
+
+        template<typename K>
+        size_type                            count(const K &k) const;
+
+        template<typename K>
+        iterator                             lower_bound(const K &k);
+        template<typename K>
+        const_iterator                       lower_bound(const K &k) const;
+
+        template<typename K>
+        iterator                             upper_bound(const K &k);
+        template<typename K>
+        const_iterator                       upper_bound(const K &k) const;
+
+        template<typename K>
+        pair<iterator, iterator>             equal_range(const K &k);
+        template<typename K>
+        pair<const_iterator, const_iterator> equal_range(const K &k) const;
+
+        allocator_type                       get_allocator() const;
+
+        bool                                 verify() const;
+    };
+
+    /**
+     * Get key of an element
+     * @param val Element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    const typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::key_type &FlatTree<Key, T, KeyOfValue, Compare, Alloc>::_key(const value_type &val) {
+        return (KeyOfValue()(val));
+    }
+
+    /**
+     * Index of the first element whose key is not before k.
+     * Each step halves the range and moves its base with a conditional add instead of a branch,
+     * so the loop runs the same log2(n) steps for every key and the compiler emits a conditional move
+     * @param k Key to search for
+     * @return An index in [0, size]
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FlatTree<Key, T, KeyOfValue, Compare, Alloc>::_lower_index(const K &k) const {
+        size_type base = 0;
+        size_type n = _data.size();
+
+        if (!n)
+            return (0);
+        while (n > 1) {
+            size_type half = n / 2;
+
+            base += _comp(_key(_data[base + half]), k) ? half : 0;
+            n -= half;
+        }
+        return (base + _comp(_key(_data[base]), k));
+    }
+
+    /**
+     * Index of the first element whose key is after k, same search as _lower_index
+     * @param k Key to search for
+     * @return An index in [0, size]
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FlatTree<Key, T, KeyOfValue, Compare, Alloc>::_upper_index(const K &k) const {
+        size_type base = 0;
+        size_type n = _data.size();
+
+        if (!n)
+            return (0);
+        while (n > 1) {
+            size_type half = n / 2;
+
+            base += _comp(k, _key(_data[base + half])) ? 0 : half;
+            n -= half;
+        }
+        return (base + !_comp(k, _key(_data[base])));
+    }
+
+    /**
+     * Index of the element with a key equivalent to k
+     * @param k Key to search for
+     * @return The index of the element, or size if there is none
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FlatTree<Key, T, KeyOfValue, Compare, Alloc>::_find_index(const K &k) const {
+        size_type i = _lower_index(k);
+
+        if (i != _data.size() && _comp(k, _key(_data[i])))
+            return (_data.size());
+        return (i);
+    }
+
+    /**
+     * Find where an element with key k goes
+     * @param k Key of the element
+     * @return The index where the element goes and true, or the index of the element with an equivalent key and false
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    pair<typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size_type, bool> FlatTree<Key, T, KeyOfValue, Compare, Alloc>::_insert_index(const key_type &k) const {
+        size_type i = _lower_index(k);
+
+        return (ft::make_pair(i, i == _data.size() || _comp(k, _key(_data[i]))));
+    }
+
+    /**
+     * Find where an element with key k goes, without searching when it goes right before position
+     * @param position Hint for the position of the element
+     * @param k        Key of the element
+     * @return The index where the element goes and true, or the index of the element with an equivalent key and false
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    pair<typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size_type, bool> FlatTree<Key, T, KeyOfValue, Compare, Alloc>::_insert_index(iterator position, const key_type &k) const {
+        size_type i = const_iterator(position) - _data.begin();
+
+        if ((i == 0 || _comp(_key(_data[i - 1]), k)) && (i == _data.size() || _comp(k, _key(_data[i]))))
+            return (ft::make_pair(i, true));
+        return (_insert_index(k));
+    }
+
+    /**
+     * Stable merge sort of element pointers by key, with insertion sort on short runs
+     * @param v     Pointers to sort
+     * @param buf   Scratch space of the size of v
+     * @param first Index of the first pointer of the run
+     * @param last  Index past the last pointer of the run
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void FlatTree<Key, T, KeyOfValue, Compare, Alloc>::_sort(pointer_vector &v, pointer_vector &buf, size_type first, size_type last) const {
+        if (last - first <= FT_FLAT_TREE_INSERTION_SORT) {
+            for (size_type i = first + 1; i < last; i++) {
+                value_type *p = v[i];
+                size_type  j = i;
+
+                for (; j > first && _comp(_key(*p), _key(*v[j - 1])); j--)
+                    v[j] = v[j - 1];
+                v[j] = p;
+            }
+            return;
+        }
+
+        size_type mid = first + (last - first) / 2;
+
+        _sort(v, buf, first, mid);
+        _sort(v, buf, mid, last);
+        if (!_comp(_key(*v[mid]), _key(*v[mid - 1])))
+            return;
+
+        size_type i = first;
+        size_type j = mid;
+        size_type k = first;
+
+        while (i < mid && j < last)
+            buf[k++] = _comp(_key(*v[j]), _key(*v[i])) ? v[j++] : v[i++];
+        while (i < mid)
+            buf[k++] = v[i++];
+        while (j < last)
+            buf[k++] = v[j++];
+        for (k = first; k < last; k++)
+            v[k] = buf[k];
+    }
+
+    /**
+     * Restore the order after elements were appended from index n.
+     * The appended elements that already follow the sorted part in order join it without moving.
+     * The others are sorted through an array of pointers, which keeps the first of equivalent elements first,
+     * then the two sorted runs are merged into a new vector, dropping every element whose key is already present
+     * @param n Number of elements that were in order before the append
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void FlatTree<Key, T, KeyOfValue, Compare, Alloc>::_merge_tail(size_type n) {
+        size_type size = _data.size();
+
+        while (n < size && (n == 0 || _comp(_key(_data[n - 1]), _key(_data[n]))))
+            n++;
+        if (n == size)
+            return;
+
+        size_type      m = size - n;
+        pointer_vector tail(m, NULL, _data.get_allocator());
+        pointer_vector buf(m, NULL, _data.get_allocator());
+
+        for (size_type i = 0; i < m; i++)
+            tail[i] = &_data[n + i];
+        _sort(tail, buf, 0, m);
+
+        container_type merged(_data.get_allocator());
+        size_type      i = 0;
+        size_type      j = 0;
+
+        merged.reserve(size);
+        while (i < n || j < m) {
+            if (i < n && (j == m || !_comp(_key(*tail[j]), _key(_data[i])))) {
+                merged.push_back(FT_MOVE(_data[i]));
+                i++;
+            } else {
+                if (merged.empty() || _comp(_key(merged.back()), _key(*tail[j])))
+                    merged.push_back(FT_MOVE(*tail[j]));
+                j++;
+            }
+        }
+        _data.swap(merged);
+    }
+
+    /**
+     * Empty container constructor (default constructor)
+     * @param comp  Binary predicate that, taking two element keys as argument, returns true if the first argument goes before
+     *              the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FlatTree<Key, T, KeyOfValue, Compare, Alloc>::FlatTree(const key_compare &comp, const allocator_type &alloc): _data(alloc), _comp(comp) {}
+
+    /**
+     * Copy constructor
+     * @param src Another FlatTree object of the same type
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FlatTree<Key, T, KeyOfValue, Compare, Alloc>::FlatTree(const FlatTree &src): _data(src._data), _comp(src._comp) {}
+
+# if FT_CXX11
+    /**
+     * Move constructor, takes over the storage of src and leaves it empty
+     * @param src Another FlatTree object of the same type
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FlatTree<Key, T, KeyOfValue, Compare, Alloc>::FlatTree(FlatTree &&src): _data(std::move(src._data)), _comp(src._comp) {}
+# endif
+
+    /**
+     * Destructor
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FlatTree<Key, T, KeyOfValue, Compare, Alloc>::~FlatTree() {}
+
+    /**
+     * Copy container content
+     * @param other A FlatTree object of the same type
+     * @return *this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FlatTree<Key, T, KeyOfValue, Compare, Alloc> &FlatTree<Key, T, KeyOfValue, Compare, Alloc>::operator=(const FlatTree &other) {
+        if (this == &other)
+            return (*this);
+
+        _data = other._data;
+        _comp = other._comp;
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     * @param other A FlatTree object of the same type
+     * @return *this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FlatTree<Key, T, KeyOfValue, Compare, Alloc> &FlatTree<Key, T, KeyOfValue, Compare, Alloc>::operator=(FlatTree &&other) {
+        if (this == &other)
+            return (*this);
+
+        _data = std::move(other._data);
+        _comp = other._comp;
+        return (*this);
+    }
+# endif
+
+    /**
+     * Return iterator to beginning
+     * @return An iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::begin() {
+        return (_data.begin());
+    }
+
+    /**
+     * Return const iterator to beginning
+     * @return A const iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::begin() const {
+        return (_data.begin());
+    }
+
+    /**
+     * Return iterator to end
+     * @return An iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::end() {
+        return (_data.end());
+    }
+
+    /**
+     * Return const iterator to end
+     * @return A const iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::end() const {
+        return (_data.end());
+    }
+
+    /**
+     * Return reverse iterator to reverse beginning
+     * @return A reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::reverse_iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::rbegin() {
+        return (_data.rbegin());
+    }
+
+    /**
+     * Return const reverse iterator to reverse beginning
+     * @return A const reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::const_reverse_iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::rbegin() const {
+        return (_data.rbegin());
+    }
+
+    /**
+     * Return reverse iterator to reverse end
+     * @return A reverse iterator to the reverse end of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::reverse_iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::rend() {
+        return (_data.rend());
+    }
+
+    /**
+     * Return const reverse iterator to reverse end
+     * @return A const reverse iterator to the reverse end of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::const_reverse_iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::rend() const {
+        return (_data.rend());
+    }
+
+    /**
+     * Test whether container is empty
+     * @return true if the container size is 0, false otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    bool FlatTree<Key, T, KeyOfValue, Compare, Alloc>::empty() const {
+        return (_data.empty());
+    }
+
+    /**
+     * Return container size
+     * @return The number of elements in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size() const {
+        return (_data.size());
+    }
+
+    /**
+     * Return maximum size
+     * @return The maximum number of elements the container can hold as content
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FlatTree<Key, T, KeyOfValue, Compare, Alloc>::max_size() const {
+        return (_data.max_size());
+    }
+
+    /**
+     * Return size of allocated storage capacity
+     * @return The number of elements the container can hold before it reallocates
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FlatTree<Key, T, KeyOfValue, Compare, Alloc>::capacity() const {
+        return (_data.capacity());
+    }
+
+    /**
+     * Request a change in capacity
+     * @param n Minimum capacity for the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void FlatTree<Key, T, KeyOfValue, Compare, Alloc>::reserve(size_type n) {
+        _data.reserve(n);
+    }
+
+    /**
+     * Insert element, nothing is copied if an equivalent element is present
+     * @param val Value to be copied to the inserted element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    pair<typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, bool> FlatTree<Key, T, KeyOfValue, Compare, Alloc>::insert(const value_type &val) {
+        pair<size_type, bool> pos = _insert_index(KeyOfValue()(val));
+
+        if (!pos.second)
+            return (ft::make_pair(begin() + pos.first, false));
+        return (ft::make_pair(_data.insert(begin() + pos.first, val), true));
+    }
+
+    /**
+     * Insert element with hint
+     * @param position Hint for the position where the element can be inserted,
+     *                 the search is skipped if the element goes right before position
+     * @param val      Value to be copied to the inserted element
+     * @return An iterator to the inserted or the already present element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::insert(iterator position, const value_type &val) {
+        pair<size_type, bool> pos = _insert_index(position, KeyOfValue()(val));
+
+        if (!pos.second)
+            return (begin() + pos.first);
+        return (_data.insert(begin() + pos.first, val));
+    }
+
+# if FT_CXX11
+    /**
+     * Insert element, val is moved only if no equivalent element is present
+     * @param val Value to be moved to the inserted element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    pair<typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, bool> FlatTree<Key, T, KeyOfValue, Compare, Alloc>::insert(value_type &&val) {
+        pair<size_type, bool> pos = _insert_index(KeyOfValue()(val));
+
+        if (!pos.second)
+            return (ft::make_pair(begin() + pos.first, false));
+        return (ft::make_pair(_data.insert(begin() + pos.first, std::move(val)), true));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::insert(iterator position, value_type &&val) {
+        pair<size_type, bool> pos = _insert_index(position, KeyOfValue()(val));
+
+        if (!pos.second)
+            return (begin() + pos.first);
+        return (_data.insert(begin() + pos.first, std::move(val)));
+    }
+
+    /**
+     * Construct and insert element, the element is built first to get its key, then moved into the vector
+     * @param args Arguments forwarded to the constructor of the element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename... Args>
+    pair<typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, bool> FlatTree<Key, T, KeyOfValue, Compare, Alloc>::emplace(Args&&... args) {
+        return (insert(value_type(std::forward<Args>(args)...)));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename... Args>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::emplace_hint(iterator position, Args&&... args) {
+        return (insert(position, value_type(std::forward<Args>(args)...)));
+    }
+# endif
+
+    /**
+     * Insert elements: they are appended, then sorted and merged with the present ones in one pass
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    void FlatTree<Key, T, KeyOfValue, Compare, Alloc>::insert(InputIterator first, InputIterator last,
+                                                              typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*) {
+        size_type n = _data.size();
+
+        for (; first != last; first++)
+            _data.push_back(*first);
+        _merge_tail(n);
+    }
+
+    /**
+     * Insert a range sorted by key that holds no equivalent keys.
+     * An empty container takes it as it is, without comparing the elements
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    void FlatTree<Key, T, KeyOfValue, Compare, Alloc>::insert(assume_sorted_t, InputIterator first, InputIterator last) {
+        if (_data.empty()) {
+            for (; first != last; first++)
+                _data.push_back(*first);
+            return;
+        }
+        insert(first, last);
+    }
+
+    /**
+     * Erase element
+     * @param position Iterator pointing to a single element to be removed
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void FlatTree<Key, T, KeyOfValue, Compare, Alloc>::erase(iterator position) {
+        _data.erase(position);
+    }
+
+    /**
+     * Erase element
+     * @param k Key of the element to be removed
+     * @return Number of elements erased
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FlatTree<Key, T, KeyOfValue, Compare, Alloc>::erase(const key_type &k) {
+        size_type i = _find_index(k);
+
+        if (i == _data.size())
+            return (0);
+        _data.erase(begin() + i);
+        return (1);
+    }
+
+    /**
+     * Erase elements
+     * @param first Iterator to the initial position in a range
+     * @param last  Iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void FlatTree<Key, T, KeyOfValue, Compare, Alloc>::erase(iterator first, iterator last) {
+        _data.erase(first, last);
+    }
+
+    /**
+     * Swap content
+     * @param x Another FlatTree container of the same type as this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void FlatTree<Key, T, KeyOfValue, Compare, Alloc>::swap(FlatTree &x) {
+        key_compare _comp_tmp = this->_comp;
+
+        this->_data.swap(x._data);
+        this->_comp = x._comp;
+        x._comp = _comp_tmp;
+    }
+
+    /**
+     * Clear content, the capacity is kept
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void FlatTree<Key, T, KeyOfValue, Compare, Alloc>::clear() {
+        _data.clear();
+    }
+
+    /**
+     * Return key comparison object
+     * @return The comparison object
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::key_compare FlatTree<Key, T, KeyOfValue, Compare, Alloc>::key_comp() const {
+        return (_comp);
+    }
+
+    /**
+     * Get iterator to element
+     * @param k Key to be searched for
+     * @return An iterator to the element, if an element with a key equivalent to k is found, or end otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::find(const K &k) {
+        return (begin() + _find_index(k));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::find(const K &k) const {
+        return (begin() + _find_index(k));
+    }
+
+    /**
+     * Count elements with a specific key
+     * @param k Key to search for
+     * @return 1 if the container contains an element with a key equivalent to k, and zero otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FlatTree<Key, T, KeyOfValue, Compare, Alloc>::count(const K &k) const {
+        return (_find_index(k) != _data.size());
+    }
+
+    /**
+     * Return iterator to lower bound
+     * @param k Key to search for
+     * @return An iterator to the first element whose key is not considered to go before k, or end
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::lower_bound(const K &k) {
+        return (begin() + _lower_index(k));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::lower_bound(const K &k) const {
+        return (begin() + _lower_index(k));
+    }
+
+    /**
+     * Return iterator to upper bound
+     * @param k Key to search for
+     * @return An iterator to the first element whose key is considered to go after k, or end
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::upper_bound(const K &k) {
+        return (begin() + _upper_index(k));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator FlatTree<Key, T, KeyOfValue, Compare, Alloc>::upper_bound(const K &k) const {
+        return (begin() + _upper_index(k));
+    }
+
+    /**
+     * Get range of equal elements, with one search: the upper bound is the element after the lower bound
+     * when the lower bound is equivalent to k
+     * @param k Key to search for
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    pair<typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::iterator>
+    FlatTree<Key, T, KeyOfValue, Compare, Alloc>::equal_range(const K &k) {
+        iterator first = lower_bound(k);
+        iterator last = first;
+
+        if (first != end() && !_comp(k, KeyOfValue()(*first)))
+            ++last;
+        return (ft::make_pair(first, last));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    pair<typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator, typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator>
+    FlatTree<Key, T, KeyOfValue, Compare, Alloc>::equal_range(const K &k) const {
+        const_iterator first = lower_bound(k);
+        const_iterator last = first;
+
+        if (first != end() && !_comp(k, KeyOfValue()(*first)))
+            ++last;
+        return (ft::make_pair(first, last));
+    }
+
+    /**
+     * Get allocator
+     * @return The allocator
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FlatTree<Key, T, KeyOfValue, Compare, Alloc>::allocator_type FlatTree<Key, T, KeyOfValue, Compare, Alloc>::get_allocator() const {
+        return (_data.get_allocator());
+    }
+
+    /**
+     * Check that the keys are in strictly increasing order
+     * @return true if the container is valid
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    bool FlatTree<Key, T, KeyOfValue, Compare, Alloc>::verify() const {
+        for (size_type i = 1; i < _data.size(); i++) {
+            if (!_comp(_key(_data[i - 1]), _key(_data[i])))
+                return (false);
+        }
+        return (true);
+    }
+
+}
+
+#endif //FT_CONTAINERS_FLAT_TREE_HPP
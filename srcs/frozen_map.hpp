@@ -0,0 +1,588 @@
+#ifndef FT_CONTAINERS_FROZEN_MAP_HPP
+# define FT_CONTAINERS_FROZEN_MAP_HPP
+
+# include <memory>
+# include "utility.hpp"
+# include "algorithm.hpp"
+# include "functional.hpp"
+# include "frozen_tree.hpp"
+# include "map.hpp"
+# include "iterator.hpp"
+
+namespace ft {
+
+    /**
+     * Read-only associative container that store elements formed by a combination of a key value and a mapped value, following a specific order.
+     * Lookup interface of map over a FrozenTree: the elements are laid out once in one array in Eytzinger order,
+     * which makes lookups branchless and prefetched, and the keys never change after construction.
+     * Freeze a map once it is built, or construct from a range sorted by key; mapped values stay writable through iterators
+     * @tparam Key     Type of the keys
+     * @tparam T       Type of the mapped value
+     * @tparam Compare A binary predicate that takes two element keys as arguments and returns a bool
+     * @tparam Alloc   Type of the allocator object used to define the storage allocation model
+     */
+    template< typename Key, typename T, typename Compare = less<Key>, typename Alloc = std::allocator< pair<const Key, T> > >
+    class frozen_map {
+    public:
+        typedef Key                                      key_type;
+        typedef T                                        mapped_type;
+        typedef pair<const key_type, mapped_type>        value_type;
+        typedef Compare                                  key_compare;
+        typedef Alloc                                    allocator_type;
+        typedef typename allocator_type::reference       reference;
+        typedef typename allocator_type::const_reference const_reference;
+        typedef typename allocator_type::pointer         pointer;
+        typedef typename allocator_type::const_pointer   const_pointer;
+
+        /**
+         * Value comparison object
+         */
+        class value_compare {
+            friend class frozen_map;
+
+        protected:
+            key_compare _comp;
+            explicit value_compare(Compare c);
+
+        public:
+            typedef bool       result_type;
+            typedef value_type first_argument_type;
+            typedef value_type second_argument_type;
+
+            bool operator()(const value_type &x, const value_type &y) const;
+        };
+
+    private:
+        typedef FrozenTree<key_type, value_type, ft::select1st<value_type>, key_compare, allocator_type> tree_type;
+
+        tree_type _tree;
+
+    public:
+        typedef typename tree_type::iterator               iterator;
+        typedef typename tree_type::const_iterator         const_iterator;
+        typedef typename tree_type::reverse_iterator       reverse_iterator;
+        typedef typename tree_type::const_reverse_iterator const_reverse_iterator;
+        typedef typename tree_type::difference_type        difference_type;
+        typedef typename tree_type::size_type              size_type;
+
+        explicit frozen_map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        template<typename InputIterator>
+        frozen_map(assume_sorted_t, InputIterator first, InputIterator last,
+            const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        template<typename NodePolicy>
+        explicit frozen_map(const map<Key, T, Compare, Alloc, NodePolicy> &m);
+        frozen_map(const frozen_map &src);
+# if FT_CXX11
+        frozen_map(frozen_map &&src);
+# endif
+
+        ~frozen_map();
+
+        frozen_map                           &operator=(const frozen_map &other);
+# if FT_CXX11
+        frozen_map                           &operator=(frozen_map &&other);
+# endif
+
+        iterator                             begin();
+        const_iterator                       begin() const;
+
+        iterator                             end();
+        const_iterator                       end() const;
+
+        reverse_iterator                     rbegin();
+        const_reverse_iterator               rbegin() const;
+
+        reverse_iterator                     rend();
+        const_reverse_iterator               rend() const;
+
+        bool                                 empty() const;
+        size_type                            size() const;
+        size_type                            max_size() const;
+
+        void                                 swap(frozen_map &x);
+
+        key_compare                          key_comp() const;
+        value_compare                        value_comp() const;
+
+        iterator                             find(const key_type &k);
+        const_iterator                       find(const key_type &k) const;
+
+        size_type                            count(const key_type &k) const;
+
+        iterator                             lower_bound(const key_type &k);
+        const_iterator                       lower_bound(const key_type &k) const;
+
+        iterator                             upper_bound(const key_type &k);
+        const_iterator                       upper_bound(const key_type &k) const;
+
+        pair<iterator, iterator>             equal_range(const key_type &k);
+        pair<const_iterator, const_iterator> equal_range(const key_type &k) const;
+
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                             find(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+                                             find(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+                                             count(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                             lower_bound(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+                                             lower_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                             upper_bound(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+                                             upper_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<iterator, iterator> >::type
+                                             equal_range(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<const_iterator, const_iterator> >::type
+                                             equal_range(const K &k) const;
+
+        allocator_type                       get_allocator() const;
+
+        bool                                 verify() const;
+    };
+
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    frozen_map<Key, T, Compare, Alloc>::value_compare::value_compare(Compare c): _comp(c) {}
+
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    bool frozen_map<Key, T, Compare, Alloc>::value_compare::operator()(const value_type &x, const value_type &y) const {
+        return (_comp(x.first, y.first));
+    }
+
+    /**
+     * Empty container constructor (default constructor)
+     * @param comp  Binary predicate that, taking two element keys as argument, returns true if the first argument goes before
+     *              the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    frozen_map<Key, T, Compare, Alloc>::frozen_map(const key_compare &comp, const allocator_type &alloc):
+                                       _tree(comp, alloc) {}
+
+    /**
+     * Sorted range constructor, lays the elements out without comparing them
+     * @param first Input iterator to the initial position in a range sorted by key and holding no equivalent keys
+     * @param last  Input iterator to the final position in a range
+     * @param comp  Binary predicate that, taking two element keys as argument, returns true if the first argument goes before
+     *              the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    frozen_map<Key, T, Compare, Alloc>::frozen_map(assume_sorted_t, InputIterator first, InputIterator last,
+                                       const key_compare &comp, const allocator_type &alloc):
+                                       _tree(assume_sorted, first, last, comp, alloc) {}
+
+    /**
+     * Freeze a map: copies its elements in key order into the Eytzinger array, with the same comparison object
+     * and allocator. The map is left unchanged
+     * @param m A map object with the same key, mapped, comparison and allocator types, and any node policy
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename NodePolicy>
+    frozen_map<Key, T, Compare, Alloc>::frozen_map(const map<Key, T, Compare, Alloc, NodePolicy> &m):
+                                       _tree(assume_sorted, m.begin(), m.end(), m.key_comp(), m.get_allocator()) {}
+
+    /**
+     * Copy constructor
+     * @param src Another frozen_map object of the same type
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    frozen_map<Key, T, Compare, Alloc>::frozen_map(const frozen_map &src): _tree(src._tree) {}
+
+# if FT_CXX11
+    /**
+     * Move constructor, src is left empty
+     * @param src Another frozen_map object of the same type
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    frozen_map<Key, T, Compare, Alloc>::frozen_map(frozen_map &&src): _tree(std::move(src._tree)) {}
+# endif
+
+    /**
+     * Destructor
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    frozen_map<Key, T, Compare, Alloc>::~frozen_map() {}
+
+    /**
+     * Copy container content
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    frozen_map<Key, T, Compare, Alloc> &frozen_map<Key, T, Compare, Alloc>::operator=(const frozen_map &other) {
+        if (this == &other)
+            return (*this);
+        _tree = other._tree;
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    frozen_map<Key, T, Compare, Alloc> &frozen_map<Key, T, Compare, Alloc>::operator=(frozen_map &&other) {
+        _tree = std::move(other._tree);
+        return (*this);
+    }
+# endif
+
+    /**
+     * Return iterator to beginning
+     * @return An iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::iterator frozen_map<Key, T, Compare, Alloc>::begin() {
+        return (_tree.begin());
+    }
+
+    /**
+     * Return const iterator to beginning
+     * @return A const iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::const_iterator frozen_map<Key, T, Compare, Alloc>::begin() const {
+        return (_tree.begin());
+    }
+
+    /**
+     * Return iterator to end
+     * @return An iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::iterator frozen_map<Key, T, Compare, Alloc>::end() {
+        return (_tree.end());
+    }
+
+    /**
+     * Return const iterator to end
+     * @return A const iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::const_iterator frozen_map<Key, T, Compare, Alloc>::end() const {
+        return (_tree.end());
+    }
+
+    /**
+     * Return reverse iterator to reverse beginning
+     * @return A reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::reverse_iterator frozen_map<Key, T, Compare, Alloc>::rbegin() {
+        return (_tree.rbegin());
+    }
+
+    /**
+     * Return const reverse iterator to reverse beginning
+     * @return A const reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::const_reverse_iterator frozen_map<Key, T, Compare, Alloc>::rbegin() const {
+        return (_tree.rbegin());
+    }
+
+    /**
+     * Return reverse iterator to reverse end
+     * @return A reverse iterator to the reverse end of the sequence container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::reverse_iterator frozen_map<Key, T, Compare, Alloc>::rend() {
+        return (_tree.rend());
+    }
+
+    /**
+     * Return const reverse iterator to reverse end
+     * @return A const reverse iterator to the reverse end of the sequence container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::const_reverse_iterator frozen_map<Key, T, Compare, Alloc>::rend() const {
+        return (_tree.rend());
+    }
+
+    /**
+     * Test whether container is empty
+     * @return true if the container size is 0, false otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    bool frozen_map<Key, T, Compare, Alloc>::empty() const {
+        return (_tree.empty());
+    }
+
+    /**
+     * Return container size
+     * @return The number of elements in the container
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::size_type frozen_map<Key, T, Compare, Alloc>::size() const {
+        return (_tree.size());
+    }
+
+    /**
+     * Return maximum size
+     * @return The maximum number of elements a frozen_map container can hold as content
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::size_type frozen_map<Key, T, Compare, Alloc>::max_size() const {
+        return (_tree.max_size());
+    }
+
+    /**
+     * Swap content
+     * @param x Another frozen_map container of the same type as this
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    void frozen_map<Key, T, Compare, Alloc>::swap(frozen_map &x) {
+        _tree.swap(x._tree);
+    }
+
+    /**
+     * Return key comparison object
+     * @return The comparison object
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::key_compare frozen_map<Key, T, Compare, Alloc>::key_comp() const {
+        return (_tree.key_comp());
+    }
+
+    /**
+     * Return value comparison object
+     * @return The comparison object for element values
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::value_compare frozen_map<Key, T, Compare, Alloc>::value_comp() const {
+        return (value_compare(_tree.key_comp()));
+    }
+
+    /**
+     * Get iterator to element
+     * @param k Key to be searched for
+     * @return An iterator to the element, if an element with specified key is found, or frozen_map::end otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::iterator frozen_map<Key, T, Compare, Alloc>::find(const key_type &k) {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Get const iterator to element
+     * @param k Key to be searched for
+     * @return A const iterator to the element, if an element with specified key is found, or frozen_map::end otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::const_iterator frozen_map<Key, T, Compare, Alloc>::find(const key_type &k) const {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Count elements with a specific key
+     * @param k Key to search for
+     * @return 1 if the container contains an element whose key is equivalent to k, or zero otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::size_type frozen_map<Key, T, Compare, Alloc>::count(const key_type &k) const {
+        return (_tree.count(k));
+    }
+
+    /**
+     * Return iterator to lower bound
+     * @param k Key to search for
+     * @return An iterator to the the first element in the container whose key is not considered to go before k,
+     *         or frozen_map::end if all keys are considered to go before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::iterator frozen_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return const iterator to lower bound
+     * @param k Key to search for
+     * @return A const iterator to the the first element in the container whose key is not considered to go before k,
+     *         or frozen_map::end if all keys are considered to go before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::const_iterator frozen_map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) const {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return iterator to upper bound
+     * @param k Key to search for
+     * @return An iterator to the the first element in the container whose key is considered to go after k,
+     *         or frozen_map::end if no keys are considered to go after k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::iterator frozen_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Return const iterator to upper bound
+     * @param k Key to search for
+     * @return An iterator to the the first element in the container whose key is considered to go after k,
+     *         or frozen_map::end if no keys are considered to go after k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::const_iterator frozen_map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) const {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Get range of equal elements
+     * @param k Key to search for
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    pair<typename frozen_map<Key, T, Compare, Alloc>::iterator, typename frozen_map<Key, T, Compare, Alloc>::iterator> frozen_map<Key, T, Compare, Alloc>::equal_range(const key_type &k) {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get const range of equal elements
+     * @param k Key to search for
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    pair<typename frozen_map<Key, T, Compare, Alloc>::const_iterator, typename frozen_map<Key, T, Compare, Alloc>::const_iterator> frozen_map<Key, T, Compare, Alloc>::equal_range(const key_type &k) const {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get iterator to element, with a transparent comparison object
+     * @param k Value comparable with the keys, looked up without being converted to key_type
+     * @return An iterator to the element, if an element with a key equivalent to k is found, or frozen_map::end otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_map<Key, T, Compare, Alloc>::iterator>::type
+    frozen_map<Key, T, Compare, Alloc>::find(const K &k) {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Get const iterator to element, with a transparent comparison object
+     * @param k Value comparable with the keys, looked up without being converted to key_type
+     * @return A const iterator to the element, if an element with a key equivalent to k is found, or frozen_map::end otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_map<Key, T, Compare, Alloc>::const_iterator>::type
+    frozen_map<Key, T, Compare, Alloc>::find(const K &k) const {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Count elements with a key equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return 1 if the container contains an element whose key is equivalent to k, or zero otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_map<Key, T, Compare, Alloc>::size_type>::type
+    frozen_map<Key, T, Compare, Alloc>::count(const K &k) const {
+        return (_tree.count(k));
+    }
+
+    /**
+     * Return iterator to lower bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return An iterator to the the first element in the container whose key is not considered to go before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_map<Key, T, Compare, Alloc>::iterator>::type
+    frozen_map<Key, T, Compare, Alloc>::lower_bound(const K &k) {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return const iterator to lower bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return A const iterator to the the first element in the container whose key is not considered to go before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_map<Key, T, Compare, Alloc>::const_iterator>::type
+    frozen_map<Key, T, Compare, Alloc>::lower_bound(const K &k) const {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return iterator to upper bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return An iterator to the the first element in the container whose key is considered to go after k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_map<Key, T, Compare, Alloc>::iterator>::type
+    frozen_map<Key, T, Compare, Alloc>::upper_bound(const K &k) {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Return const iterator to upper bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return A const iterator to the the first element in the container whose key is considered to go after k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_map<Key, T, Compare, Alloc>::const_iterator>::type
+    frozen_map<Key, T, Compare, Alloc>::upper_bound(const K &k) const {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Get range of elements with a key equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<typename frozen_map<Key, T, Compare, Alloc>::iterator, typename frozen_map<Key, T, Compare, Alloc>::iterator> >::type
+    frozen_map<Key, T, Compare, Alloc>::equal_range(const K &k) {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get const range of elements with a key equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<typename frozen_map<Key, T, Compare, Alloc>::const_iterator, typename frozen_map<Key, T, Compare, Alloc>::const_iterator> >::type
+    frozen_map<Key, T, Compare, Alloc>::equal_range(const K &k) const {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get allocator
+     * @return The allocator
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    typename frozen_map<Key, T, Compare, Alloc>::allocator_type frozen_map<Key, T, Compare, Alloc>::get_allocator() const {
+        return (_tree.get_allocator());
+    }
+
+    /**
+     * Check that the keys are in strictly increasing order along the in-order walk (extension), takes linear time
+     * @return true if the container is valid
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc>
+    bool frozen_map<Key, T, Compare, Alloc>::verify() const {
+        return (_tree.verify());
+    }
+
+}
+
+#endif //FT_CONTAINERS_FROZEN_MAP_HPP
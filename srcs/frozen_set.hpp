@@ -0,0 +1,448 @@
+#ifndef FT_CONTAINERS_FROZEN_SET_HPP
+# define FT_CONTAINERS_FROZEN_SET_HPP
+
+# include <memory>
+# include "algorithm.hpp"
+# include "functional.hpp"
+# include "frozen_tree.hpp"
+# include "set.hpp"
+# include "iterator.hpp"
+
+namespace ft {
+
+    /**
+     * Read-only set container with the lookup interface of set, laid out once in one array in Eytzinger order,
+     * see FrozenTree. Freeze a set once it is built, or construct from a sorted range
+     * @tparam T       Type of the elements
+     * @tparam Compare A binary predicate that takes two arguments of the same type as the elements and returns a bool
+     * @tparam Alloc   Type of the allocator object used to define the storage allocation model
+     */
+    template< typename T, typename Compare = less<T>, typename Alloc = std::allocator<T> >
+    class frozen_set {
+    public:
+        typedef T                                                                          key_type;
+        typedef T                                                                          value_type;
+        typedef Compare                                                                    key_compare;
+        typedef Compare                                                                    value_compare;
+        typedef Alloc                                                                      allocator_type;
+        typedef typename allocator_type::reference                                         reference;
+        typedef typename allocator_type::const_reference                                   const_reference;
+        typedef typename allocator_type::pointer                                           pointer;
+        typedef typename allocator_type::const_pointer                                     const_pointer;
+        typedef typename FrozenTree<T, T, ft::identity<T>, Compare, Alloc>::const_iterator iterator;
+        typedef typename FrozenTree<T, T, ft::identity<T>, Compare, Alloc>::const_iterator const_iterator;
+        typedef ft::reverse_iterator<iterator>                                             reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>                                       const_reverse_iterator;
+        typedef typename iterator_traits<iterator>::difference_type                        difference_type;
+        typedef size_t                                                                     size_type;
+
+    private:
+        FrozenTree<key_type, value_type, ft::identity<value_type>, key_compare, allocator_type> _tree;
+
+    public:
+        explicit frozen_set(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        template<typename InputIterator>
+        frozen_set(assume_sorted_t, InputIterator first, InputIterator last,
+            const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        template<typename NodePolicy>
+        explicit frozen_set(const set<T, Compare, Alloc, NodePolicy> &s);
+        frozen_set(const frozen_set &src);
+# if FT_CXX11
+        frozen_set(frozen_set &&src);
+# endif
+
+        ~frozen_set();
+
+        frozen_set               &operator=(const frozen_set &other);
+# if FT_CXX11
+        frozen_set               &operator=(frozen_set &&other);
+# endif
+
+        iterator                 begin();
+        const_iterator           begin() const;
+
+        iterator                 end();
+        const_iterator           end() const;
+
+        reverse_iterator         rbegin();
+        const_reverse_iterator   rbegin() const;
+
+        reverse_iterator         rend();
+        const_reverse_iterator   rend() const;
+
+        bool                     empty() const;
+        size_type                size() const;
+        size_type                max_size() const;
+
+        void                     swap(frozen_set &x);
+
+        key_compare              key_comp() const;
+        value_compare            value_comp() const;
+
+        iterator                 find(const value_type &val) const;
+        size_type                count(const value_type &val) const;
+
+        iterator                 lower_bound(const value_type &val) const;
+        iterator                 upper_bound(const value_type &val) const;
+        pair<iterator, iterator> equal_range(const value_type &val) const;
+
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                 find(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+                                 count(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                 lower_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                 upper_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<iterator, iterator> >::type
+                                 equal_range(const K &k) const;
+
+        allocator_type           get_allocator() const;
+
+        bool                     verify() const;
+    };
+
+    /**
+     * Empty container constructor (default constructor)
+     * @param comp  Binary predicate that, taking two values of the same type of those contained in the frozen_set,
+     *              returns true if the first argument goes before the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename T, typename Compare, typename Alloc>
+    frozen_set<T, Compare, Alloc>::frozen_set(const key_compare &comp, const allocator_type &alloc):
+    _tree(comp, alloc) {}
+
+    /**
+     * Sorted range constructor, lays the elements out without comparing them
+     * @param first Input iterator to the initial position in a range sorted by key and holding no equivalent keys
+     * @param last  Input iterator to the final position in a range
+     * @param comp  Binary predicate that, taking two values of the same type of those contained in the frozen_set,
+     *              returns true if the first argument goes before the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    frozen_set<T, Compare, Alloc>::frozen_set(assume_sorted_t, InputIterator first, InputIterator last,
+                                  const key_compare &comp, const allocator_type &alloc):
+                                  _tree(assume_sorted, first, last, comp, alloc) {}
+
+    /**
+     * Freeze a set: copies its elements in order into the Eytzinger array, with the same comparison object
+     * and allocator. The set is left unchanged
+     * @param s A set object with the same value, comparison and allocator types, and any node policy
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename NodePolicy>
+    frozen_set<T, Compare, Alloc>::frozen_set(const set<T, Compare, Alloc, NodePolicy> &s):
+    _tree(assume_sorted, s.begin(), s.end(), s.key_comp(), s.get_allocator()) {}
+
+    /**
+     * Copy constructor
+     * @param src Another frozen_set object of the same type
+     */
+    template<typename T, typename Compare, typename Alloc>
+    frozen_set<T, Compare, Alloc>::frozen_set(const frozen_set &src): _tree(src._tree) {}
+
+# if FT_CXX11
+    /**
+     * Move constructor, src is left empty
+     * @param src Another frozen_set object of the same type
+     */
+    template<typename T, typename Compare, typename Alloc>
+    frozen_set<T, Compare, Alloc>::frozen_set(frozen_set &&src): _tree(std::move(src._tree)) {}
+# endif
+
+    /**
+     * Destructor
+     */
+    template<typename T, typename Compare, typename Alloc>
+    frozen_set<T, Compare, Alloc>::~frozen_set() {}
+
+    /**
+     * Copy container content
+     */
+    template<typename T, typename Compare, typename Alloc>
+    frozen_set<T, Compare, Alloc> &frozen_set<T, Compare, Alloc>::operator=(const frozen_set &other) {
+        if (this == &other)
+            return (*this);
+        _tree = other._tree;
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     */
+    template<typename T, typename Compare, typename Alloc>
+    frozen_set<T, Compare, Alloc> &frozen_set<T, Compare, Alloc>::operator=(frozen_set &&other) {
+        _tree = std::move(other._tree);
+        return (*this);
+    }
+# endif
+
+    /**
+     * Return iterator to beginning
+     * @return An iterator to the first element in the container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::iterator frozen_set<T, Compare, Alloc>::begin() {
+        return (_tree.begin());
+    }
+
+    /**
+     * Return const iterator to beginning
+     * @return A const iterator to the first element in the container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::const_iterator frozen_set<T, Compare, Alloc>::begin() const {
+        return (_tree.begin());
+    }
+
+    /**
+     * Return iterator to end
+     * @return An iterator to the past-the-end element in the container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::iterator frozen_set<T, Compare, Alloc>::end() {
+        return (_tree.end());
+    }
+
+    /**
+     * Return const iterator to end
+     * @return A const iterator to the past-the-end element in the container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::const_iterator frozen_set<T, Compare, Alloc>::end() const {
+        return (_tree.end());
+    }
+
+    /**
+     * Return reverse iterator to reverse beginning
+     * @return A reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::reverse_iterator frozen_set<T, Compare, Alloc>::rbegin() {
+        return (_tree.rbegin());
+    }
+
+    /**
+     * Return const reverse iterator to reverse beginning
+     * @return A const reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::const_reverse_iterator frozen_set<T, Compare, Alloc>::rbegin() const {
+        return (_tree.rbegin());
+    }
+
+    /**
+     * Return reverse iterator to reverse end
+     * @return A reverse iterator to the reverse end of the sequence container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::reverse_iterator frozen_set<T, Compare, Alloc>::rend() {
+        return (_tree.rend());
+    }
+
+    /**
+     * Return const reverse iterator to reverse end
+     * @return A const reverse iterator to the reverse end of the sequence container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::const_reverse_iterator frozen_set<T, Compare, Alloc>::rend() const {
+        return (_tree.rend());
+    }
+
+    /**
+     * Test whether container is empty
+     * @return true if the container size is 0, false otherwise
+     */
+    template<typename T, typename Compare, typename Alloc>
+    bool frozen_set<T, Compare, Alloc>::empty() const {
+        return (_tree.empty());
+    }
+
+    /**
+     * Return container size
+     * @return The number of elements in the container
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::size_type frozen_set<T, Compare, Alloc>::size() const {
+        return (_tree.size());
+    }
+
+    /**
+     * Return maximum size
+     * @return The maximum number of elements a frozen_set container can hold as content
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::size_type frozen_set<T, Compare, Alloc>::max_size() const {
+        return (_tree.max_size());
+    }
+
+    /**
+    * Swap content
+    * @param x Another frozen_set container of the same type as this
+    */
+    template<typename T, typename Compare, typename Alloc>
+    void frozen_set<T, Compare, Alloc>::swap(frozen_set &x) {
+        _tree.swap(x._tree);
+    }
+
+    /**
+     * Return key comparison object
+     * @return The comparison object
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::key_compare frozen_set<T, Compare, Alloc>::key_comp() const {
+        return (_tree.key_comp());
+    }
+
+    /**
+     * Return value comparison object
+     * @return The comparison object for element values
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::value_compare frozen_set<T, Compare, Alloc>::value_comp() const {
+        return (_tree.key_comp());
+    }
+
+    /**
+     * Get iterator to element
+     * @param val Value to be searched for
+     * @return An iterator to the element, if an element with specified value is found, or frozen_set::end otherwise
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::iterator frozen_set<T, Compare, Alloc>::find(const value_type &val) const {
+        return (_tree.find(val));
+    }
+
+    /**
+    * Count elements with a specific value
+    * @param val Value to search for
+    * @return 1 if the container contains an element whose value is equivalent to val, or zero otherwise
+    */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::size_type frozen_set<T, Compare, Alloc>::count(const value_type &val) const {
+        return (_tree.count(val));
+    }
+
+    /**
+     * Return iterator to lower bound
+     * @param val Value to compare
+     * @return An iterator to the the first element in the container which is not considered to go before val,
+     *         or frozen_set::end if all elements are considered to go before val
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::iterator frozen_set<T, Compare, Alloc>::lower_bound(const value_type &val) const {
+        return (_tree.lower_bound(val));
+    }
+
+    /**
+     * Return iterator to upper bound
+     * @param val Value to compare
+     * @return An iterator to the the first element in the container which is considered to go after val,
+     *         or frozen_set::end if no elements are considered to go after val
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::iterator frozen_set<T, Compare, Alloc>::upper_bound(const value_type &val) const {
+        return (_tree.upper_bound(val));
+    }
+
+    /**
+     * Get range of equal elements
+     * @param val Value to search for
+     * @return pair, whose member pair::first is the lower bound of the range (the same as lower_bound),
+     *         and pair::second is the upper bound (the same as upper_bound)
+     */
+    template<typename T, typename Compare, typename Alloc>
+    pair <typename frozen_set<T, Compare, Alloc>::iterator, typename frozen_set<T, Compare, Alloc>::iterator>
+    frozen_set<T, Compare, Alloc>::equal_range(const value_type &val) const {
+        return (_tree.equal_range(val));
+    }
+
+    /**
+     * Get iterator to element, with a transparent comparison object
+     * @param k Value comparable with the elements, looked up without being converted to value_type
+     * @return An iterator to the element, if an element equivalent to k is found, or frozen_set::end otherwise
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_set<T, Compare, Alloc>::iterator>::type
+    frozen_set<T, Compare, Alloc>::find(const K &k) const {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Count elements equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return 1 if the container contains an element equivalent to k, or zero otherwise
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_set<T, Compare, Alloc>::size_type>::type
+    frozen_set<T, Compare, Alloc>::count(const K &k) const {
+        return (_tree.count(k));
+    }
+
+    /**
+     * Return iterator to lower bound, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return An iterator to the the first element in the container which is not considered to go before k
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_set<T, Compare, Alloc>::iterator>::type
+    frozen_set<T, Compare, Alloc>::lower_bound(const K &k) const {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return iterator to upper bound, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return An iterator to the the first element in the container which is considered to go after k
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename frozen_set<T, Compare, Alloc>::iterator>::type
+    frozen_set<T, Compare, Alloc>::upper_bound(const K &k) const {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Get range of elements equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename T, typename Compare, typename Alloc>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<typename frozen_set<T, Compare, Alloc>::iterator, typename frozen_set<T, Compare, Alloc>::iterator> >::type
+    frozen_set<T, Compare, Alloc>::equal_range(const K &k) const {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get allocator
+     * @return The allocator
+     */
+    template<typename T, typename Compare, typename Alloc>
+    typename frozen_set<T, Compare, Alloc>::allocator_type frozen_set<T, Compare, Alloc>::get_allocator() const {
+        return (_tree.get_allocator());
+    }
+
+    /**
+     * Check that the elements are in strictly increasing order along the in-order walk (extension), takes linear time
+     * @return true if the container is valid
+     */
+    template<typename T, typename Compare, typename Alloc>
+    bool frozen_set<T, Compare, Alloc>::verify() const {
+        return (_tree.verify());
+    }
+
+}
+
+#endif //FT_CONTAINERS_FROZEN_SET_HPP
@@ -0,0 +1,646 @@
+#ifndef FT_CONTAINERS_FROZEN_TREE_HPP
+# define FT_CONTAINERS_FROZEN_TREE_HPP
+
+namespace ft {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc> class FrozenTree;
+}
+
+# include <memory>
+# include "algorithm.hpp"
+# include "iterators/frozen_iterator.hpp"
+# include "utility.hpp"
+# include "functional.hpp"
+# include "type_traits.hpp"
+
+/**
+ * Size in bytes of a cache line. The 2^d descendants of an element d levels down are contiguous, the search
+ * prefetches the line that holds them for the largest d where they fit in a line: 4 levels down for int elements
+ */
+# ifndef FT_FROZEN_TREE_CACHE_LINE
+#  define FT_FROZEN_TREE_CACHE_LINE 64
+# endif
+
+namespace ft {
+
+    /**
+     * Read-only ordered container in Eytzinger layout.
+     * The elements fill one array in the breadth-first order of a complete binary search tree: the root at index 1,
+     * the children of index k at 2k and 2k + 1. A search is a loop of k = 2k + (element < key) with no branch
+     * to mispredict, the first levels share a few cache lines that stay hot, and the 2^d descendants d levels
+     * below an element are contiguous, so one prefetch per step loads the elements of the steps ahead.
+     * The tree is built once from a range sorted by key and holding no equivalent keys, then never changes.
+     * Iteration walks the implicit tree in key order
+     * @tparam Key        Type of the keys
+     * @tparam T          Type of the elements
+     * @tparam KeyOfValue Function object that returns the key of an element, ft::identity or ft::select1st
+     * @tparam Compare    A binary predicate that takes two element keys as arguments and returns a bool
+     * @tparam Alloc      Type of the allocator object used to define the storage allocation model
+     */
+    template< typename Key, typename T, typename KeyOfValue, typename Compare = ft::less<Key>, typename Alloc = std::allocator<T> >
+    class FrozenTree {
+    public:
+        typedef Key                                    key_type;
+        typedef T                                      value_type;
+        typedef Alloc                                  allocator_type;
+        typedef Compare                                key_compare;
+        typedef frozen_iterator<T, T*, T&>             iterator;
+        typedef frozen_iterator<T, const T*, const T&> const_iterator;
+        typedef ft::reverse_iterator<iterator>         reverse_iterator;
+        typedef ft::reverse_iterator<const_iterator>   const_reverse_iterator;
+        typedef ptrdiff_t                              difference_type;
+        typedef size_t                                 size_type;
+
+    private:
+        enum {
+            prefetch_stride = sizeof(T) < FT_FROZEN_TREE_CACHE_LINE ? FT_FROZEN_TREE_CACHE_LINE / sizeof(T) : 1
+        };
+
+        allocator_type _alloc;
+        key_compare    _comp;
+        value_type     *_data;
+        size_type      _size;
+
+        static const key_type &_key(const value_type &val);
+        size_type             _levels() const;
+        static size_type      _resolve(size_type k);
+        template<typename K>
+        size_type             _lower_index(const K &k) const;
+        template<typename K>
+        size_type             _upper_index(const K &k) const;
+        template<typename K>
+        size_type             _find_index(const K &k) const;
+        template<typename InputIterator>
+        void                  _build(InputIterator first);
+        void                  _destroy();
+
+    public:
+        FrozenTree(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        template<typename InputIterator>
+        FrozenTree(assume_sorted_t, InputIterator first, InputIterator last,
+                   const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        FrozenTree(const FrozenTree &src);
+# if FT_CXX11
+        FrozenTree(FrozenTree &&src);
+# endif
+
+        ~FrozenTree();
+
+        FrozenTree                           &operator=(const FrozenTree &other);
+# if FT_CXX11
+        FrozenTree                           &operator=(FrozenTree &&other);
+# endif
+
+        iterator                             begin();
+        const_iterator                       begin() const;
+
+        iterator                             end();
+        const_iterator                       end() const;
+
+        reverse_iterator                     rbegin();
+        const_reverse_iterator               rbegin() const;
+
+        reverse_iterator                     rend();
+        const_reverse_iterator               rend() const;
+
+        bool                                 empty() const;
+        size_type                            size() const;
+        size_type                            max_size() const;
+
+        void                                 swap(FrozenTree &x);
+
+        key_compare                          key_comp() const;
+
+        template<typename K>
+        iterator                             find(const K &k);
+        template<typename K>
+        const_iterator                       find(const K &k) const;
+
+        template<typename K>
+        size_type                            count(const K &k) const;
+
+        template<typename K>
+        iterator                             lower_bound(const K &k);
+        template<typename K>
+        const_iterator                       lower_bound(const K &k) const;
+
+        template<typename K>
+        iterator                             upper_bound(const K &k);
+        template<typename K>
+        const_iterator                       upper_bound(const K &k) const;
+
+        template<typename K>
+        pair<iterator, iterator>             equal_range(const K &k);
+        template<typename K>
+        pair<const_iterator, const_iterator> equal_range(const K &k) const;
+
+        allocator_type                       get_allocator() const;
+
+        bool                                 verify() const;
+    };
+
+    /**
+     * Get key of an element
+     * @param val Element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    const typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::key_type &FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::_key(const value_type &val) {
+        return (KeyOfValue()(val));
+    }
+
+    /**
+     * Number of complete levels of the tree, floor(log2(size + 1))
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::_levels() const {
+# if defined(__GNUC__) || defined(__clang__)
+        return (sizeof(unsigned long) * 8 - 1 - __builtin_clzl(static_cast<unsigned long>(_size + 1)));
+# else
+        size_type levels = 0;
+
+        for (size_type n = _size + 1; n > 1; n >>= 1)
+            levels++;
+        return (levels);
+# endif
+    }
+
+    /**
+     * Index of the answer of a search from the index the descent fell out of the tree at.
+     * Every step right appended a 1 bit to k and every step left a 0, the answer is the last element the search
+     * went left at: drop the trailing 1 bits and the 0 before them. 0 if the search never went left
+     * @param k Index past the last level, in [size + 1, 2 * size + 1]
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::_resolve(size_type k) {
+# if defined(__GNUC__) || defined(__clang__)
+        return (k >> (__builtin_ctzl(~static_cast<unsigned long>(k)) + 1));
+# else
+        while (k & 1)
+            k >>= 1;
+        return (k >> 1);
+# endif
+    }
+
+    /**
+     * Index of the first element whose key is not before k.
+     * The descent takes one step per complete level, a loop whose trip count only depends on the size, then one last
+     * step into the partial bottom level done with a conditional move. A step is a prefetch, a comparison and
+     * a shift-add, there is no branch on the comparison to mispredict
+     * @param k Key to search for
+     * @return The index of the element, or 0 if every key is before k
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::_lower_index(const K &k) const {
+        size_type i = 1;
+
+        if (!_size)
+            return (0);
+        for (size_type level = _levels(); level > 0; level--) {
+            FT_PREFETCH(_data + ft::min<size_type>(i * prefetch_stride, _size));
+            i = 2 * i + _comp(_key(_data[i]), k);
+        }
+
+        size_type last = 2 * i + _comp(_key(_data[ft::min(i, _size)]), k);
+
+        return (_resolve(i <= _size ? last : i));
+    }
+
+    /**
+     * Index of the first element whose key is after k, same search as _lower_index
+     * @param k Key to search for
+     * @return The index of the element, or 0 if no key is after k
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::_upper_index(const K &k) const {
+        size_type i = 1;
+
+        if (!_size)
+            return (0);
+        for (size_type level = _levels(); level > 0; level--) {
+            FT_PREFETCH(_data + ft::min<size_type>(i * prefetch_stride, _size));
+            i = 2 * i + !_comp(k, _key(_data[i]));
+        }
+
+        size_type last = 2 * i + !_comp(k, _key(_data[ft::min(i, _size)]));
+
+        return (_resolve(i <= _size ? last : i));
+    }
+
+    /**
+     * Index of the element with a key equivalent to k
+     * @param k Key to search for
+     * @return The index of the element, or 0 if there is none
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::_find_index(const K &k) const {
+        size_type i = _lower_index(k);
+
+        if (i && _comp(k, _key(_data[i])))
+            return (0);
+        return (i);
+    }
+
+    /**
+     * Construct the elements from a sorted range into allocated storage: the in-order walk of the implicit tree
+     * visits the indexes in key order, so the range is read once from first to last.
+     * If a construction throws, the elements built so far are destroyed and the storage freed
+     * @param first Input iterator to a range of size elements
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    void FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::_build(InputIterator first) {
+        size_type built = 0;
+
+        try {
+            for (size_type i = eytzinger::first(_size); i; i = eytzinger::next(i, _size)) {
+                _alloc.construct(_data + i, *first);
+                built++;
+                first++;
+            }
+        } catch (...) {
+            for (size_type i = eytzinger::first(_size); built; i = eytzinger::next(i, _size), built--)
+                _alloc.destroy(_data + i);
+            _alloc.deallocate(_data, _size + 1);
+            _data = NULL;
+            _size = 0;
+            throw;
+        }
+    }
+
+    /**
+     * Destroy the elements and free the storage
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::_destroy() {
+        if (!_data)
+            return;
+        for (size_type i = 1; i <= _size; i++)
+            _alloc.destroy(_data + i);
+        _alloc.deallocate(_data, _size + 1);
+        _data = NULL;
+        _size = 0;
+    }
+
+    /**
+     * Empty container constructor (default constructor)
+     * @param comp  Binary predicate that, taking two element keys as argument, returns true if the first argument goes before
+     *              the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::FrozenTree(const key_compare &comp, const allocator_type &alloc):
+    _alloc(alloc), _comp(comp), _data(NULL), _size(0) {}
+
+    /**
+     * Sorted range constructor, the elements are laid out without comparing them
+     * @param first Input iterator to the initial position in a range sorted by key and holding no equivalent keys
+     * @param last  Input iterator to the final position in a range
+     * @param comp  Binary predicate that, taking two element keys as argument, returns true if the first argument goes before
+     *              the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename InputIterator>
+    FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::FrozenTree(assume_sorted_t, InputIterator first, InputIterator last,
+                                                               const key_compare &comp, const allocator_type &alloc):
+    _alloc(alloc), _comp(comp), _data(NULL), _size(ft::distance(first, last)) {
+        if (!_size)
+            return;
+        _data = _alloc.allocate(_size + 1);
+        _build(first);
+    }
+
+    /**
+     * Copy constructor, the copy has the same layout
+     * @param src Another FrozenTree object of the same type
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::FrozenTree(const FrozenTree &src):
+    _alloc(src._alloc), _comp(src._comp), _data(NULL), _size(src._size) {
+        if (!_size)
+            return;
+        _data = _alloc.allocate(_size + 1);
+
+        size_type i = 1;
+
+        try {
+            for (; i <= _size; i++)
+                _alloc.construct(_data + i, src._data[i]);
+        } catch (...) {
+            while (--i > 0)
+                _alloc.destroy(_data + i);
+            _alloc.deallocate(_data, _size + 1);
+            throw;
+        }
+    }
+
+# if FT_CXX11
+    /**
+     * Move constructor, takes over the array of src and leaves it empty
+     * @param src Another FrozenTree object of the same type
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::FrozenTree(FrozenTree &&src):
+    _alloc(src._alloc), _comp(src._comp), _data(src._data), _size(src._size) {
+        src._data = NULL;
+        src._size = 0;
+    }
+# endif
+
+    /**
+     * Destructor
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::~FrozenTree() {
+        _destroy();
+    }
+
+    /**
+     * Copy container content, the current content is kept if the copy fails
+     * @param other A FrozenTree object of the same type
+     * @return *this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FrozenTree<Key, T, KeyOfValue, Compare, Alloc> &FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::operator=(const FrozenTree &other) {
+        if (this == &other)
+            return (*this);
+
+        FrozenTree tmp(other);
+
+        swap(tmp);
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     * @param other A FrozenTree object of the same type
+     * @return *this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    FrozenTree<Key, T, KeyOfValue, Compare, Alloc> &FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::operator=(FrozenTree &&other) {
+        if (this == &other)
+            return (*this);
+
+        _destroy();
+        swap(other);
+
+        return (*this);
+    }
+# endif
+
+    /**
+     * Return iterator to beginning
+     * @return An iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::begin() {
+        return (iterator(_data, eytzinger::first(_size), _size));
+    }
+
+    /**
+     * Return const iterator to beginning
+     * @return A const iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::begin() const {
+        return (const_iterator(_data, eytzinger::first(_size), _size));
+    }
+
+    /**
+     * Return iterator to end
+     * @return An iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::end() {
+        return (iterator(_data, 0, _size));
+    }
+
+    /**
+     * Return const iterator to end
+     * @return A const iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::end() const {
+        return (const_iterator(_data, 0, _size));
+    }
+
+    /**
+     * Return reverse iterator to reverse beginning
+     * @return A reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::reverse_iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::rbegin() {
+        return (reverse_iterator(end()));
+    }
+
+    /**
+     * Return const reverse iterator to reverse beginning
+     * @return A const reverse iterator to the reverse beginning of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::const_reverse_iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::rbegin() const {
+        return (const_reverse_iterator(end()));
+    }
+
+    /**
+     * Return reverse iterator to reverse end
+     * @return A reverse iterator to the reverse end of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::reverse_iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::rend() {
+        return (reverse_iterator(begin()));
+    }
+
+    /**
+     * Return const reverse iterator to reverse end
+     * @return A const reverse iterator to the reverse end of the sequence container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::const_reverse_iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::rend() const {
+        return (const_reverse_iterator(begin()));
+    }
+
+    /**
+     * Test whether container is empty
+     * @return true if the container size is 0, false otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    bool FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::empty() const {
+        return (!_size);
+    }
+
+    /**
+     * Return container size
+     * @return The number of elements in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::size() const {
+        return (_size);
+    }
+
+    /**
+     * Return maximum size
+     * @return The maximum number of elements the container can hold as content
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::max_size() const {
+        return (_alloc.max_size() - 1);
+    }
+
+    /**
+     * Swap content
+     * @param x Another FrozenTree container of the same type as this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    void FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::swap(FrozenTree &x) {
+        allocator_type _alloc_tmp = this->_alloc;
+        key_compare    _comp_tmp = this->_comp;
+        value_type     *_data_tmp = this->_data;
+        size_type      _size_tmp = this->_size;
+
+        this->_alloc = x._alloc;
+        this->_comp = x._comp;
+        this->_data = x._data;
+        this->_size = x._size;
+
+        x._alloc = _alloc_tmp;
+        x._comp = _comp_tmp;
+        x._data = _data_tmp;
+        x._size = _size_tmp;
+    }
+
+    /**
+     * Return key comparison object
+     * @return The comparison object
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::key_compare FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::key_comp() const {
+        return (_comp);
+    }
+
+    /**
+     * Get iterator to element
+     * @param k Key to be searched for
+     * @return An iterator to the element, if an element with a key equivalent to k is found, or end otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::find(const K &k) {
+        return (iterator(_data, _find_index(k), _size));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::find(const K &k) const {
+        return (const_iterator(_data, _find_index(k), _size));
+    }
+
+    /**
+     * Count elements with a specific key
+     * @param k Key to search for
+     * @return 1 if the container contains an element with a key equivalent to k, and zero otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::size_type FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::count(const K &k) const {
+        return (_find_index(k) != 0);
+    }
+
+    /**
+     * Return iterator to lower bound
+     * @param k Key to search for
+     * @return An iterator to the first element whose key is not considered to go before k, or end
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::lower_bound(const K &k) {
+        return (iterator(_data, _lower_index(k), _size));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::lower_bound(const K &k) const {
+        return (const_iterator(_data, _lower_index(k), _size));
+    }
+
+    /**
+     * Return iterator to upper bound
+     * @param k Key to search for
+     * @return An iterator to the first element whose key is considered to go after k, or end
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::upper_bound(const K &k) {
+        return (iterator(_data, _upper_index(k), _size));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::upper_bound(const K &k) const {
+        return (const_iterator(_data, _upper_index(k), _size));
+    }
+
+    /**
+     * Get range of equal elements, with one search: the upper bound is the element after the lower bound
+     * when the lower bound is equivalent to k
+     * @param k Key to search for
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    pair<typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::iterator, typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::iterator>
+    FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::equal_range(const K &k) {
+        iterator first = lower_bound(k);
+        iterator last = first;
+
+        if (first != end() && !_comp(k, KeyOfValue()(*first)))
+            ++last;
+        return (ft::make_pair(first, last));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    template<typename K>
+    pair<typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator, typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::const_iterator>
+    FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::equal_range(const K &k) const {
+        const_iterator first = lower_bound(k);
+        const_iterator last = first;
+
+        if (first != end() && !_comp(k, KeyOfValue()(*first)))
+            ++last;
+        return (ft::make_pair(first, last));
+    }
+
+    /**
+     * Get allocator
+     * @return The allocator
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    typename FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::allocator_type FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::get_allocator() const {
+        return (_alloc);
+    }
+
+    /**
+     * Check that the keys are in strictly increasing order along the in-order walk, which makes every element
+     * greater than its left subtree and less than its right subtree. Takes linear time
+     * @return true if the tree is valid
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc>
+    bool FrozenTree<Key, T, KeyOfValue, Compare, Alloc>::verify() const {
+        size_type n = 0;
+        size_type prev = 0;
+
+        for (size_type i = eytzinger::first(_size); i; i = eytzinger::next(i, _size)) {
+            if (prev && !_comp(_key(_data[prev]), _key(_data[i])))
+                return (false);
+            prev = i;
+            n++;
+        }
+        return (n == _size && (_size == 0) == (_data == NULL));
+    }
+
+}
+
+#endif //FT_CONTAINERS_FROZEN_TREE_HPP
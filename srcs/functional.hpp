@@ -1,6 +1,10 @@
 #ifndef FT_CONTAINERS_FUNCTIONAL_HPP
 # define FT_CONTAINERS_FUNCTIONAL_HPP
 
+# include <string>
+# include <cstring>
+# include "type_traits.hpp"
+
 namespace ft {
 
     template <class Arg1, class Arg2, class Result>
@@ -10,13 +14,185 @@ namespace ft {
         typedef Result result_type;
     };
 
-    template<typename T>
+    template<typename T = void>
     struct less: binary_function<T, T, bool> {
         bool operator()(const T &x, const T &y) const {
             return (x < y);
         }
     };
 
+    /**
+     * Transparent less: compares arguments of any two types with operator<,
+     * lets map and set look up a key without converting it to key_type first
+     */
+    template<>
+    struct less<void> {
+        typedef void is_transparent;
+
+        template<typename T, typename U>
+        bool operator()(const T &x, const U &y) const {
+            return (x < y);
+        }
+    };
+
+    template<typename T = void>
+    struct equal_to: binary_function<T, T, bool> {
+        bool operator()(const T &x, const T &y) const {
+            return (x == y);
+        }
+    };
+
+    /**
+     * Key extractor of a set: the value is its own key
+     */
+    template<typename T>
+    struct identity {
+        const T &operator()(const T &x) const {
+            return (x);
+        }
+    };
+
+    /**
+     * Key extractor of a map: the key is the first member of the pair
+     */
+    template<typename Pair>
+    struct select1st {
+        const typename Pair::first_type &operator()(const Pair &x) const {
+            return (x.first);
+        }
+    };
+
+    /**
+     * Check if a comparison object declares is_transparent, so it can compare a K with a key directly
+     * @tparam Compare Comparison object type
+     * @tparam K       Type of the looked up key, only used to make the check depend on a member template parameter
+     */
+    template<typename T>
+    struct _void_type {
+        typedef void type;
+    };
+
+    template<typename Compare, typename K, typename = void>
+    struct is_transparent {
+        static const bool value = false;
+    };
+
+    template<typename Compare, typename K>
+    struct is_transparent<Compare, K, typename _void_type<typename Compare::is_transparent>::type> {
+        static const bool value = true;
+    };
+
+    /**
+     * Three-way comparison hook of the tree based containers: compare(comp, x, y) returns a negative number, zero
+     * or a positive number when x goes before, is equivalent to or goes after y. When value is set, finds and inserts
+     * tell the three cases apart with one call per node instead of calling comp once to go left and once more to
+     * go right. Built in for ft::less on integral, floating point and std::string keys; specialize it for other
+     * comparators, compare must agree with comp:
+     *     namespace ft { template<> struct three_way_compare<MyLess, MyKey> {
+     *         static const bool value = true;
+     *         static int compare(const MyLess &comp, const MyKey &x, const MyKey &y);
+     *     }; }
+     * The generic version derives the result from comp
+     * @tparam Compare Comparison object type
+     * @tparam Key     Key type
+     */
+    template<typename Compare, typename Key, typename = void>
+    struct three_way_compare {
+        static const bool value = false;
+
+        template<typename T, typename U>
+        static int compare(const Compare &comp, const T &x, const U &y) {
+            if (comp(x, y))
+                return (-1);
+            return (comp(y, x) ? 1 : 0);
+        }
+    };
+
+    template<typename Key>
+    struct three_way_compare<less<Key>, Key, typename enable_if<is_integral<Key>::value || is_floating_point<Key>::value>::type> {
+        static const bool value = true;
+
+        static int compare(const less<Key> &comp, const Key &x, const Key &y) {
+            (void)comp;
+            return ((y < x) - (x < y));
+        }
+    };
+
+    template<>
+    struct three_way_compare<less<std::string>, std::string> {
+        static const bool value = true;
+
+        static int compare(const less<std::string> &comp, const std::string &x, const std::string &y) {
+            (void)comp;
+            return (x.compare(y));
+        }
+    };
+
+    /**
+     * Hash function object of the unordered containers. Built in for integral, floating point and pointer types
+     * and std::string; specialize it for other key types:
+     *     namespace ft { template<> struct hash<MyKey> {
+     *         size_t operator()(const MyKey &x) const;
+     *     }; }
+     * The hash table mixes every hash value before use, so the built-in hashes of integers and pointers
+     * are the values themselves
+     * @tparam T Key type
+     */
+    template<typename T, typename = void>
+    struct hash;
+
+    template<typename T>
+    struct hash<T, typename enable_if<is_integral<T>::value>::type> {
+        size_t operator()(T x) const {
+            return (static_cast<size_t>(x));
+        }
+    };
+
+    template<typename T>
+    struct hash<T, typename enable_if<is_floating_point<T>::value>::type> {
+        size_t operator()(T x) const {
+            const unsigned char *bytes = reinterpret_cast<const unsigned char*>(&x);
+            size_t              h = 14695981039346656037ULL & ~static_cast<size_t>(0);
+
+            if (x == 0)
+                return (0);
+            for (size_t i = 0; i < sizeof(T); i++)
+                h = (h ^ bytes[i]) * 1099511628211ULL;
+            return (h);
+        }
+    };
+
+    template<typename T>
+    struct hash<T*> {
+        size_t operator()(T *p) const {
+            return (reinterpret_cast<size_t>(p));
+        }
+    };
+
+    /**
+     * Hash of the characters, read eight at a time: each word is xored in, multiplied and folded,
+     * and the last one is padded with zeros
+     */
+    template<>
+    struct hash<std::string> {
+        size_t operator()(const std::string &x) const {
+            const char         *p = x.data();
+            size_t             n = x.size();
+            unsigned long long h = 14695981039346656037ULL ^ n;
+            unsigned long long w;
+
+            for (; n >= sizeof(w); n -= sizeof(w), p += sizeof(w)) {
+                std::memcpy(&w, p, sizeof(w));
+                h = (h ^ w) * 0x9E3779B97F4A7C15ULL;
+                h ^= h >> 29;
+            }
+            w = 0;
+            std::memcpy(&w, p, n);
+            h = (h ^ w) * 0x9E3779B97F4A7C15ULL;
+            return (static_cast<size_t>(h ^ (h >> 32)));
+        }
+    };
+
 }
 
 #endif //FT_CONTAINERS_FUNCTIONAL_HPP
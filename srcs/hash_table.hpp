@@ -0,0 +1,1011 @@
+#ifndef FT_CONTAINERS_HASH_TABLE_HPP
+# define FT_CONTAINERS_HASH_TABLE_HPP
+
+# include <memory>
+# include "iterators/hash_table_iterator.hpp"
+# include "utility.hpp"
+# include "functional.hpp"
+
+/**
+ * The control bytes are probed 16 at a time with SSE2 when the compiler targets it, which is the default on x86-64.
+ * Build with -DFT_HASH_TABLE_SSE2=0 to use the portable byte loop instead
+ */
+# ifndef FT_HASH_TABLE_SSE2
+#  if defined(__SSE2__)
+#   define FT_HASH_TABLE_SSE2 1
+#  else
+#   define FT_HASH_TABLE_SSE2 0
+#  endif
+# endif
+
+# if FT_HASH_TABLE_SSE2
+#  include <emmintrin.h>
+# endif
+
+namespace ft {
+
+    /**
+     * Operations on a group of 16 consecutive control bytes of a hash table,
+     * each one returns a mask with bit i set when byte i of the group matches
+     */
+    struct hash_table_group {
+        enum {
+            width = 16
+        };
+
+        static unsigned          match(const signed char *ctrl, signed char tag);
+        static unsigned          match_free(const signed char *ctrl);
+        static size_t            lowest(unsigned mask);
+        static const signed char *empty_group();
+    };
+
+    /**
+     * Find the full slots of a group holding a tag
+     * @param ctrl First control byte of the group
+     * @param tag  Low 7 bits of a hash
+     * @return The mask of the bytes equal to tag
+     */
+    inline unsigned hash_table_group::match(const signed char *ctrl, signed char tag) {
+# if FT_HASH_TABLE_SSE2
+        __m128i group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl));
+
+        return (static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(group, _mm_set1_epi8(tag)))));
+# else
+        unsigned mask = 0;
+
+        for (int i = 0; i < width; i++)
+            if (ctrl[i] == tag)
+                mask |= 1u << i;
+        return (mask);
+# endif
+    }
+
+    /**
+     * Find the slots of a group that hold no element: empty slots and the sentinel, the only negative bytes
+     * @param ctrl First control byte of the group
+     * @return The mask of the negative bytes
+     */
+    inline unsigned hash_table_group::match_free(const signed char *ctrl) {
+# if FT_HASH_TABLE_SSE2
+        return (static_cast<unsigned>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))));
+# else
+        unsigned mask = 0;
+
+        for (int i = 0; i < width; i++)
+            if (ctrl[i] < 0)
+                mask |= 1u << i;
+        return (mask);
+# endif
+    }
+
+    /**
+     * Index of the lowest bit set in a non-zero mask
+     */
+    inline size_t hash_table_group::lowest(unsigned mask) {
+# if defined(__GNUC__) || defined(__clang__)
+        return (static_cast<size_t>(__builtin_ctz(mask)));
+# else
+        size_t i = 0;
+
+        while (!(mask & 1u)) {
+            mask >>= 1;
+            i++;
+        }
+        return (i);
+# endif
+    }
+
+    /**
+     * Control bytes of a table without slots: a group of sentinels shared by all empty tables,
+     * so an empty table allocates nothing and its iterators need no special case
+     */
+    inline const signed char *hash_table_group::empty_group() {
+        static const signed char group[width] = {
+            -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+        };
+
+        return (group);
+    }
+
+    /**
+     * Open addressing hash table.
+     * Elements are stored in place in an array of slots, next to an array of one control byte per slot:
+     * hash_table_empty for a free slot, or the low 7 bits of the hash of the element, its tag.
+     * The bucket count is a power of two and an element goes to the first free slot from its home bucket
+     * (linear probing), without wrapping around: the slot array extends a few groups past the last bucket and ends
+     * with a group of sentinels. In the rare case a probe reaches them the slots past the last bucket double and the
+     * bucket count stays, so keys whose home is one of the last buckets cannot make the table grow without end.
+     * A lookup compares the tag against a whole group of control bytes at once and only compares the keys
+     * of the matching slots, it stops at the first group holding a free slot.
+     * Erasing leaves no tombstone: the elements that follow in the same run of full slots are moved back
+     * into the hole when their home bucket allows it, so lookups never get slower after erasing
+     * @tparam Key        Type of the keys
+     * @tparam T          Type of the elements
+     * @tparam KeyOfValue Function object that returns the key of an element, ft::identity or ft::select1st
+     * @tparam Hash       Hash function object of the keys
+     * @tparam KeyEqual   A binary predicate that tells whether two keys are equal
+     * @tparam Alloc      Type of the allocator object used to define the storage allocation model
+     */
+    template< typename Key, typename T, typename KeyOfValue, typename Hash = ft::hash<Key>, typename KeyEqual = ft::equal_to<Key>,
+              typename Alloc = std::allocator<T> >
+    class HashTable {
+    public:
+        typedef Key                                                    key_type;
+        typedef T                                                      value_type;
+        typedef Hash                                                   hasher;
+        typedef KeyEqual                                               key_equal;
+        typedef Alloc                                                  allocator_type;
+        typedef typename Alloc::template rebind<signed char>::other    ctrl_allocator_type;
+        typedef hash_table_iterator<T, T*, T&>                         iterator;
+        typedef hash_table_iterator<T, const T*, const T&>             const_iterator;
+        typedef ptrdiff_t                                              difference_type;
+        typedef size_t                                                 size_type;
+
+    private:
+        enum {
+            overflow = 2 * hash_table_group::width
+        };
+
+        allocator_type      _alloc;
+        ctrl_allocator_type _ctrl_alloc;
+        hasher              _hash;
+        key_equal           _eq;
+        value_type          *_slots;
+        signed char         *_ctrl;
+        size_type           _bucket_count;
+        size_type           _overflow;
+        size_type           _size;
+        size_type           _grow_limit;
+        float               _max_load;
+
+        static const key_type &_key(const value_type &val);
+        static size_t         _mix(size_t h);
+        static size_type      _home(size_t h, size_type buckets);
+        static signed char    _tag(size_t h);
+        static size_type      _find_free(const signed char *ctrl, size_type i);
+        static size_type      _slot_count(size_type buckets, size_type tail);
+        size_type             _slot_count() const;
+        size_t                _hash_key(const key_type &k) const;
+        size_type             _find(const key_type &k, size_t h) const;
+        size_type             _prepare_insert(size_t h);
+        size_type             _buckets_for(size_type n) const;
+        signed char           *_allocate_ctrl(size_type buckets, size_type tail);
+        void                  _deallocate();
+        bool                  _place(signed char *ctrl, value_type *slots, size_type buckets);
+        void                  _rehash(size_type buckets, size_type tail);
+        void                  _destroy_elements();
+        void                  _erase_slots(size_type first, size_type last);
+        iterator              _iter(size_type i) const;
+
+    public:
+        HashTable(size_type n = 0, const hasher &hash = hasher(), const key_equal &eq = key_equal(),
+                  const allocator_type &alloc = allocator_type());
+        HashTable(const HashTable &src);
+# if FT_CXX11
+        HashTable(HashTable &&src);
+# endif
+
+        ~HashTable();
+
+        HashTable                            &operator=(const HashTable &other);
+# if FT_CXX11
+        HashTable                            &operator=(HashTable &&other);
+# endif
+
+        iterator                             begin();
+        const_iterator                       begin() const;
+
+        iterator                             end();
+        const_iterator                       end() const;
+
+        bool                                 empty() const;
+        size_type                            size() const;
+        size_type                            max_size() const;
+
+        pair<iterator, bool>                 insert(const value_type &val);
+# if FT_CXX11
+        pair<iterator, bool>                 insert(value_type &&val);
+        template<typename... Args>
+        pair<iterator, bool>                 emplace(Args&&... args);
+# endif
+        template<typename InputIterator>
+        void                                 insert(InputIterator first, InputIterator last);
+
+        iterator                             erase(iterator position);
+        size_type                            erase(const key_type &k);
+        iterator                             erase(iterator first, iterator last);
+
+        void                                 swap(HashTable &x);
+        void                                 clear();
+
+        iterator                             find(const key_type &k);
+        const_iterator                       find(const key_type &k) const;
+        size_type                            count(const key_type &k) const;
+        pair<iterator, iterator>             equal_range(const key_type &k);
+        pair<const_iterator, const_iterator> equal_range(const key_type &k) const;
+
+        size_type                            bucket_count() const;
+        float                                load_factor() const;
+        float                                max_load_factor() const;
+        void                                 max_load_factor(float ml);
+        void                                 rehash(size_type n);
+        void                                 reserve(size_type n);
+
+        hasher                               hash_function() const;
+        key_equal                            key_eq() const;
+        allocator_type                       get_allocator() const;
+    };
+
+    /**
+     * Get key of an element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    const typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::key_type &HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_key(const value_type &val) {
+        return (KeyOfValue()(val));
+    }
+
+    /**
+     * Mix a hash value, so that keys differing only in their high bits, or hashed to multiples of a power of two,
+     * still spread over the buckets. The home bucket and the tag are both taken from the mixed value
+     * @param h Hash value returned by the hash function
+     * @return Mixed hash value
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    size_t HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_mix(size_t h) {
+        unsigned long long x = static_cast<unsigned long long>(h) * 0x9E3779B97F4A7C15ULL;
+
+        return (static_cast<size_t>(x ^ (x >> 32)));
+    }
+
+    /**
+     * Home bucket of a mixed hash value
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_home(size_t h, size_type buckets) {
+        return ((h >> 7) & (buckets - 1));
+    }
+
+    /**
+     * Tag of a mixed hash value, the control byte of its slot
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    signed char HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_tag(size_t h) {
+        return (static_cast<signed char>(h & 0x7f));
+    }
+
+    /**
+     * Find the first slot from a position that holds no element
+     * @param ctrl Control bytes
+     * @param i    Position
+     * @return Index of an empty slot, or of the first sentinel
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_find_free(const signed char *ctrl, size_type i) {
+        while (true) {
+            unsigned mask = hash_table_group::match_free(ctrl + i);
+
+            if (mask)
+                return (i + hash_table_group::lowest(mask));
+            i += hash_table_group::width;
+        }
+    }
+
+    /**
+     * Number of slots of a table, the buckets and the overflow past the last one
+     * @param buckets Bucket count
+     * @param tail    Number of slots past the last bucket
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_slot_count(size_type buckets, size_type tail) {
+        return (buckets ? buckets + tail : 0);
+    }
+
+    /**
+     * Number of slots of the table
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_slot_count() const {
+        return (_slot_count(_bucket_count, _overflow));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    size_t HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_hash_key(const key_type &k) const {
+        return (_mix(_hash(k)));
+    }
+
+    /**
+     * Find the slot of a key
+     * @param k Key to be searched for
+     * @param h Mixed hash of the key
+     * @return Index of the slot holding the key, or the slot count if there is none
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_find(const key_type &k, size_t h) const {
+        if (!_size)
+            return (_slot_count());
+
+        signed char tag = _tag(h);
+        size_type   i = _home(h, _bucket_count);
+
+        while (true) {
+            unsigned mask = hash_table_group::match(_ctrl + i, tag);
+
+            while (mask) {
+                size_type j = i + hash_table_group::lowest(mask);
+                if (_eq(_key(_slots[j]), k))
+                    return (j);
+                mask &= mask - 1;
+            }
+            if (hash_table_group::match_free(_ctrl + i))
+                return (_slot_count());
+            i += hash_table_group::width;
+        }
+    }
+
+    /**
+     * Find the slot where a new element goes, growing the table first if it is full.
+     * If the probe runs into the sentinels, the slots past the last bucket double until it finds a free one
+     * @param h Mixed hash of the key of the new element
+     * @return Index of an empty slot
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_prepare_insert(size_t h) {
+        if (_size >= _grow_limit) {
+            size_type buckets = _buckets_for(_size + 1);
+            _rehash(buckets > 2 * _bucket_count ? buckets : 2 * _bucket_count, overflow);
+        }
+
+        size_type i = _find_free(_ctrl, _home(h, _bucket_count));
+
+        while (_ctrl[i] == hash_table_sentinel) {
+            _rehash(_bucket_count, 2 * _overflow);
+            i = _find_free(_ctrl, _home(h, _bucket_count));
+        }
+        return (i);
+    }
+
+    /**
+     * Smallest bucket count that holds n elements within the maximum load factor
+     * @param n Number of elements
+     * @return A power of two, at least one group, or 0 for no elements
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_buckets_for(size_type n) const {
+        size_type buckets = hash_table_group::width;
+
+        if (!n)
+            return (0);
+        while (static_cast<size_type>(static_cast<float>(buckets) * _max_load) < n)
+            buckets *= 2;
+        return (buckets);
+    }
+
+    /**
+     * Allocate the control bytes of a table: every slot empty, then one group of sentinels
+     * @param buckets Bucket count
+     * @param tail    Number of slots past the last bucket
+     * @return Control bytes
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    signed char *HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_allocate_ctrl(size_type buckets, size_type tail) {
+        size_type   slots = _slot_count(buckets, tail);
+        signed char *ctrl = _ctrl_alloc.allocate(slots + hash_table_group::width);
+
+        for (size_type i = 0; i < slots; i++)
+            ctrl[i] = hash_table_empty;
+        for (size_type i = 0; i < hash_table_group::width; i++)
+            ctrl[slots + i] = hash_table_sentinel;
+        return (ctrl);
+    }
+
+    /**
+     * Free the slots and the control bytes, the elements must have been destroyed
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    void HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_deallocate() {
+        if (!_bucket_count)
+            return;
+        _alloc.deallocate(_slots, _slot_count());
+        _ctrl_alloc.deallocate(_ctrl, _slot_count() + hash_table_group::width);
+    }
+
+    /**
+     * Place every element of the table into new control bytes, and copy or move it into new slots
+     * @param ctrl    Control bytes of the new table, all empty
+     * @param slots   Slots of the new table, or NULL to only check that the elements fit
+     * @param buckets Bucket count of the new table
+     * @return false if an element would run into the sentinels of the new table, which then needs more slots
+     *         past its last bucket
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    bool HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_place(signed char *ctrl, value_type *slots, size_type buckets) {
+        size_type count = _slot_count();
+
+        for (size_type j = 0; j < count; j++) {
+            if (_ctrl[j] < 0)
+                continue;
+
+            size_t    h = _hash_key(_key(_slots[j]));
+            size_type i = _find_free(ctrl, _home(h, buckets));
+
+            if (ctrl[i] == hash_table_sentinel)
+                return (false);
+            if (slots)
+                ft::allocator_construct(_alloc, slots + i, FT_MOVE(_slots[j]));
+            ctrl[i] = _tag(h);
+        }
+        return (true);
+    }
+
+    /**
+     * Move the elements into a table with another bucket count or another number of slots past the last bucket.
+     * The elements are placed once without being moved, to check that none runs into the sentinels of the new table,
+     * otherwise the slots past the last bucket are doubled until they fit. They are then moved in the same order,
+     * so they land in the same slots. On an exception while copying the table is left unchanged
+     * @param buckets New bucket count, a power of two of at least one group, or 0 to free an empty table
+     * @param tail    Number of slots past the last bucket, at least one group
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    void HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_rehash(size_type buckets, size_type tail) {
+        signed char *ctrl;
+        value_type  *slots;
+
+        if (!buckets) {
+            _deallocate();
+            _slots = NULL;
+            _ctrl = const_cast<signed char*>(hash_table_group::empty_group());
+            _bucket_count = 0;
+            _overflow = overflow;
+            _grow_limit = 0;
+            return;
+        }
+
+        while (true) {
+            ctrl = _allocate_ctrl(buckets, tail);
+            if (_place(ctrl, NULL, buckets))
+                break;
+            _ctrl_alloc.deallocate(ctrl, _slot_count(buckets, tail) + hash_table_group::width);
+            tail *= 2;
+        }
+
+        size_type count = _slot_count(buckets, tail);
+
+        for (size_type i = 0; i < count; i++)
+            ctrl[i] = hash_table_empty;
+
+        try {
+            slots = _alloc.allocate(count);
+        } catch (...) {
+            _ctrl_alloc.deallocate(ctrl, count + hash_table_group::width);
+            throw;
+        }
+
+        try {
+            _place(ctrl, slots, buckets);
+        } catch (...) {
+            for (size_type i = 0; i < count; i++)
+                if (ctrl[i] >= 0)
+                    _alloc.destroy(slots + i);
+            _alloc.deallocate(slots, count);
+            _ctrl_alloc.deallocate(ctrl, count + hash_table_group::width);
+            throw;
+        }
+
+        _destroy_elements();
+        _deallocate();
+        _slots = slots;
+        _ctrl = ctrl;
+        _bucket_count = buckets;
+        _overflow = tail;
+        _grow_limit = static_cast<size_type>(static_cast<float>(buckets) * _max_load);
+    }
+
+    /**
+     * Destroy every element, the slots are left as they are
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    void HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_destroy_elements() {
+        size_type count = _slot_count();
+
+        for (size_type i = 0; i < count; i++)
+            if (_ctrl[i] >= 0)
+                _alloc.destroy(_slots + i);
+    }
+
+    /**
+     * Erase the elements of a range of slots, then close the holes they leave.
+     * Every element of the run of full slots after the range is moved to the first free slot from its home bucket,
+     * when that slot comes before its own. This keeps every element reachable from its home bucket through
+     * full slots only, with no tombstone left behind. Elements only move backwards, to slots not before first
+     * @param first Index of the first slot
+     * @param last  Index past the last slot
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    void HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_erase_slots(size_type first, size_type last) {
+        for (size_type i = first; i < last; i++) {
+            if (_ctrl[i] >= 0) {
+                _alloc.destroy(_slots + i);
+                _ctrl[i] = hash_table_empty;
+                _size--;
+            }
+        }
+
+        for (size_type k = last; _ctrl[k] >= 0; k++) {
+            size_type i = _find_free(_ctrl, _home(_hash_key(_key(_slots[k])), _bucket_count));
+
+            if (i < k) {
+                ft::allocator_construct(_alloc, _slots + i, FT_MOVE(_slots[k]));
+                _alloc.destroy(_slots + k);
+                _ctrl[i] = _ctrl[k];
+                _ctrl[k] = hash_table_empty;
+            }
+        }
+    }
+
+    /**
+     * Iterator to a slot, or to the next full slot if it is empty
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::_iter(size_type i) const {
+        return (iterator(_slots + i, _ctrl + i));
+    }
+
+    /**
+     * Constructor
+     * @param n     Minimum number of buckets
+     * @param hash  Hash function object
+     * @param eq    Key equality predicate
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::HashTable(size_type n, const hasher &hash, const key_equal &eq, const allocator_type &alloc):
+    _alloc(alloc), _ctrl_alloc(alloc), _hash(hash), _eq(eq), _slots(NULL), _ctrl(const_cast<signed char*>(hash_table_group::empty_group())),
+    _bucket_count(0), _overflow(overflow), _size(0), _grow_limit(0), _max_load(0.8f) {
+        rehash(n);
+    }
+
+    /**
+     * Copy constructor, the elements are copied to the same slots so nothing is hashed
+     * @param src Another HashTable object of the same type
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::HashTable(const HashTable &src):
+    _alloc(src._alloc), _ctrl_alloc(src._ctrl_alloc), _hash(src._hash), _eq(src._eq), _slots(NULL),
+    _ctrl(const_cast<signed char*>(hash_table_group::empty_group())), _bucket_count(0), _overflow(overflow), _size(0), _grow_limit(0),
+    _max_load(src._max_load) {
+        if (!src._size)
+            return;
+
+        size_type count = src._slot_count();
+
+        _slots = _alloc.allocate(count);
+        try {
+            _ctrl = _allocate_ctrl(src._bucket_count, src._overflow);
+        } catch (...) {
+            _alloc.deallocate(_slots, count);
+            throw;
+        }
+        _bucket_count = src._bucket_count;
+        _overflow = src._overflow;
+        _grow_limit = src._grow_limit;
+
+        try {
+            for (size_type i = 0; i < count; i++) {
+                if (src._ctrl[i] >= 0) {
+                    _alloc.construct(_slots + i, src._slots[i]);
+                    _ctrl[i] = src._ctrl[i];
+                }
+            }
+        } catch (...) {
+            _destroy_elements();
+            _deallocate();
+            throw;
+        }
+        _size = src._size;
+    }
+
+# if FT_CXX11
+    /**
+     * Move constructor, takes over the slots of src and leaves it empty
+     * @param src Another HashTable object of the same type
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::HashTable(HashTable &&src):
+    _alloc(src._alloc), _ctrl_alloc(src._ctrl_alloc), _hash(src._hash), _eq(src._eq), _slots(src._slots), _ctrl(src._ctrl),
+    _bucket_count(src._bucket_count), _overflow(src._overflow), _size(src._size), _grow_limit(src._grow_limit), _max_load(src._max_load) {
+        src._slots = NULL;
+        src._ctrl = const_cast<signed char*>(hash_table_group::empty_group());
+        src._bucket_count = 0;
+        src._overflow = overflow;
+        src._size = 0;
+        src._grow_limit = 0;
+    }
+# endif
+
+    /**
+     * Destructor
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::~HashTable() {
+        _destroy_elements();
+        _deallocate();
+    }
+
+    /**
+     * Copy container content
+     * @param other A HashTable object of the same type
+     * @return *this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc> &HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::operator=(const HashTable &other) {
+        if (this == &other)
+            return (*this);
+
+        HashTable tmp(other);
+
+        swap(tmp);
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     * @param other A HashTable object of the same type
+     * @return *this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc> &HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::operator=(HashTable &&other) {
+        if (this == &other)
+            return (*this);
+
+        clear();
+        _rehash(0, overflow);
+        swap(other);
+
+        return (*this);
+    }
+# endif
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::begin() {
+        return (_iter(0));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::const_iterator HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::begin() const {
+        return (_iter(0));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::end() {
+        return (_iter(_slot_count()));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::const_iterator HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::end() const {
+        return (_iter(_slot_count()));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    bool HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::empty() const {
+        return (_size == 0);
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size() const {
+        return (_size);
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::max_size() const {
+        return (_alloc.max_size());
+    }
+
+    /**
+     * Insert element
+     * @param val Value to be copied to the inserted element
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    pair<typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator, bool> HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::insert(const value_type &val) {
+        size_t    h = _hash_key(_key(val));
+        size_type i = _find(_key(val), h);
+
+        if (i != _slot_count())
+            return (ft::make_pair(_iter(i), false));
+
+        i = _prepare_insert(h);
+        _alloc.construct(_slots + i, val);
+        _ctrl[i] = _tag(h);
+        _size++;
+        return (ft::make_pair(_iter(i), true));
+    }
+
+# if FT_CXX11
+    /**
+     * Insert element
+     * @param val Value to be moved to the inserted element
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    pair<typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator, bool> HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::insert(value_type &&val) {
+        size_t    h = _hash_key(_key(val));
+        size_type i = _find(_key(val), h);
+
+        if (i != _slot_count())
+            return (ft::make_pair(_iter(i), false));
+
+        i = _prepare_insert(h);
+        ft::allocator_construct(_alloc, _slots + i, std::move(val));
+        _ctrl[i] = _tag(h);
+        _size++;
+        return (ft::make_pair(_iter(i), true));
+    }
+
+    /**
+     * Construct and insert element, the element is built first to find its key and moved into its slot
+     * @param args Arguments forwarded to the constructor of the new element
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    template<typename... Args>
+    pair<typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator, bool> HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::emplace(Args&&... args) {
+        value_type val(std::forward<Args>(args)...);
+
+        return (insert(std::move(val)));
+    }
+# endif
+
+    /**
+     * Insert elements
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    template<typename InputIterator>
+    void HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::insert(InputIterator first, InputIterator last) {
+        for (; first != last; ++first)
+            insert(*first);
+    }
+
+    /**
+     * Erase element. The elements after it in the same run of slots may move back,
+     * which invalidates the iterators to them but never moves an element before position
+     * @param position Iterator pointing to the element to be removed
+     * @return An iterator to the next element, the iteration can go on from it without missing or repeating an element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::erase(iterator position) {
+        size_type i = static_cast<size_type>(position.slot() - _slots);
+
+        _erase_slots(i, i + 1);
+        return (_iter(i));
+    }
+
+    /**
+     * Erase element
+     * @param k Key of the element to be removed
+     * @return Number of elements erased
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::erase(const key_type &k) {
+        size_type i = _find(k, _hash_key(k));
+
+        if (i == _slot_count())
+            return (0);
+        _erase_slots(i, i + 1);
+        return (1);
+    }
+
+    /**
+     * Erase elements
+     * @param first Iterator to the initial position in a range
+     * @param last  Iterator to the final position in a range
+     * @return An iterator to the element that follows the erased ones
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::erase(iterator first, iterator last) {
+        size_type i = static_cast<size_type>(first.slot() - _slots);
+
+        if (first != last)
+            _erase_slots(i, static_cast<size_type>(last.slot() - _slots));
+        return (_iter(i));
+    }
+
+    /**
+     * Swap content
+     * @param x Another HashTable container of the same type as this
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    void HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::swap(HashTable &x) {
+        allocator_type      _alloc_tmp = this->_alloc;
+        ctrl_allocator_type _ctrl_alloc_tmp = this->_ctrl_alloc;
+        hasher              _hash_tmp = this->_hash;
+        key_equal           _eq_tmp = this->_eq;
+        value_type          *_slots_tmp = this->_slots;
+        signed char         *_ctrl_tmp = this->_ctrl;
+        size_type           _bucket_count_tmp = this->_bucket_count;
+        size_type           _overflow_tmp = this->_overflow;
+        size_type           _size_tmp = this->_size;
+        size_type           _grow_limit_tmp = this->_grow_limit;
+        float               _max_load_tmp = this->_max_load;
+
+        this->_alloc = x._alloc;
+        this->_ctrl_alloc = x._ctrl_alloc;
+        this->_hash = x._hash;
+        this->_eq = x._eq;
+        this->_slots = x._slots;
+        this->_ctrl = x._ctrl;
+        this->_bucket_count = x._bucket_count;
+        this->_overflow = x._overflow;
+        this->_size = x._size;
+        this->_grow_limit = x._grow_limit;
+        this->_max_load = x._max_load;
+
+        x._alloc = _alloc_tmp;
+        x._ctrl_alloc = _ctrl_alloc_tmp;
+        x._hash = _hash_tmp;
+        x._eq = _eq_tmp;
+        x._slots = _slots_tmp;
+        x._ctrl = _ctrl_tmp;
+        x._bucket_count = _bucket_count_tmp;
+        x._overflow = _overflow_tmp;
+        x._size = _size_tmp;
+        x._grow_limit = _grow_limit_tmp;
+        x._max_load = _max_load_tmp;
+    }
+
+    /**
+     * Clear content, the buckets are kept
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    void HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::clear() {
+        size_type count = _slot_count();
+
+        _destroy_elements();
+        for (size_type i = 0; i < count; i++)
+            _ctrl[i] = hash_table_empty;
+        _size = 0;
+    }
+
+    /**
+     * Get iterator to element
+     * @param k Key to be searched for
+     * @return An iterator to the element, if an element with specified key is found, or end otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::find(const key_type &k) {
+        return (_iter(_find(k, _hash_key(k))));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::const_iterator HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::find(const key_type &k) const {
+        return (_iter(_find(k, _hash_key(k))));
+    }
+
+    /**
+     * Count elements with a specific key
+     * @param k Key to search for
+     * @return 1 if the container contains an element with key k, and zero otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::count(const key_type &k) const {
+        return (_find(k, _hash_key(k)) != _slot_count());
+    }
+
+    /**
+     * Get range of equal elements
+     * @param k Key to search for
+     * @return The range holding the element with key k, empty if there is none
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    pair<typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator, typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::iterator>
+    HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::equal_range(const key_type &k) {
+        size_type i = _find(k, _hash_key(k));
+
+        if (i == _slot_count())
+            return (ft::make_pair(end(), end()));
+        return (ft::make_pair(_iter(i), _iter(i + 1)));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    pair<typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::const_iterator, typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::const_iterator>
+    HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::equal_range(const key_type &k) const {
+        size_type i = _find(k, _hash_key(k));
+
+        if (i == _slot_count())
+            return (ft::make_pair(end(), end()));
+        return (ft::make_pair(const_iterator(_iter(i)), const_iterator(_iter(i + 1))));
+    }
+
+    /**
+     * Return number of buckets
+     * @return A power of two, or 0 before the first insertion
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::size_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::bucket_count() const {
+        return (_bucket_count);
+    }
+
+    /**
+     * Return load factor
+     * @return The number of elements per bucket
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    float HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::load_factor() const {
+        return (_bucket_count ? static_cast<float>(_size) / static_cast<float>(_bucket_count) : 0.0f);
+    }
+
+    /**
+     * Return maximum load factor
+     * @return The load factor the table grows past, 0.8 by default
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    float HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::max_load_factor() const {
+        return (_max_load);
+    }
+
+    /**
+     * Set maximum load factor, the table is rehashed if it is now over it.
+     * A lower factor makes the runs of full slots shorter, so lookups of missing keys, insertions and erasures
+     * probe fewer slots, at the cost of memory. Values above 1 are taken as 1, values that are not positive are ignored
+     * @param ml New maximum load factor
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    void HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::max_load_factor(float ml) {
+        if (!(ml > 0.0f))
+            return;
+        _max_load = ml > 1.0f ? 1.0f : ml;
+        _grow_limit = static_cast<size_type>(static_cast<float>(_bucket_count) * _max_load);
+        if (_size > _grow_limit)
+            _rehash(_buckets_for(_size), overflow);
+    }
+
+    /**
+     * Set number of buckets, the table is rebuilt unless it already has that many
+     * @param n Minimum number of buckets, raised to fit the current elements within the maximum load factor
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    void HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::rehash(size_type n) {
+        size_type buckets = _buckets_for(_size);
+
+        if (n > buckets) {
+            if (buckets < hash_table_group::width)
+                buckets = hash_table_group::width;
+            while (buckets < n)
+                buckets *= 2;
+        }
+        if (buckets != _bucket_count)
+            _rehash(buckets, overflow);
+    }
+
+    /**
+     * Request a capacity change, so that n elements fit without growing the table
+     * @param n Number of elements
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    void HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::reserve(size_type n) {
+        size_type buckets = _buckets_for(n);
+
+        if (buckets > _bucket_count)
+            _rehash(buckets, overflow);
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::hasher HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::hash_function() const {
+        return (_hash);
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::key_equal HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::key_eq() const {
+        return (_eq);
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Hash, typename KeyEqual, typename Alloc>
+    typename HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::allocator_type HashTable<Key, T, KeyOfValue, Hash, KeyEqual, Alloc>::get_allocator() const {
+        return (_alloc);
+    }
+
+}
+
+#endif //FT_CONTAINERS_HASH_TABLE_HPP
@@ -0,0 +1,188 @@
+#ifndef FT_CONTAINERS_BTREE_ITERATOR_HPP
+# define FT_CONTAINERS_BTREE_ITERATOR_HPP
+
+# include "iterator.hpp"
+# include "../btree.hpp"
+
+namespace ft {
+
+    /**
+     * B-tree iterator.
+     * Points to an element by its node and its index in the node. The end iterator is the position
+     * just past the last element of the rightmost leaf
+     * @tparam T         Tree elements type
+     * @tparam Pointer   Pointer type
+     * @tparam Reference Reference type
+     */
+    template<typename T, typename Pointer, typename Reference>
+    class btree_iterator {
+        BTreeNode<T> *_node;
+        size_t       _position;
+
+    public:
+        typedef T                          value_type;
+        typedef ptrdiff_t                  difference_type;
+        typedef Pointer                    pointer;
+        typedef Reference                  reference;
+        typedef bidirectional_iterator_tag iterator_category;
+
+        btree_iterator();
+        btree_iterator(BTreeNode<T> *node, size_t position);
+        template<typename SPointer, typename SReference>
+        btree_iterator(const btree_iterator<T, SPointer, SReference> &src);
+
+        ~btree_iterator();
+
+        template<typename SPointer, typename SReference>
+        btree_iterator       &operator=(const btree_iterator<T, SPointer, SReference> &other);
+
+        BTreeNode<T>         *baseNode() const;
+        size_t               position() const;
+
+        reference            operator*() const;
+        pointer              operator->() const;
+
+        btree_iterator       &operator++();
+        const btree_iterator operator++(int);
+
+        btree_iterator       &operator--();
+        const btree_iterator operator--(int);
+    };
+
+    template<typename T, typename Pointer, typename Reference>
+    btree_iterator<T, Pointer, Reference>::btree_iterator(): _node(NULL), _position(0) {}
+
+    /**
+     * Constructor from an element position
+     * @param node     Pointer to node
+     * @param position Index of the element in the node
+     */
+    template<typename T, typename Pointer, typename Reference>
+    btree_iterator<T, Pointer, Reference>::btree_iterator(BTreeNode<T> *node, size_t position): _node(node), _position(position) {}
+
+    template<typename T, typename Pointer, typename Reference>
+    template<typename SPointer, typename SReference>
+    btree_iterator<T, Pointer, Reference>::btree_iterator(const btree_iterator<T, SPointer, SReference> &src):
+                                                          _node(src.baseNode()), _position(src.position()) {}
+
+    template<typename T, typename Pointer, typename Reference>
+    btree_iterator<T, Pointer, Reference>::~btree_iterator() {}
+
+    template<typename T, typename Pointer, typename Reference>
+    template<typename SPointer, typename SReference>
+    btree_iterator<T, Pointer, Reference> &btree_iterator<T, Pointer, Reference>::operator=(const btree_iterator<T, SPointer, SReference> &other) {
+        _node = other.baseNode();
+        _position = other.position();
+        return (*this);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    BTreeNode<T> *btree_iterator<T, Pointer, Reference>::baseNode() const {
+        return (_node);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    size_t btree_iterator<T, Pointer, Reference>::position() const {
+        return (_position);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    typename btree_iterator<T, Pointer, Reference>::reference btree_iterator<T, Pointer, Reference>::operator*() const {
+        return (_node->value(_position));
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    typename btree_iterator<T, Pointer, Reference>::pointer btree_iterator<T, Pointer, Reference>::operator->() const {
+        return (_node->valptr(_position));
+    }
+
+    /**
+     * Move to the next element: the leftmost leaf of the next child in an internal node, the next index in a leaf.
+     * Past the end of a leaf, climb to the first ancestor that still has an element to the right;
+     * past the last element of the tree the iterator stays at the end of the rightmost leaf, which is end()
+     */
+    template<typename T, typename Pointer, typename Reference>
+    btree_iterator<T, Pointer, Reference> &btree_iterator<T, Pointer, Reference>::operator++() {
+        if (!_node->leaf) {
+            _node = _node->child(_position + 1);
+            while (!_node->leaf)
+                _node = _node->child(0);
+            _position = 0;
+            return (*this);
+        }
+        if (++_position < _node->count)
+            return (*this);
+
+        BTreeNode<T> *node = _node;
+        size_t       position = _position;
+
+        while (position == node->count && node->parent) {
+            position = node->position;
+            node = node->parent;
+        }
+        if (position < node->count) {
+            _node = node;
+            _position = position;
+        }
+        return (*this);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    const btree_iterator<T, Pointer, Reference> btree_iterator<T, Pointer, Reference>::operator++(int) {
+        btree_iterator it(*this);
+        ++(*this);
+        return (it);
+    }
+
+    /**
+     * Move to the previous element: the last element of the rightmost leaf of the previous child in an internal node,
+     * the previous index in a leaf, or the first ancestor that has an element to the left
+     */
+    template<typename T, typename Pointer, typename Reference>
+    btree_iterator<T, Pointer, Reference> &btree_iterator<T, Pointer, Reference>::operator--() {
+        if (!_node->leaf) {
+            _node = _node->child(_position);
+            while (!_node->leaf)
+                _node = _node->child(_node->count);
+            _position = _node->count - 1;
+            return (*this);
+        }
+        if (_position > 0) {
+            --_position;
+            return (*this);
+        }
+
+        BTreeNode<T> *node = _node;
+        size_t       position = 0;
+
+        while (position == 0 && node->parent) {
+            position = node->position;
+            node = node->parent;
+        }
+        if (position > 0) {
+            _node = node;
+            _position = position - 1;
+        }
+        return (*this);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    const btree_iterator<T, Pointer, Reference> btree_iterator<T, Pointer, Reference>::operator--(int) {
+        btree_iterator it(*this);
+        --(*this);
+        return (it);
+    }
+
+    template<typename T, typename LPointer, typename LReference, typename RPointer, typename RReference>
+    bool operator==(const btree_iterator<T, LPointer, LReference> &lhs, const btree_iterator<T, RPointer, RReference> &rhs) {
+        return (lhs.baseNode() == rhs.baseNode() && lhs.position() == rhs.position());
+    }
+
+    template<typename T, typename LPointer, typename LReference, typename RPointer, typename RReference>
+    bool operator!=(const btree_iterator<T, LPointer, LReference> &lhs, const btree_iterator<T, RPointer, RReference> &rhs) {
+        return (!(lhs == rhs));
+    }
+
+}
+
+#endif //FT_CONTAINERS_BTREE_ITERATOR_HPP
@@ -0,0 +1,217 @@
+#ifndef FT_CONTAINERS_FROZEN_ITERATOR_HPP
+# define FT_CONTAINERS_FROZEN_ITERATOR_HPP
+
+# include "iterator.hpp"
+# include "../frozen_tree.hpp"
+
+namespace ft {
+
+    /**
+     * In-order walk of a complete binary tree stored in Eytzinger order: the root at index 1,
+     * the children of index k at 2k and 2k + 1, indexes 1 to n used. Index 0 is past the end
+     */
+    struct eytzinger {
+        static size_t first(size_t n);
+        static size_t last(size_t n);
+        static size_t next(size_t k, size_t n);
+        static size_t prev(size_t k, size_t n);
+    };
+
+    /**
+     * Index of the smallest element, the leftmost node
+     */
+    inline size_t eytzinger::first(size_t n) {
+        size_t k = 1;
+
+        if (!n)
+            return (0);
+        while (2 * k <= n)
+            k = 2 * k;
+        return (k);
+    }
+
+    /**
+     * Index of the largest element, the rightmost node
+     */
+    inline size_t eytzinger::last(size_t n) {
+        size_t k = 1;
+
+        if (!n)
+            return (0);
+        while (2 * k + 1 <= n)
+            k = 2 * k + 1;
+        return (k);
+    }
+
+    /**
+     * Index of the in-order successor of k: the leftmost node of the right subtree,
+     * or the parent of the first ancestor that is a left child. 0 after the largest element
+     */
+    inline size_t eytzinger::next(size_t k, size_t n) {
+        if (2 * k + 1 <= n) {
+            k = 2 * k + 1;
+            while (2 * k <= n)
+                k = 2 * k;
+            return (k);
+        }
+        while (k & 1)
+            k >>= 1;
+        return (k >> 1);
+    }
+
+    /**
+     * Index of the in-order predecessor of k, the largest element for 0
+     */
+    inline size_t eytzinger::prev(size_t k, size_t n) {
+        if (!k)
+            return (last(n));
+        if (2 * k <= n) {
+            k = 2 * k;
+            while (2 * k + 1 <= n)
+                k = 2 * k + 1;
+            return (k);
+        }
+        while (k > 1 && !(k & 1))
+            k >>= 1;
+        return (k >> 1);
+    }
+
+    /**
+     * Frozen tree iterator.
+     * Points to an element by its index in the Eytzinger array and walks the implicit tree in key order
+     * @tparam T         Tree elements type
+     * @tparam Pointer   Pointer type
+     * @tparam Reference Reference type
+     */
+    template<typename T, typename Pointer, typename Reference>
+    class frozen_iterator {
+    public:
+        typedef T                          value_type;
+        typedef ptrdiff_t                  difference_type;
+        typedef Pointer                    pointer;
+        typedef Reference                  reference;
+        typedef bidirectional_iterator_tag iterator_category;
+
+    private:
+        pointer _data;
+        size_t  _index;
+        size_t  _size;
+
+    public:
+        frozen_iterator();
+        frozen_iterator(pointer data, size_t index, size_t size);
+        template<typename SPointer, typename SReference>
+        frozen_iterator(const frozen_iterator<T, SPointer, SReference> &src);
+
+        ~frozen_iterator();
+
+        template<typename SPointer, typename SReference>
+        frozen_iterator       &operator=(const frozen_iterator<T, SPointer, SReference> &other);
+
+        pointer               data() const;
+        size_t                index() const;
+        size_t                size() const;
+
+        reference             operator*() const;
+        pointer               operator->() const;
+
+        frozen_iterator       &operator++();
+        const frozen_iterator operator++(int);
+
+        frozen_iterator       &operator--();
+        const frozen_iterator operator--(int);
+    };
+
+    template<typename T, typename Pointer, typename Reference>
+    frozen_iterator<T, Pointer, Reference>::frozen_iterator(): _data(NULL), _index(0), _size(0) {}
+
+    /**
+     * Constructor from an element position
+     * @param data  Eytzinger array, index 0 unused
+     * @param index Index of the element, 0 for the end
+     * @param size  Number of elements
+     */
+    template<typename T, typename Pointer, typename Reference>
+    frozen_iterator<T, Pointer, Reference>::frozen_iterator(pointer data, size_t index, size_t size): _data(data), _index(index), _size(size) {}
+
+    template<typename T, typename Pointer, typename Reference>
+    template<typename SPointer, typename SReference>
+    frozen_iterator<T, Pointer, Reference>::frozen_iterator(const frozen_iterator<T, SPointer, SReference> &src):
+                                                            _data(src.data()), _index(src.index()), _size(src.size()) {}
+
+    template<typename T, typename Pointer, typename Reference>
+    frozen_iterator<T, Pointer, Reference>::~frozen_iterator() {}
+
+    template<typename T, typename Pointer, typename Reference>
+    template<typename SPointer, typename SReference>
+    frozen_iterator<T, Pointer, Reference> &frozen_iterator<T, Pointer, Reference>::operator=(const frozen_iterator<T, SPointer, SReference> &other) {
+        _data = other.data();
+        _index = other.index();
+        _size = other.size();
+        return (*this);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    typename frozen_iterator<T, Pointer, Reference>::pointer frozen_iterator<T, Pointer, Reference>::data() const {
+        return (_data);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    size_t frozen_iterator<T, Pointer, Reference>::index() const {
+        return (_index);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    size_t frozen_iterator<T, Pointer, Reference>::size() const {
+        return (_size);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    typename frozen_iterator<T, Pointer, Reference>::reference frozen_iterator<T, Pointer, Reference>::operator*() const {
+        return (_data[_index]);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    typename frozen_iterator<T, Pointer, Reference>::pointer frozen_iterator<T, Pointer, Reference>::operator->() const {
+        return (_data + _index);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    frozen_iterator<T, Pointer, Reference> &frozen_iterator<T, Pointer, Reference>::operator++() {
+        _index = eytzinger::next(_index, _size);
+        return (*this);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    const frozen_iterator<T, Pointer, Reference> frozen_iterator<T, Pointer, Reference>::operator++(int) {
+        frozen_iterator it(*this);
+        ++(*this);
+        return (it);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    frozen_iterator<T, Pointer, Reference> &frozen_iterator<T, Pointer, Reference>::operator--() {
+        _index = eytzinger::prev(_index, _size);
+        return (*this);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    const frozen_iterator<T, Pointer, Reference> frozen_iterator<T, Pointer, Reference>::operator--(int) {
+        frozen_iterator it(*this);
+        --(*this);
+        return (it);
+    }
+
+    template<typename T, typename LPointer, typename LReference, typename RPointer, typename RReference>
+    bool operator==(const frozen_iterator<T, LPointer, LReference> &lhs, const frozen_iterator<T, RPointer, RReference> &rhs) {
+        return (lhs.data() == rhs.data() && lhs.index() == rhs.index());
+    }
+
+    template<typename T, typename LPointer, typename LReference, typename RPointer, typename RReference>
+    bool operator!=(const frozen_iterator<T, LPointer, LReference> &lhs, const frozen_iterator<T, RPointer, RReference> &rhs) {
+        return (!(lhs == rhs));
+    }
+
+}
+
+#endif //FT_CONTAINERS_FROZEN_ITERATOR_HPP
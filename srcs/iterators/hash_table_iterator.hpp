@@ -0,0 +1,138 @@
+#ifndef FT_CONTAINERS_HASH_TABLE_ITERATOR_HPP
+# define FT_CONTAINERS_HASH_TABLE_ITERATOR_HPP
+
+# include "../iterator.hpp"
+
+namespace ft {
+
+    /**
+     * Control byte values of a hash table slot that holds no element.
+     * A full slot stores the low 7 bits of the hash of its element, a value from 0 to 127
+     */
+    enum hash_table_ctrl {
+        hash_table_empty = -128,
+        hash_table_sentinel = -1
+    };
+
+    /**
+     * Hash table iterator.
+     * Walks the slots in storage order next to their control bytes, skipping the empty slots.
+     * The control byte past the last slot is the sentinel, where the walk stops
+     * @tparam T         Table elements type
+     * @tparam Pointer   Pointer type
+     * @tparam Reference Reference type
+     */
+    template<typename T, typename Pointer, typename Reference>
+    class hash_table_iterator {
+        T                 *_slot;
+        const signed char *_ctrl;
+
+    public:
+        typedef T                    value_type;
+        typedef ptrdiff_t            difference_type;
+        typedef Pointer              pointer;
+        typedef Reference            reference;
+        typedef forward_iterator_tag iterator_category;
+
+        hash_table_iterator();
+        hash_table_iterator(T *slot, const signed char *ctrl);
+        template<typename SPointer, typename SReference>
+        hash_table_iterator(const hash_table_iterator<T, SPointer, SReference> &src);
+
+        ~hash_table_iterator();
+
+        template<typename SPointer, typename SReference>
+        hash_table_iterator       &operator=(const hash_table_iterator<T, SPointer, SReference> &other);
+
+        T                         *slot() const;
+        const signed char         *ctrl() const;
+
+        reference                 operator*() const;
+        pointer                   operator->() const;
+
+        hash_table_iterator       &operator++();
+        const hash_table_iterator operator++(int);
+    };
+
+    template<typename T, typename Pointer, typename Reference>
+    hash_table_iterator<T, Pointer, Reference>::hash_table_iterator(): _slot(NULL), _ctrl(NULL) {}
+
+    /**
+     * Constructor from a slot, moves forward to the first full slot or to the sentinel
+     * @param slot Pointer to a slot
+     * @param ctrl Pointer to the control byte of the slot
+     */
+    template<typename T, typename Pointer, typename Reference>
+    hash_table_iterator<T, Pointer, Reference>::hash_table_iterator(T *slot, const signed char *ctrl): _slot(slot), _ctrl(ctrl) {
+        while (*_ctrl == hash_table_empty) {
+            ++_slot;
+            ++_ctrl;
+        }
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    template<typename SPointer, typename SReference>
+    hash_table_iterator<T, Pointer, Reference>::hash_table_iterator(const hash_table_iterator<T, SPointer, SReference> &src):
+                                                                    _slot(src.slot()), _ctrl(src.ctrl()) {}
+
+    template<typename T, typename Pointer, typename Reference>
+    hash_table_iterator<T, Pointer, Reference>::~hash_table_iterator() {}
+
+    template<typename T, typename Pointer, typename Reference>
+    template<typename SPointer, typename SReference>
+    hash_table_iterator<T, Pointer, Reference> &
+    hash_table_iterator<T, Pointer, Reference>::operator=(const hash_table_iterator<T, SPointer, SReference> &other) {
+        _slot = other.slot();
+        _ctrl = other.ctrl();
+        return (*this);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    T *hash_table_iterator<T, Pointer, Reference>::slot() const {
+        return (_slot);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    const signed char *hash_table_iterator<T, Pointer, Reference>::ctrl() const {
+        return (_ctrl);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    typename hash_table_iterator<T, Pointer, Reference>::reference hash_table_iterator<T, Pointer, Reference>::operator*() const {
+        return (*_slot);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    typename hash_table_iterator<T, Pointer, Reference>::pointer hash_table_iterator<T, Pointer, Reference>::operator->() const {
+        return (_slot);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    hash_table_iterator<T, Pointer, Reference> &hash_table_iterator<T, Pointer, Reference>::operator++() {
+        do {
+            ++_slot;
+            ++_ctrl;
+        } while (*_ctrl == hash_table_empty);
+        return (*this);
+    }
+
+    template<typename T, typename Pointer, typename Reference>
+    const hash_table_iterator<T, Pointer, Reference> hash_table_iterator<T, Pointer, Reference>::operator++(int) {
+        hash_table_iterator it(*this);
+        ++(*this);
+        return (it);
+    }
+
+    template<typename T, typename LPointer, typename LReference, typename RPointer, typename RReference>
+    bool operator==(const hash_table_iterator<T, LPointer, LReference> &lhs, const hash_table_iterator<T, RPointer, RReference> &rhs) {
+        return (lhs.ctrl() == rhs.ctrl());
+    }
+
+    template<typename T, typename LPointer, typename LReference, typename RPointer, typename RReference>
+    bool operator!=(const hash_table_iterator<T, LPointer, LReference> &lhs, const hash_table_iterator<T, RPointer, RReference> &rhs) {
+        return (!(lhs == rhs));
+    }
+
+}
+
+#endif //FT_CONTAINERS_HASH_TABLE_ITERATOR_HPP
@@ -14,7 +14,7 @@ namespace ft {
      */
     template<typename T, typename Pointer, typename Reference>
     class list_iterator {
-        friend class list<T>;
+        template<typename U, typename Alloc> friend class list;
 
         ListNode <T> *_node;
 
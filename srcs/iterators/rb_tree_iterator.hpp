@@ -7,7 +7,8 @@
 namespace ft {
 
     /**
-     * Red-black tree iterator
+     * Red-black tree iterator.
+     * The end node is the only node without a parent, its right child is the last node of the tree
      * @tparam T         Tree elements type
      * @tparam Pointer   Pointer type
      * @tparam Reference Reference type
@@ -77,12 +78,12 @@ namespace ft {
 
     template<typename T, typename Pointer, typename Reference>
     typename rb_tree_iterator<T, Pointer, Reference>::reference rb_tree_iterator<T, Pointer, Reference>::operator*() const {
-        return (*_node->value);
+        return (_node->value());
     }
 
     template<typename T, typename Pointer, typename Reference>
     typename rb_tree_iterator<T, Pointer, Reference>::pointer rb_tree_iterator<T, Pointer, Reference>::operator->() const {
-        return (_node->value);
+        return (_node->valptr());
     }
 
     template<typename T, typename Pointer, typename Reference>
@@ -95,11 +96,11 @@ namespace ft {
                 _node = _node->left;
         } else {
             p = _node->parent;
-            while (p && _node == p->right) {
+            while (p->parent && _node == p->right) {
                 _node = p;
                 p = p->parent;
             }
-            _node = _node->parent;
+            _node = p;
         }
 
         return (*this);
@@ -116,7 +117,9 @@ namespace ft {
     rb_tree_iterator<T, Pointer, Reference> &rb_tree_iterator<T, Pointer, Reference>::operator--() {
         RBTreeNode<T> *p;
 
-        if (_node->left) {
+        if (!_node->parent) {
+            _node = _node->right;
+        } else if (_node->left) {
             _node = _node->left;
             while (_node->right)
                 _node = _node->right;
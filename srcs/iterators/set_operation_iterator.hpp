@@ -0,0 +1,184 @@
+#ifndef FT_CONTAINERS_SET_OPERATION_ITERATOR_HPP
+# define FT_CONTAINERS_SET_OPERATION_ITERATOR_HPP
+
+# include "../iterator.hpp"
+
+namespace ft {
+
+    /**
+     * Operation of a set_operation_iterator
+     */
+    enum set_operation {
+        set_union_op,
+        set_intersection_op,
+        set_difference_op,
+        set_symmetric_difference_op
+    };
+
+    /**
+     * Input iterator over the union, intersection, difference or symmetric difference of two sorted ranges.
+     * Both ranges are merged lazily in one pass, so walking the result takes linear time and no buffer.
+     * An element present in both ranges is taken from the first one
+     * @tparam InputIterator1 Iterator of the first range
+     * @tparam InputIterator2 Iterator of the second range, with the same value type
+     * @tparam Compare        A binary predicate the ranges are sorted by
+     */
+    template<typename InputIterator1, typename InputIterator2, typename Compare>
+    class set_operation_iterator {
+    public:
+        typedef typename iterator_traits<InputIterator1>::value_type      value_type;
+        typedef typename iterator_traits<InputIterator1>::difference_type difference_type;
+        typedef const value_type                                          *pointer;
+        typedef const value_type                                          &reference;
+        typedef input_iterator_tag                                        iterator_category;
+
+    private:
+        set_operation  _op;
+        InputIterator1 _first1;
+        InputIterator1 _last1;
+        InputIterator2 _first2;
+        InputIterator2 _last2;
+        Compare        _comp;
+        int            _from;
+
+        void                         _settle();
+
+    public:
+        set_operation_iterator(set_operation op, InputIterator1 first1, InputIterator1 last1,
+                               InputIterator2 first2, InputIterator2 last2, const Compare &comp);
+
+        bool                         equal(const set_operation_iterator &other) const;
+
+        reference                    operator*() const;
+        pointer                      operator->() const;
+
+        set_operation_iterator       &operator++();
+        const set_operation_iterator operator++(int);
+    };
+
+    /**
+     * Constructor, positions the iterator at the first element of the result.
+     * The past-the-end iterator of a result is built from the ends of both ranges
+     * @param op     Operation
+     * @param first1 Start of the first range
+     * @param last1  End of the first range
+     * @param first2 Start of the second range
+     * @param last2  End of the second range
+     * @param comp   Binary predicate both ranges are sorted by
+     */
+    template<typename InputIterator1, typename InputIterator2, typename Compare>
+    set_operation_iterator<InputIterator1, InputIterator2, Compare>::set_operation_iterator(set_operation op,
+                                                                                            InputIterator1 first1, InputIterator1 last1,
+                                                                                            InputIterator2 first2, InputIterator2 last2,
+                                                                                            const Compare &comp):
+                                                                                            _op(op), _first1(first1), _last1(last1),
+                                                                                            _first2(first2), _last2(last2),
+                                                                                            _comp(comp), _from(0) {
+        _settle();
+    }
+
+    /**
+     * Skip the elements that are not part of the result.
+     * Once the result is exhausted both ranges are moved to their end, so it compares equal to the end iterator
+     */
+    template<typename InputIterator1, typename InputIterator2, typename Compare>
+    void set_operation_iterator<InputIterator1, InputIterator2, Compare>::_settle() {
+        bool keep_first = _op != set_intersection_op;
+        bool keep_second = _op == set_union_op || _op == set_symmetric_difference_op;
+        bool keep_both = _op == set_union_op || _op == set_intersection_op;
+
+        while (true) {
+            if (_first1 == _last1) {
+                if (_first2 == _last2 || !keep_second) {
+                    _first2 = _last2;
+                    _from = 0;
+                } else {
+                    _from = 2;
+                }
+                return;
+            }
+            if (_first2 == _last2) {
+                if (!keep_first)
+                    _first1 = _last1;
+                _from = keep_first ? 1 : 0;
+                return;
+            }
+
+            if (_comp(*_first1, *_first2)) {
+                _from = 1;
+                if (keep_first)
+                    return;
+                ++_first1;
+            } else if (_comp(*_first2, *_first1)) {
+                _from = 2;
+                if (keep_second)
+                    return;
+                ++_first2;
+            } else {
+                _from = 3;
+                if (keep_both)
+                    return;
+                ++_first1;
+                ++_first2;
+            }
+        }
+    }
+
+    /**
+     * Compare positions
+     * @param other Iterator over the same ranges
+     * @return true if both iterators are at the same position in both ranges
+     */
+    template<typename InputIterator1, typename InputIterator2, typename Compare>
+    bool set_operation_iterator<InputIterator1, InputIterator2, Compare>::equal(const set_operation_iterator &other) const {
+        return (_first1 == other._first1 && _first2 == other._first2);
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename Compare>
+    typename set_operation_iterator<InputIterator1, InputIterator2, Compare>::reference
+    set_operation_iterator<InputIterator1, InputIterator2, Compare>::operator*() const {
+        if (_from == 2)
+            return (*_first2);
+        return (*_first1);
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename Compare>
+    typename set_operation_iterator<InputIterator1, InputIterator2, Compare>::pointer
+    set_operation_iterator<InputIterator1, InputIterator2, Compare>::operator->() const {
+        return (&(operator*()));
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename Compare>
+    set_operation_iterator<InputIterator1, InputIterator2, Compare> &
+    set_operation_iterator<InputIterator1, InputIterator2, Compare>::operator++() {
+        if (_from & 1)
+            ++_first1;
+        if (_from & 2)
+            ++_first2;
+        _settle();
+        return (*this);
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename Compare>
+    const set_operation_iterator<InputIterator1, InputIterator2, Compare>
+    set_operation_iterator<InputIterator1, InputIterator2, Compare>::operator++(int) {
+        set_operation_iterator it(*this);
+        ++(*this);
+        return (it);
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename Compare>
+    bool operator==(const set_operation_iterator<InputIterator1, InputIterator2, Compare> &lhs,
+                    const set_operation_iterator<InputIterator1, InputIterator2, Compare> &rhs) {
+        return (lhs.equal(rhs));
+    }
+
+    template<typename InputIterator1, typename InputIterator2, typename Compare>
+    bool operator!=(const set_operation_iterator<InputIterator1, InputIterator2, Compare> &lhs,
+                    const set_operation_iterator<InputIterator1, InputIterator2, Compare> &rhs) {
+        return (!lhs.equal(rhs));
+    }
+
+}
+
+#endif //FT_CONTAINERS_SET_OPERATION_ITERATOR_HPP
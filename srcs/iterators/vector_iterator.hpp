@@ -26,14 +26,16 @@ namespace ft {
         vector_iterator();
         explicit vector_iterator(pointer p);
         template<typename SPointer, typename SReference>
-        explicit vector_iterator(const vector_iterator<T, SPointer, SReference> &src);
+        vector_iterator(const vector_iterator<T, SPointer, SReference> &src,
+                        typename enable_if<is_convertible<SPointer, Pointer>::value>::type * = NULL);
 
         ~vector_iterator();
 
         pointer               base() const;
 
         template<typename SPointer, typename SReference>
-        vector_iterator       &operator=(vector_iterator<T, SPointer, SReference> const &other);
+        typename enable_if<is_convertible<SPointer, Pointer>::value, vector_iterator &>::type
+                              operator=(vector_iterator<T, SPointer, SReference> const &other);
 
         reference             operator*() const;
         pointer               operator->() const;
@@ -63,9 +65,14 @@ namespace ft {
     template<typename T, typename Pointer, typename Reference>
     vector_iterator<T, Pointer, Reference>::vector_iterator(pointer p): _p(p) {}
 
+    /**
+     * Conversion from another iterator of the same vector, only from iterator to const_iterator
+     * @param src Iterator to convert
+     */
     template<typename T, typename Pointer, typename Reference>
     template<typename SPointer, typename SReference>
-    vector_iterator<T, Pointer, Reference>::vector_iterator(const vector_iterator<T, SPointer, SReference> &src): _p(src.base()) {}
+    vector_iterator<T, Pointer, Reference>::vector_iterator(const vector_iterator<T, SPointer, SReference> &src,
+            typename enable_if<is_convertible<SPointer, Pointer>::value>::type *): _p(src.base()) {}
 
     template<typename T, typename Pointer, typename Reference>
     vector_iterator<T, Pointer, Reference>::~vector_iterator() {}
@@ -77,7 +84,8 @@ namespace ft {
 
     template<typename T, typename Pointer, typename Reference>
     template<typename SPointer, typename SReference>
-    vector_iterator<T, Pointer, Reference> &vector_iterator<T, Pointer, Reference>::operator=(const vector_iterator<T, SPointer, SReference> &other) {
+    typename enable_if<is_convertible<SPointer, Pointer>::value, vector_iterator<T, Pointer, Reference> &>::type
+    vector_iterator<T, Pointer, Reference>::operator=(const vector_iterator<T, SPointer, SReference> &other) {
         this->_p = other.base();
         return (*this);
     }
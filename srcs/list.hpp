@@ -8,6 +8,7 @@ namespace ft {
 
 # include <memory>
 # include "type_traits.hpp"
+# include "utility.hpp"
 # include "iterators/list_iterator.hpp"
 
 namespace ft {
@@ -42,13 +43,18 @@ namespace ft {
         typedef size_t                                              size_type;
 
     private:
-        typedef std::allocator< ListNode<T> > node_allocator_type;
+        typedef typename Alloc::template rebind< ListNode<T> >::other node_allocator_type;
 
         allocator_type      _alloc;
         node_allocator_type _node_alloc;
         ListNode<T>         *_last;
 
-        ListNode<T>   *_createNode(value_type value);
+# if FT_CXX11
+        template<typename... Args>
+        ListNode<T>   *_createNode(Args&&... args);
+# else
+        ListNode<T>   *_createNode(const value_type &value);
+# endif
         ListNode<T>   *_createEndNode();
         void        _clearNode(ListNode<T> *node);
         void        _clear();
@@ -65,10 +71,16 @@ namespace ft {
         list(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(),
              typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type * = NULL);
         list(const list &x);
+# if FT_CXX11
+        list(list &&x);
+# endif
 
         ~list();
 
         list &operator=(const list &other);
+# if FT_CXX11
+        list &operator=(list &&other);
+# endif
 
         iterator               begin();
         const_iterator         begin() const;
@@ -98,12 +110,27 @@ namespace ft {
         void                   assign(size_type n, const value_type &val);
 
         void                   push_front(const value_type &val);
+# if FT_CXX11
+        void                   push_front(value_type &&val);
+        template<typename... Args>
+        reference              emplace_front(Args&&... args);
+# endif
         void                   pop_front();
 
         void                   push_back(const value_type &val);
+# if FT_CXX11
+        void                   push_back(value_type &&val);
+        template<typename... Args>
+        reference              emplace_back(Args&&... args);
+# endif
         void                   pop_back();
 
         iterator               insert(iterator position, const value_type &val);
+# if FT_CXX11
+        iterator               insert(iterator position, value_type &&val);
+        template<typename... Args>
+        iterator               emplace(iterator position, Args&&... args);
+# endif
         void                   insert(iterator position, size_type n, const value_type &val);
         template<typename InputIterator>
         void                   insert(iterator position, InputIterator first, InputIterator last,
@@ -141,15 +168,30 @@ namespace ft {
         allocator_type         get_allocator() const;
     };
 
+# if FT_CXX11
     /**
      * Creates and returns new list node
-     * @param value RBTreeNode value
-     * @param next  Next node pointer
-     * @param prev  Previous node pointer
+     * @param args Arguments forwarded to the constructor of the node value
+     * @return     Created node
+     */
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    ListNode<T> *list<T, Alloc>::_createNode(Args&&... args) {
+        ListNode<T> *node = _node_alloc.allocate(1);
+        node->value = _alloc.allocate(1);
+        ft::allocator_construct(_alloc, node->value, std::forward<Args>(args)...);
+        node->next = NULL;
+        node->prev = NULL;
+        return (node);
+    }
+# else
+    /**
+     * Creates and returns new list node
+     * @param value Node value
      * @return      Created node
      */
     template<typename T, typename Alloc>
-    ListNode<T> *list<T, Alloc>::_createNode(value_type value) {
+    ListNode<T> *list<T, Alloc>::_createNode(const value_type &value) {
         ListNode<T> *node = _node_alloc.allocate(1);
         node->value = _alloc.allocate(1);
         _alloc.construct(node->value, value);
@@ -157,6 +199,7 @@ namespace ft {
         node->prev = NULL;
         return (node);
     }
+# endif
 
     /**
      * Creates and returns past the end node
@@ -231,7 +274,7 @@ namespace ft {
         }
 
         slow++;
-        list *second = new list();
+        list *second = new list(_alloc);
         second->splice(second->end(), *this, slow, end());
         return (second);
     }
@@ -257,7 +300,7 @@ namespace ft {
     }
 
     template<typename T, typename Alloc>
-    list<T, Alloc>::list(const allocator_type &alloc): _alloc(alloc) {
+    list<T, Alloc>::list(const allocator_type &alloc): _alloc(alloc), _node_alloc(alloc) {
         _last = _createEndNode();
     }
 
@@ -268,7 +311,7 @@ namespace ft {
      * @param alloc Allocator
      */
     template<typename T, typename Alloc>
-    list<T, Alloc>::list(list::size_type n, const value_type &val, const allocator_type &alloc): _alloc(alloc) {
+    list<T, Alloc>::list(list::size_type n, const value_type &val, const allocator_type &alloc): _alloc(alloc), _node_alloc(alloc) {
             _last = _createEndNode();
             insert(end(), n, val);
     }
@@ -282,17 +325,29 @@ namespace ft {
     template<typename T, typename Alloc>
     template<class InputIterator>
     list<T, Alloc>::list(InputIterator first, InputIterator last, const allocator_type &alloc,
-                         typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type *): _alloc(alloc) {
+                         typename ft::enable_if<!ft::is_integral<InputIterator>::value>::type *): _alloc(alloc), _node_alloc(alloc) {
         _last = _createEndNode();
         insert(end(), first, last);
     }
 
     template<typename T, typename Alloc>
-    list<T, Alloc>::list(const list &x): _alloc(x._alloc) {
+    list<T, Alloc>::list(const list &x): _alloc(x._alloc), _node_alloc(x._node_alloc) {
         _last = _createEndNode();
         insert(end(), x.begin(), x.end());
     }
 
+# if FT_CXX11
+    /**
+     * Move constructor, takes over the nodes of x and leaves it empty
+     * @param x Another list object of the same type
+     */
+    template<typename T, typename Alloc>
+    list<T, Alloc>::list(list &&x): _alloc(x._alloc), _node_alloc(x._node_alloc) {
+        _last = _createEndNode();
+        splice(end(), x);
+    }
+# endif
+
     template<typename T, typename Alloc>
     list<T, Alloc>::~list() {
         _clear();
@@ -302,16 +357,46 @@ namespace ft {
         _node_alloc.deallocate(_last, 1);
     }
 
+    /**
+     * Copy container content.
+     * The elements both lists have are assigned in place, so nodes are allocated only for the elements other
+     * has in excess, and deallocated only if the list had more elements than other
+     * @param other A list object of the same type
+     * @return *this
+     */
     template<typename T, typename Alloc>
     list<T, Alloc> &list<T, Alloc>::operator=(const list &other) {
         if (this == &other)
             return (*this);
 
+        iterator       it = begin();
+        const_iterator src = other.begin();
+
+        for (; it != end() && src != other.end(); it++, src++)
+            *it = *src;
+        if (src == other.end())
+            erase(it, end());
+        else
+            insert(end(), src, other.end());
+
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     */
+    template<typename T, typename Alloc>
+    list<T, Alloc> &list<T, Alloc>::operator=(list &&other) {
+        if (this == &other)
+            return (*this);
+
         _clear();
-        insert(end(), other.begin(), other.end());
+        swap(other);
 
         return (*this);
     }
+# endif
 
     /**
      * Return iterator to beginning
@@ -487,6 +572,28 @@ namespace ft {
         insert(begin(), val);
     }
 
+# if FT_CXX11
+    /**
+     * Insert element at beginning
+     * @param val Value to be moved to the inserted element
+     */
+    template<typename T, typename Alloc>
+    void list<T, Alloc>::push_front(value_type &&val) {
+        insert(begin(), std::move(val));
+    }
+
+    /**
+     * Construct element in place at beginning
+     * @param args Arguments forwarded to the constructor of the new element
+     * @return A reference to the new element
+     */
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    typename list<T, Alloc>::reference list<T, Alloc>::emplace_front(Args&&... args) {
+        return (*emplace(begin(), std::forward<Args>(args)...));
+    }
+# endif
+
     /**
      * Delete first element
      */
@@ -504,6 +611,28 @@ namespace ft {
         insert(end(), val);
     }
 
+# if FT_CXX11
+    /**
+     * Add element at the end
+     * @param val Value to be moved to the new element
+     */
+    template<typename T, typename Alloc>
+    void list<T, Alloc>::push_back(value_type &&val) {
+        insert(end(), std::move(val));
+    }
+
+    /**
+     * Construct element in place at the end
+     * @param args Arguments forwarded to the constructor of the new element
+     * @return A reference to the new element
+     */
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    typename list<T, Alloc>::reference list<T, Alloc>::emplace_back(Args&&... args) {
+        return (*emplace(end(), std::forward<Args>(args)...));
+    }
+# endif
+
     /**
      * Delete last element
      */
@@ -533,6 +662,35 @@ namespace ft {
         return (--position);
     }
 
+# if FT_CXX11
+    /**
+     * Inserts new element before the element at the specified position
+     * @param position Position in the container where the new element inserted
+     * @param val      Value to be moved to the new element
+     * @return An iterator that points to the newly inserted element
+     */
+    template<typename T, typename Alloc>
+    typename list<T, Alloc>::iterator list<T, Alloc>::insert(list::iterator position, value_type &&val) {
+        return (emplace(position, std::move(val)));
+    }
+
+    /**
+     * Constructs new element in place before the element at the specified position
+     * @param position Position in the container where the new element inserted
+     * @param args     Arguments forwarded to the constructor of the new element
+     * @return An iterator that points to the newly inserted element
+     */
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    typename list<T, Alloc>::iterator list<T, Alloc>::emplace(list::iterator position, Args&&... args) {
+        ListNode<value_type> *newNode = _createNode(std::forward<Args>(args)...);
+
+        _insertNodeBefore(position._node, newNode);
+
+        return (iterator(newNode));
+    }
+# endif
+
     /**
      * Inserts n new elements before the element at the specified position
      * @param position Position in the container where the new elements are inserted
@@ -590,10 +748,8 @@ namespace ft {
      */
     template<typename T, typename Alloc>
     typename list<T, Alloc>::iterator list<T, Alloc>::erase(list::iterator first, list::iterator last) {
-        list::iterator it;
-        for (it = first; it != last; it++) {
-            erase(it);
-        }
+        while (first != last)
+            first = erase(first);
 
         return (last);
     }
@@ -699,10 +855,12 @@ namespace ft {
      */
     template<typename T, typename Alloc>
     void list<T, Alloc>::remove(const value_type &val) {
-        for (iterator it = begin(); it != end(); it++) {
-            if (*it == val) {
-                erase(it);
-            }
+        iterator it = begin();
+        while (it != end()) {
+            if (*it == val)
+                it = erase(it);
+            else
+                it++;
         }
     }
 
@@ -716,10 +874,12 @@ namespace ft {
     template<typename T, typename Alloc>
     template<typename Predicate>
     void list<T, Alloc>::remove_if(Predicate pred) {
-        for (iterator it = begin(); it != end(); it++) {
-            if (pred(*it)) {
-                erase(it);
-            }
+        iterator it = begin();
+        while (it != end()) {
+            if (pred(*it))
+                it = erase(it);
+            else
+                it++;
         }
     }
 
@@ -729,10 +889,12 @@ namespace ft {
      */
     template<typename T, typename Alloc>
     void list<T, Alloc>::unique() {
-        for (iterator it = ++begin(); it != end(); it++) {
-            if (*it == *it._node->prev->value) {
-                erase(it);
-            }
+        iterator it = ++begin();
+        while (it != end()) {
+            if (*it == *it._node->prev->value)
+                it = erase(it);
+            else
+                it++;
         }
     }
 
@@ -745,10 +907,12 @@ namespace ft {
     template<typename T, typename Alloc>
     template<typename BinaryPredicate>
     void list<T, Alloc>::unique(BinaryPredicate binary_pred) {
-        for (iterator it = ++begin(); it != end(); it++) {
-            if (binary_pred(*it, *it._node->prev->value)) {
-                erase(it);
-            }
+        iterator it = ++begin();
+        while (it != end()) {
+            if (binary_pred(*it, *it._node->prev->value))
+                it = erase(it);
+            else
+                it++;
         }
     }
 
@@ -3,20 +3,75 @@
 
 # include <memory>
 # include "utility.hpp"
+# include "algorithm.hpp"
 # include "functional.hpp"
 # include "rb_tree.hpp"
 # include "iterator.hpp"
 
 namespace ft {
 
+    /**
+     * Node handle of ft::map, an rb_tree_node_handle that also gives access to the key and the mapped value.
+     * The key can be changed while the node is out of any map
+     * @tparam Key        Type of the keys
+     * @tparam T          Type of the mapped value
+     * @tparam NodeHandle Node handle type of the tree of the map
+     */
+    template<typename Key, typename T, typename NodeHandle>
+    class map_node_handle: public NodeHandle {
+    public:
+        typedef Key key_type;
+        typedef T   mapped_type;
+
+        map_node_handle();
+        map_node_handle(const NodeHandle &src);
+
+        key_type    &key() const;
+        mapped_type &mapped() const;
+    };
+
+    /**
+     * Construct an empty handle
+     */
+    template<typename Key, typename T, typename NodeHandle>
+    map_node_handle<Key, T, NodeHandle>::map_node_handle(): NodeHandle() {}
+
+    /**
+     * Take the node of a tree node handle, src is left empty
+     * @param src Node handle of the tree
+     */
+    template<typename Key, typename T, typename NodeHandle>
+    map_node_handle<Key, T, NodeHandle>::map_node_handle(const NodeHandle &src): NodeHandle(src) {}
+
+    /**
+     * Access the key of the element, the handle must not be empty
+     * @return A modifiable reference to the key
+     */
+    template<typename Key, typename T, typename NodeHandle>
+    typename map_node_handle<Key, T, NodeHandle>::key_type &map_node_handle<Key, T, NodeHandle>::key() const {
+        return (const_cast<key_type&>(this->value().first));
+    }
+
+    /**
+     * Access the mapped value of the element, the handle must not be empty
+     * @return A reference to the mapped value
+     */
+    template<typename Key, typename T, typename NodeHandle>
+    typename map_node_handle<Key, T, NodeHandle>::mapped_type &map_node_handle<Key, T, NodeHandle>::mapped() const {
+        return (this->value().second);
+    }
+
     /**
      * Associative container that store elements formed by a combination of a key value and a mapped value, following a specific order
-     * @tparam Key     Type of the keys
-     * @tparam T       Type of the mapped value
-     * @tparam Compare A binary predicate that takes two element keys as arguments and returns a bool
-     * @tparam Alloc   Type of the allocator object used to define the storage allocation model
+     * @tparam Key        Type of the keys
+     * @tparam T          Type of the mapped value
+     * @tparam Compare    A binary predicate that takes two element keys as arguments and returns a bool
+     * @tparam Alloc      Type of the allocator object used to define the storage allocation model
+     * @tparam NodePolicy ft::no_order_statistics, or ft::order_statistics for nth, rank and count_range in O(log n)
+     *                    at the cost of one more word per node
      */
-    template< typename Key, typename T, typename Compare = less<Key>, typename Alloc = std::allocator< pair<const Key, T> > >
+    template< typename Key, typename T, typename Compare = less<Key>, typename Alloc = std::allocator< pair<const Key, T> >,
+              typename NodePolicy = no_order_statistics >
     class map {
     public:
         typedef Key                                                                                key_type;
@@ -29,7 +84,6 @@ namespace ft {
         typedef typename allocator_type::pointer                                                   pointer;
         typedef typename allocator_type::const_pointer                                             const_pointer;
 
-    private:
         /**
          * Value comparison object
          */
@@ -48,26 +102,46 @@ namespace ft {
             bool operator()(const value_type &x, const value_type &y) const;
         };
 
-        RBTree<value_type, value_compare, allocator_type> _tree;
+    private:
+        typedef RBTree<key_type, value_type, ft::select1st<value_type>, key_compare, allocator_type, NodePolicy> tree_type;
+
+        tree_type _tree;
+
+# if FT_CXX11
+        template<typename K, typename U, typename C, typename A, typename P>
+        friend void assign_set_operation(parallel_t policy, set_operation op, const map<K, U, C, A, P> &x,
+                                         const map<K, U, C, A, P> &y, map<K, U, C, A, P> &result);
+# endif
 
     public:
-        typedef typename RBTree<value_type, value_compare, allocator_type>::iterator               iterator;
-        typedef typename RBTree<value_type, value_compare, allocator_type>::const_iterator         const_iterator;
-        typedef typename RBTree<value_type, value_compare, allocator_type>::reverse_iterator       reverse_iterator;
-        typedef typename RBTree<value_type, value_compare, allocator_type>::const_reverse_iterator const_reverse_iterator;
-        typedef typename RBTree<value_type, value_compare, allocator_type>::difference_type        difference_type;
-        typedef typename RBTree<value_type, value_compare, allocator_type>::size_type              size_type;
+        typedef typename tree_type::iterator                                                      iterator;
+        typedef typename tree_type::const_iterator                                                const_iterator;
+        typedef typename tree_type::reverse_iterator                                              reverse_iterator;
+        typedef typename tree_type::const_reverse_iterator                                        const_reverse_iterator;
+        typedef typename tree_type::difference_type                                               difference_type;
+        typedef typename tree_type::size_type                                                     size_type;
+        typedef map_node_handle<key_type, mapped_type, typename tree_type::node_handle_type>      node_type;
+        typedef node_insert_return<iterator, node_type>                                           insert_return_type;
 
         explicit map(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
         template<typename InputIterator>
         map(InputIterator first, InputIterator last,
             const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type(),
             typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        map(assume_sorted_t, InputIterator first, InputIterator last,
+            const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
         map(const map &src);
+# if FT_CXX11
+        map(map &&src);
+# endif
 
         ~map();
 
         map                                  &operator=(const map &other);
+# if FT_CXX11
+        map                                  &operator=(map &&other);
+# endif
 
         iterator                             begin();
         const_iterator                       begin() const;
@@ -89,17 +163,40 @@ namespace ft {
 
         pair<iterator, bool>                 insert(const value_type &val);
         iterator                             insert(iterator position, const value_type &val);
+# if FT_CXX11
+        pair<iterator, bool>                 insert(value_type &&val);
+        iterator                             insert(iterator position, value_type &&val);
+        template<typename... Args>
+        pair<iterator, bool>                 emplace(Args&&... args);
+        template<typename... Args>
+        iterator                             emplace_hint(iterator position, Args&&... args);
+        template<typename... Args>
+        pair<iterator, bool>                 try_emplace(const key_type &k, Args&&... args);
+        template<typename... Args>
+        pair<iterator, bool>                 try_emplace(key_type &&k, Args&&... args);
+# endif
         template<typename InputIterator>
         void                                 insert(InputIterator first, InputIterator last,
                                     typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        void                                 insert(assume_sorted_t, InputIterator first, InputIterator last);
+        insert_return_type                   insert(const node_type &nh);
+        iterator                             insert(iterator position, const node_type &nh);
 
         void                                 erase(iterator position);
         size_type                            erase(const key_type &k);
         void                                 erase(iterator first, iterator last);
 
+        node_type                            extract(iterator position);
+        node_type                            extract(const key_type &k);
+
         void                                 swap(map &x);
         void                                 clear();
 
+        void                                 split(const key_type &k, map &x);
+        void                                 join(map &x);
+        void                                 merge(map &x);
+
         key_compare                          key_comp() const;
         value_compare                        value_comp() const;
 
@@ -117,14 +214,55 @@ namespace ft {
         pair<iterator, iterator>             equal_range(const key_type &k);
         pair<const_iterator, const_iterator> equal_range(const key_type &k) const;
 
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                             find(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+                                             find(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+                                             count(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                             lower_bound(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+                                             lower_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                             upper_bound(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, const_iterator>::type
+                                             upper_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<iterator, iterator> >::type
+                                             equal_range(const K &k);
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<const_iterator, const_iterator> >::type
+                                             equal_range(const K &k) const;
+
+        template<typename ForwardIterator, typename OutputIterator>
+        OutputIterator                       find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out);
+        template<typename ForwardIterator, typename OutputIterator>
+        OutputIterator                       find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const;
+
         allocator_type                       get_allocator() const;
+
+        iterator                             nth(size_type n);
+        const_iterator                       nth(size_type n) const;
+        size_type                            rank(const key_type &k) const;
+        size_type                            count_range(const key_type &lo, const key_type &hi) const;
+
+        size_type                            height() const;
+        bool                                 verify() const;
     };
 
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    map<Key, T, Compare, Alloc>::value_compare::value_compare(Compare c): _comp(c) {}
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    map<Key, T, Compare, Alloc, NodePolicy>::value_compare::value_compare(Compare c): _comp(c) {}
 
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    bool map<Key, T, Compare, Alloc>::value_compare::operator()(const value_type &x, const value_type &y) const {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    bool map<Key, T, Compare, Alloc, NodePolicy>::value_compare::operator()(const value_type &x, const value_type &y) const {
         return (_comp(x.first, y.first));
     }
 
@@ -134,9 +272,9 @@ namespace ft {
      *              the second argument in the strict weak ordering it defines, and false otherwise
      * @param alloc Allocator object
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    map<Key, T, Compare, Alloc>::map(const key_compare &comp, const allocator_type &alloc):
-                                        _tree(RBTree<value_type, value_compare, allocator_type>(value_compare(comp), allocator_type(alloc))) {}
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    map<Key, T, Compare, Alloc, NodePolicy>::map(const key_compare &comp, const allocator_type &alloc):
+                                        _tree(comp, alloc) {}
 
     /**
      * Range constructor
@@ -146,45 +284,81 @@ namespace ft {
      *              the second argument in the strict weak ordering it defines, and false otherwise
      * @param alloc Allocator object
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
     template<typename InputIterator>
-    map<Key, T, Compare, Alloc>::map(InputIterator first, InputIterator last,
+    map<Key, T, Compare, Alloc, NodePolicy>::map(InputIterator first, InputIterator last,
                                      const key_compare &comp, const allocator_type &alloc,
                                      typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*):
-                                     _tree(RBTree<value_type, value_compare, allocator_type>(value_compare(comp), allocator_type(alloc))) {
+                                     _tree(comp, alloc) {
         insert(first, last);
     }
 
+    /**
+     * Sorted range constructor, builds the tree in linear time without comparing the elements
+     * @param first Input iterator to the initial position in a range sorted by key and holding no equivalent keys
+     * @param last  Input iterator to the final position in a range
+     * @param comp  Binary predicate that, taking two element keys as argument, returns true if the first argument goes before
+     *              the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename InputIterator>
+    map<Key, T, Compare, Alloc, NodePolicy>::map(assume_sorted_t, InputIterator first, InputIterator last,
+                                     const key_compare &comp, const allocator_type &alloc):
+                                     _tree(comp, alloc) {
+        _tree.insert(assume_sorted, first, last);
+    }
+
     /**
      * Copy constructor
      * @param src Another map object of the same type
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    map<Key, T, Compare, Alloc>::map(const map &src): _tree(src._tree) {}
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    map<Key, T, Compare, Alloc, NodePolicy>::map(const map &src): _tree(src._tree) {}
+
+# if FT_CXX11
+    /**
+     * Move constructor, src is left empty
+     * @param src Another map object of the same type
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    map<Key, T, Compare, Alloc, NodePolicy>::map(map &&src): _tree(std::move(src._tree)) {}
+# endif
 
     /**
      * Destructor
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    map<Key, T, Compare, Alloc>::~map() {}
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    map<Key, T, Compare, Alloc, NodePolicy>::~map() {}
 
     /**
      * Copy container content
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    map<Key, T, Compare, Alloc> &map<Key, T, Compare, Alloc>::operator=(const map &other) {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    map<Key, T, Compare, Alloc, NodePolicy> &map<Key, T, Compare, Alloc, NodePolicy>::operator=(const map &other) {
         if (this == &other)
             return (*this);
         _tree = other._tree;
         return (*this);
     }
 
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    map<Key, T, Compare, Alloc, NodePolicy> &map<Key, T, Compare, Alloc, NodePolicy>::operator=(map &&other) {
+        _tree = std::move(other._tree);
+        return (*this);
+    }
+# endif
+
     /**
      * Return iterator to beginning
      * @return An iterator to the first element in the container
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::iterator map<Key, T, Compare, Alloc>::begin() {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::iterator map<Key, T, Compare, Alloc, NodePolicy>::begin() {
         return (_tree.begin());
     }
 
@@ -192,8 +366,8 @@ namespace ft {
      * Return const iterator to beginning
      * @return A const iterator to the first element in the container
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::const_iterator map<Key, T, Compare, Alloc>::begin() const {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator map<Key, T, Compare, Alloc, NodePolicy>::begin() const {
         return (_tree.begin());
     }
 
@@ -201,8 +375,8 @@ namespace ft {
      * Return iterator to end
      * @return An iterator to the past-the-end element in the container
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::iterator map<Key, T, Compare, Alloc>::end() {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::iterator map<Key, T, Compare, Alloc, NodePolicy>::end() {
         return (_tree.end());
     }
 
@@ -210,8 +384,8 @@ namespace ft {
      * Return const iterator to end
      * @return A const iterator to the past-the-end element in the container
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::const_iterator map<Key, T, Compare, Alloc>::end() const {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator map<Key, T, Compare, Alloc, NodePolicy>::end() const {
         return (_tree.end());
     }
 
@@ -219,8 +393,8 @@ namespace ft {
      * Return reverse iterator to reverse beginning
      * @return A reverse iterator to the reverse beginning of the sequence container
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::reverse_iterator map<Key, T, Compare, Alloc>::rbegin() {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::reverse_iterator map<Key, T, Compare, Alloc, NodePolicy>::rbegin() {
         return (_tree.rbegin());
     }
 
@@ -228,8 +402,8 @@ namespace ft {
      * Return const reverse iterator to reverse beginning
      * @return A const reverse iterator to the reverse beginning of the sequence container
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::const_reverse_iterator map<Key, T, Compare, Alloc>::rbegin() const {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::const_reverse_iterator map<Key, T, Compare, Alloc, NodePolicy>::rbegin() const {
         return (_tree.rbegin());
     }
 
@@ -237,8 +411,8 @@ namespace ft {
      * Return reverse iterator to reverse end
      * @return A reverse iterator to the reverse end of the sequence container
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::reverse_iterator map<Key, T, Compare, Alloc>::rend() {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::reverse_iterator map<Key, T, Compare, Alloc, NodePolicy>::rend() {
         return (_tree.rend());
     }
 
@@ -246,8 +420,8 @@ namespace ft {
      * Return const reverse iterator to reverse end
      * @return A const reverse iterator to the reverse end of the sequence container
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::const_reverse_iterator map<Key, T, Compare, Alloc>::rend() const {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::const_reverse_iterator map<Key, T, Compare, Alloc, NodePolicy>::rend() const {
         return (_tree.rend());
     }
 
@@ -255,8 +429,8 @@ namespace ft {
      * Test whether container is empty
      * @return true if the container size is 0, false otherwise
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    bool map<Key, T, Compare, Alloc>::empty() const {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    bool map<Key, T, Compare, Alloc, NodePolicy>::empty() const {
         return (_tree.empty());
     }
 
@@ -264,8 +438,8 @@ namespace ft {
      * Return container size
      * @return The number of elements in the container
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::size_type map<Key, T, Compare, Alloc>::size() const {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::size_type map<Key, T, Compare, Alloc, NodePolicy>::size() const {
         return (_tree.size());
     }
 
@@ -273,20 +447,24 @@ namespace ft {
      * Return maximum size
      * @return The maximum number of elements a map container can hold as content
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::size_type map<Key, T, Compare, Alloc>::max_size() const {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::size_type map<Key, T, Compare, Alloc, NodePolicy>::max_size() const {
         return (_tree.max_size());
     }
 
     /**
-     * Access element
+     * Access element, an existing element is found without building a value or allocating a node.
+     * A missing one is inserted with its lower bound as the hint
      * @param k Key value of the element whose mapped value is accessed
      * @return A reference to the mapped value of the element with a key value equivalent to k
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::mapped_type &map<Key, T, Compare, Alloc>::operator[](const key_type &k) {
-        ft::pair<iterator, bool> res = insert(ft::make_pair(k, mapped_type()));
-        return ((*res.first).second);
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::mapped_type &map<Key, T, Compare, Alloc, NodePolicy>::operator[](const key_type &k) {
+        iterator it = lower_bound(k);
+
+        if (it == end() || key_comp()(k, it->first))
+            it = _tree.insert(it, value_type(k, mapped_type()));
+        return (it->second);
     }
 
     /**
@@ -296,8 +474,8 @@ namespace ft {
      *         to the element with an equivalent key in the map. The pair::second element in the pair is set to true
      *         if a new element was inserted or false if an equivalent key already existed
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    pair<typename map<Key, T, Compare, Alloc>::iterator, bool> map<Key, T, Compare, Alloc>::insert(const value_type &val) {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    pair<typename map<Key, T, Compare, Alloc, NodePolicy>::iterator, bool> map<Key, T, Compare, Alloc, NodePolicy>::insert(const value_type &val) {
         return (_tree.insert(val));
     }
 
@@ -307,29 +485,145 @@ namespace ft {
      * @param val      Value to be copied to the inserted element
      * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent key in the map
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::iterator map<Key, T, Compare, Alloc>::insert(map::iterator position, const map::value_type &val) {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::iterator map<Key, T, Compare, Alloc, NodePolicy>::insert(map::iterator position, const map::value_type &val) {
         return (_tree.insert(position, val));
     }
 
+# if FT_CXX11
+    /**
+     * Insert elements
+     * @param val Value to be moved to the inserted element
+     * @return A pair, with its member pair::first set to an iterator pointing to either the newly inserted element or
+     *         to the element with an equivalent key in the map. The pair::second element in the pair is set to true
+     *         if a new element was inserted or false if an equivalent key already existed
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    pair<typename map<Key, T, Compare, Alloc, NodePolicy>::iterator, bool> map<Key, T, Compare, Alloc, NodePolicy>::insert(value_type &&val) {
+        return (_tree.insert(std::move(val)));
+    }
+
+    /**
+     * Insert elements
+     * @param position Hint for the position where the element can be inserted
+     * @param val      Value to be moved to the inserted element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent key in the map
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::iterator map<Key, T, Compare, Alloc, NodePolicy>::insert(iterator position, value_type &&val) {
+        return (_tree.insert(position, std::move(val)));
+    }
+
+    /**
+     * Construct and insert element
+     * @param args Arguments forwarded to the constructor of the new element
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename... Args>
+    pair<typename map<Key, T, Compare, Alloc, NodePolicy>::iterator, bool> map<Key, T, Compare, Alloc, NodePolicy>::emplace(Args&&... args) {
+        return (_tree.emplace(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Construct and insert element
+     * @param position Hint for the position where the element can be inserted
+     * @param args     Arguments forwarded to the constructor of the new element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent key in the map
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename... Args>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::iterator map<Key, T, Compare, Alloc, NodePolicy>::emplace_hint(iterator position, Args&&... args) {
+        return (_tree.emplace_hint(position, std::forward<Args>(args)...));
+    }
+
+    /**
+     * Insert element if the key is not present, nothing is constructed or moved from otherwise
+     * @param k    Key of the element
+     * @param args Arguments forwarded to the constructor of the mapped value
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename... Args>
+    pair<typename map<Key, T, Compare, Alloc, NodePolicy>::iterator, bool> map<Key, T, Compare, Alloc, NodePolicy>::try_emplace(const key_type &k, Args&&... args) {
+        iterator it = lower_bound(k);
+
+        if (it != end() && !key_comp()(k, it->first))
+            return (ft::make_pair(it, false));
+        return (ft::make_pair(_tree.emplace_hint(it, k, mapped_type(std::forward<Args>(args)...)), true));
+    }
+
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename... Args>
+    pair<typename map<Key, T, Compare, Alloc, NodePolicy>::iterator, bool> map<Key, T, Compare, Alloc, NodePolicy>::try_emplace(key_type &&k, Args&&... args) {
+        iterator it = lower_bound(k);
+
+        if (it != end() && !key_comp()(k, it->first))
+            return (ft::make_pair(it, false));
+        return (ft::make_pair(_tree.emplace_hint(it, std::move(k), mapped_type(std::forward<Args>(args)...)), true));
+    }
+# endif
+
     /**
      * Insert elements
      * @param first Input iterator to the initial position in a range
      * @param last  Input iterator to the final position in a range
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
     template<typename InputIterator>
-    void map<Key, T, Compare, Alloc>::insert(InputIterator first, InputIterator last,
+    void map<Key, T, Compare, Alloc, NodePolicy>::insert(InputIterator first, InputIterator last,
                                              typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*) {
         _tree.insert(first, last);
     }
 
+    /**
+     * Insert elements from a range sorted by key that holds no equivalent keys,
+     * an empty map is built from it in linear time
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename InputIterator>
+    void map<Key, T, Compare, Alloc, NodePolicy>::insert(assume_sorted_t, InputIterator first, InputIterator last) {
+        _tree.insert(assume_sorted, first, last);
+    }
+
+    /**
+     * Insert the node owned by a handle returned by extract, without allocating or copying the element.
+     * The allocators must compare equal
+     * @param nh Node handle, emptied only if the node is inserted
+     * @return The inserted element, or the element with an equivalent key, whether the node was inserted,
+     *         and the node if it was not
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::insert_return_type map<Key, T, Compare, Alloc, NodePolicy>::insert(const node_type &nh) {
+        typename tree_type::insert_return_type inserted = _tree.insert(nh);
+        insert_return_type                     ret;
+
+        ret.position = inserted.position;
+        ret.inserted = inserted.inserted;
+        ret.node = inserted.node;
+        return (ret);
+    }
+
+    /**
+     * Insert the node owned by a handle returned by extract with hint, without allocating or copying the element.
+     * The allocators must compare equal
+     * @param position Hint for the position where the element can be inserted
+     * @param nh       Node handle, emptied only if the node is inserted
+     * @return An iterator to the inserted element or to the element with an equivalent key, end() if nh is empty
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::iterator map<Key, T, Compare, Alloc, NodePolicy>::insert(iterator position, const node_type &nh) {
+        return (_tree.insert(position, nh));
+    }
+
     /**
      * Erase elements
      * @param position Iterator pointing to a single element to be removed from the map
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    void map<Key, T, Compare, Alloc>::erase(iterator position) {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void map<Key, T, Compare, Alloc, NodePolicy>::erase(iterator position) {
         _tree.erase(position);
     }
 
@@ -338,9 +632,9 @@ namespace ft {
      * @param k Key of the element to be removed from the map
      * @return Number of elements erased
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::size_type map<Key, T, Compare, Alloc>::erase(const key_type &k) {
-        return (_tree.erase(ft::make_pair(k, mapped_type())));
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::size_type map<Key, T, Compare, Alloc, NodePolicy>::erase(const key_type &k) {
+        return (_tree.erase(k));
     }
 
     /**
@@ -348,44 +642,99 @@ namespace ft {
      * @param first Iterator to the initial position in a range
      * @param last  Iterator to the final position in a range
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    void map<Key, T, Compare, Alloc>::erase(map::iterator first, map::iterator last) {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void map<Key, T, Compare, Alloc, NodePolicy>::erase(map::iterator first, map::iterator last) {
         _tree.erase(first, last);
     }
 
+    /**
+     * Take an element out of the map without destroying it, its node is unlinked and owned by the returned handle
+     * @param position Iterator pointing to a single element of the map
+     * @return A node handle owning the element
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::node_type map<Key, T, Compare, Alloc, NodePolicy>::extract(iterator position) {
+        return (node_type(_tree.extract(position)));
+    }
+
+    /**
+     * Take the element with a key out of the map without destroying it
+     * @param k Key of the element
+     * @return A node handle owning the element, empty if no element has the key
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::node_type map<Key, T, Compare, Alloc, NodePolicy>::extract(const key_type &k) {
+        return (node_type(_tree.extract(k)));
+    }
+
     /**
      * Swap content
      * @param x Another map container of the same type as this
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    void map<Key, T, Compare, Alloc>::swap(map &x) {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void map<Key, T, Compare, Alloc, NodePolicy>::swap(map &x) {
         _tree.swap(x._tree);
     }
 
     /**
      * Clear content
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    void map<Key, T, Compare, Alloc>::clear() {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void map<Key, T, Compare, Alloc, NodePolicy>::clear() {
         _tree.clear();
     }
 
+    /**
+     * Move the elements with a key not before k into x (extension).
+     * Takes logarithmic time with ft::order_statistics, otherwise counting the new sizes adds time linear in
+     * the smaller part. Nodes are relinked, nothing is allocated or copied, the allocators must compare equal
+     * @param k Key where the container is split
+     * @param x Another map object of the same type, its previous content is destroyed
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void map<Key, T, Compare, Alloc, NodePolicy>::split(const key_type &k, map &x) {
+        _tree.split(k, x._tree);
+    }
+
+    /**
+     * Move the elements of x into the container (extension).
+     * Takes logarithmic time if all the keys of x go after, or all before, the keys of the container,
+     * otherwise the elements are moved one at a time and those with an equivalent key stay in x.
+     * Nodes are relinked, nothing is allocated or copied, the allocators must compare equal
+     * @param x Another map object of the same type
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void map<Key, T, Compare, Alloc, NodePolicy>::join(map &x) {
+        _tree.join(x._tree);
+    }
+
+    /**
+     * Move the elements of x whose key is not in the container into it, the others stay in x.
+     * Nodes are relinked, nothing is allocated or copied, the allocators must compare equal.
+     * Same as join, which concatenates the trees in logarithmic time when the key ranges do not overlap
+     * @param x Another map object of the same type
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void map<Key, T, Compare, Alloc, NodePolicy>::merge(map &x) {
+        _tree.join(x._tree);
+    }
+
     /**
      * Return key comparison object
      * @return The comparison object
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::key_compare map<Key, T, Compare, Alloc>::key_comp() const {
-        return (_tree.value_comp()._comp);
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::key_compare map<Key, T, Compare, Alloc, NodePolicy>::key_comp() const {
+        return (_tree.key_comp());
     }
 
     /**
      * Return value comparison object
      * @return The comparison object for element values
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::value_compare map<Key, T, Compare, Alloc>::value_comp() const {
-        return (_tree.value_comp());
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::value_compare map<Key, T, Compare, Alloc, NodePolicy>::value_comp() const {
+        return (value_compare(_tree.key_comp()));
     }
 
     /**
@@ -393,9 +742,9 @@ namespace ft {
      * @param k Key to be searched for
      * @return An iterator to the element, if an element with specified key is found, or map::end otherwise
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::iterator map<Key, T, Compare, Alloc>::find(const key_type &k) {
-        return (_tree.find(ft::make_pair(k, mapped_type())));
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::iterator map<Key, T, Compare, Alloc, NodePolicy>::find(const key_type &k) {
+        return (_tree.find(k));
     }
 
     /**
@@ -403,9 +752,9 @@ namespace ft {
      * @param k Key to be searched for
      * @return A const iterator to the element, if an element with specified key is found, or map::end otherwise
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::const_iterator map<Key, T, Compare, Alloc>::find(const key_type &k) const {
-        return (_tree.find(ft::make_pair(k, mapped_type())));
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator map<Key, T, Compare, Alloc, NodePolicy>::find(const key_type &k) const {
+        return (_tree.find(k));
     }
 
     /**
@@ -413,9 +762,9 @@ namespace ft {
      * @param k Key to search for
      * @return 1 if the container contains an element whose key is equivalent to k, or zero otherwise
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::size_type map<Key, T, Compare, Alloc>::count(const key_type &k) const {
-        return (_tree.count(ft::make_pair(k, mapped_type())));
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::size_type map<Key, T, Compare, Alloc, NodePolicy>::count(const key_type &k) const {
+        return (_tree.count(k));
     }
 
     /**
@@ -424,9 +773,9 @@ namespace ft {
      * @return An iterator to the the first element in the container whose key is not considered to go before k,
      *         or map::end if all keys are considered to go before k
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::iterator map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) {
-        return (_tree.lower_bound(ft::make_pair(k, mapped_type())));
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::iterator map<Key, T, Compare, Alloc, NodePolicy>::lower_bound(const key_type &k) {
+        return (_tree.lower_bound(k));
     }
 
     /**
@@ -435,9 +784,9 @@ namespace ft {
      * @return A const iterator to the the first element in the container whose key is not considered to go before k,
      *         or map::end if all keys are considered to go before k
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::const_iterator map<Key, T, Compare, Alloc>::lower_bound(const key_type &k) const {
-        return (_tree.lower_bound(ft::make_pair(k, mapped_type())));
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator map<Key, T, Compare, Alloc, NodePolicy>::lower_bound(const key_type &k) const {
+        return (_tree.lower_bound(k));
     }
 
     /**
@@ -446,9 +795,9 @@ namespace ft {
      * @return An iterator to the the first element in the container whose key is considered to go after k,
      *         or map::end if no keys are considered to go after k
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::iterator map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) {
-        return (_tree.upper_bound(ft::make_pair(k, mapped_type())));
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::iterator map<Key, T, Compare, Alloc, NodePolicy>::upper_bound(const key_type &k) {
+        return (_tree.upper_bound(k));
     }
 
     /**
@@ -457,9 +806,9 @@ namespace ft {
      * @return An iterator to the the first element in the container whose key is considered to go after k,
      *         or map::end if no keys are considered to go after k
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::const_iterator map<Key, T, Compare, Alloc>::upper_bound(const key_type &k) const {
-        return (_tree.upper_bound(ft::make_pair(k, mapped_type())));
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator map<Key, T, Compare, Alloc, NodePolicy>::upper_bound(const key_type &k) const {
+        return (_tree.upper_bound(k));
     }
 
     /**
@@ -467,9 +816,9 @@ namespace ft {
      * @param k Key to search for
      * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    pair<typename map<Key, T, Compare, Alloc>::iterator, typename map<Key, T, Compare, Alloc>::iterator> map<Key, T, Compare, Alloc>::equal_range(const key_type &k) {
-        return (_tree.equal_range(ft::make_pair(k, mapped_type())));
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    pair<typename map<Key, T, Compare, Alloc, NodePolicy>::iterator, typename map<Key, T, Compare, Alloc, NodePolicy>::iterator> map<Key, T, Compare, Alloc, NodePolicy>::equal_range(const key_type &k) {
+        return (_tree.equal_range(k));
     }
 
     /**
@@ -477,20 +826,316 @@ namespace ft {
      * @param k Key to search for
      * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    pair<typename map<Key, T, Compare, Alloc>::const_iterator, typename map<Key, T, Compare, Alloc>::const_iterator> map<Key, T, Compare, Alloc>::equal_range(const key_type &k) const {
-        return (_tree.equal_range(ft::make_pair(k, mapped_type())));
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    pair<typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator, typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator> map<Key, T, Compare, Alloc, NodePolicy>::equal_range(const key_type &k) const {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get iterator to element, with a transparent comparison object
+     * @param k Value comparable with the keys, looked up without being converted to key_type
+     * @return An iterator to the element, if an element with a key equivalent to k is found, or map::end otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key, T, Compare, Alloc, NodePolicy>::iterator>::type
+    map<Key, T, Compare, Alloc, NodePolicy>::find(const K &k) {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Get const iterator to element, with a transparent comparison object
+     * @param k Value comparable with the keys, looked up without being converted to key_type
+     * @return A const iterator to the element, if an element with a key equivalent to k is found, or map::end otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator>::type
+    map<Key, T, Compare, Alloc, NodePolicy>::find(const K &k) const {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Count elements with a key equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return 1 if the container contains an element whose key is equivalent to k, or zero otherwise
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key, T, Compare, Alloc, NodePolicy>::size_type>::type
+    map<Key, T, Compare, Alloc, NodePolicy>::count(const K &k) const {
+        return (_tree.count(k));
+    }
+
+    /**
+     * Return iterator to lower bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return An iterator to the the first element in the container whose key is not considered to go before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key, T, Compare, Alloc, NodePolicy>::iterator>::type
+    map<Key, T, Compare, Alloc, NodePolicy>::lower_bound(const K &k) {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return const iterator to lower bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return A const iterator to the the first element in the container whose key is not considered to go before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator>::type
+    map<Key, T, Compare, Alloc, NodePolicy>::lower_bound(const K &k) const {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return iterator to upper bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return An iterator to the the first element in the container whose key is considered to go after k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key, T, Compare, Alloc, NodePolicy>::iterator>::type
+    map<Key, T, Compare, Alloc, NodePolicy>::upper_bound(const K &k) {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Return const iterator to upper bound, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return A const iterator to the the first element in the container whose key is considered to go after k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator>::type
+    map<Key, T, Compare, Alloc, NodePolicy>::upper_bound(const K &k) const {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Get range of elements with a key equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<typename map<Key, T, Compare, Alloc, NodePolicy>::iterator, typename map<Key, T, Compare, Alloc, NodePolicy>::iterator> >::type
+    map<Key, T, Compare, Alloc, NodePolicy>::equal_range(const K &k) {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get const range of elements with a key equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the keys
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator, typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator> >::type
+    map<Key, T, Compare, Alloc, NodePolicy>::equal_range(const K &k) const {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get iterators to the elements of a batch of keys (extension).
+     * Faster than one find per key: a sorted batch is merged with the tree, any other batch advances several
+     * descents at once so that their cache misses overlap, see FT_RB_TREE_BATCH_LANES
+     * @param first Forward iterator to the first key
+     * @param last  Forward iterator past the last key
+     * @param out   Output iterator that receives, for each key in order, an iterator to its element or map::end
+     * @return out past the last iterator written
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename ForwardIterator, typename OutputIterator>
+    OutputIterator map<Key, T, Compare, Alloc, NodePolicy>::find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) {
+        return (_tree.find_batch(first, last, out));
+    }
+
+    /**
+     * Get const iterators to the elements of a batch of keys (extension)
+     * @param first Forward iterator to the first key
+     * @param last  Forward iterator past the last key
+     * @param out   Output iterator that receives, for each key in order, a const iterator to its element or map::end
+     * @return out past the last iterator written
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename ForwardIterator, typename OutputIterator>
+    OutputIterator map<Key, T, Compare, Alloc, NodePolicy>::find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const {
+        return (_tree.find_batch(first, last, out));
     }
 
     /**
      * Get allocator
      * @return The allocator
      */
-    template<typename Key, typename T, typename Compare, typename Alloc>
-    typename map<Key, T, Compare, Alloc>::allocator_type map<Key, T, Compare, Alloc>::get_allocator() const {
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::allocator_type map<Key, T, Compare, Alloc, NodePolicy>::get_allocator() const {
         return (_tree.get_allocator());
     }
 
+    /**
+     * Get the element at a position in key order (extension), requires ft::order_statistics
+     * @param n Position of the element, 0 for the first one
+     * @return An iterator to the element, or end() if n is not less than size()
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::iterator map<Key, T, Compare, Alloc, NodePolicy>::nth(size_type n) {
+        return (_tree.nth(n));
+    }
+
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::const_iterator map<Key, T, Compare, Alloc, NodePolicy>::nth(size_type n) const {
+        return (_tree.nth(n));
+    }
+
+    /**
+     * Get the position of a key in key order (extension), requires ft::order_statistics
+     * @param k Key
+     * @return The number of elements whose key goes before k
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::size_type map<Key, T, Compare, Alloc, NodePolicy>::rank(const key_type &k) const {
+        return (_tree.rank(k));
+    }
+
+    /**
+     * Count the elements with a key in [lo, hi) (extension), requires ft::order_statistics
+     * @param lo Lower bound of the range, included
+     * @param hi Upper bound of the range, excluded
+     * @return The number of elements in the range
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::size_type map<Key, T, Compare, Alloc, NodePolicy>::count_range(const key_type &lo, const key_type &hi) const {
+        return (_tree.count_range(lo, hi));
+    }
+
+    /**
+     * Get height of the underlying red-black tree (extension)
+     * @return The number of nodes on the longest path from the root down to a leaf, at most 2 * log2(size() + 1)
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename map<Key, T, Compare, Alloc, NodePolicy>::size_type map<Key, T, Compare, Alloc, NodePolicy>::height() const {
+        return (_tree.height());
+    }
+
+    /**
+     * Check the invariants of the underlying red-black tree (extension), takes linear time
+     * @return true if the tree is valid
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    bool map<Key, T, Compare, Alloc, NodePolicy>::verify() const {
+        return (_tree.verify());
+    }
+
+    /**
+     * Replace the content of result by the result of a set operation on two maps, in linear time (extension).
+     * Both maps are merged in one pass and the result is built as a balanced tree from the merged sequence,
+     * so every element is compared once and copied once. result may be x or y
+     * @param op     Operation
+     * @param x      First map, an element found in both maps is copied from it
+     * @param y      Second map, ordered by the same comparison object
+     * @param result Map that receives the result, keeps its allocator and takes the comparison object of x
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void assign_set_operation(set_operation op, const map<Key, T, Compare, Alloc, NodePolicy> &x, const map<Key, T, Compare, Alloc, NodePolicy> &y, map<Key, T, Compare, Alloc, NodePolicy> &result) {
+        typedef map<Key, T, Compare, Alloc, NodePolicy>                               map_type;
+        typedef typename map_type::const_iterator                                     const_iterator;
+        typedef typename map_type::value_compare                                      value_compare;
+        typedef set_operation_iterator<const_iterator, const_iterator, value_compare> merge_iterator;
+
+        merge_iterator first(op, x.begin(), x.end(), y.begin(), y.end(), x.value_comp());
+        merge_iterator last(op, x.end(), x.end(), y.end(), y.end(), x.value_comp());
+        map_type       tmp(assume_sorted, first, last, x.key_comp(), result.get_allocator());
+
+        result.swap(tmp);
+    }
+
+    /**
+     * Store the union of two maps in result, the elements with a key found in x or in y, in linear time (extension)
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_union(const map<Key, T, Compare, Alloc, NodePolicy> &x, const map<Key, T, Compare, Alloc, NodePolicy> &y, map<Key, T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(set_union_op, x, y, result);
+    }
+
+    /**
+     * Store the intersection of two maps in result, the elements of x with a key found in y, in linear time (extension)
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_intersection(const map<Key, T, Compare, Alloc, NodePolicy> &x, const map<Key, T, Compare, Alloc, NodePolicy> &y, map<Key, T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(set_intersection_op, x, y, result);
+    }
+
+    /**
+     * Store the difference of two maps in result, the elements of x with a key not found in y, in linear time (extension)
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_difference(const map<Key, T, Compare, Alloc, NodePolicy> &x, const map<Key, T, Compare, Alloc, NodePolicy> &y, map<Key, T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(set_difference_op, x, y, result);
+    }
+
+    /**
+     * Store the symmetric difference of two maps in result, the elements with a key found in only one of x and y, in linear time (extension)
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_symmetric_difference(const map<Key, T, Compare, Alloc, NodePolicy> &x, const map<Key, T, Compare, Alloc, NodePolicy> &y, map<Key, T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(set_symmetric_difference_op, x, y, result);
+    }
+
+# if FT_CXX11
+    /**
+     * Replace the content of result by the result of a set operation on two maps, on several threads (extension, C++11).
+     * The keys of the first levels of the larger map cut both maps into ranges, each thread merges one range of
+     * each into a balanced tree and the trees are joined. The allocator must be safe to use from several threads
+     * at once, which rules out ft::pool_allocator and ft::counting_allocator; operands smaller than
+     * FT_RB_TREE_PARALLEL_MIN elements in total are merged on the calling thread. result may be x or y
+     * @param policy ft::parallel, or ft::parallel_t(n) for n threads
+     * @param op     Operation
+     * @param x      First map, an element found in both maps is copied from it
+     * @param y      Second map, ordered by the same comparison object
+     * @param result Map that receives the result, keeps its allocator and takes the comparison object of x
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void assign_set_operation(parallel_t policy, set_operation op, const map<Key, T, Compare, Alloc, NodePolicy> &x, const map<Key, T, Compare, Alloc, NodePolicy> &y, map<Key, T, Compare, Alloc, NodePolicy> &result) {
+        result._tree.assign_set_operation(policy, op, x._tree, y._tree, x.value_comp());
+    }
+
+    /**
+     * Store the union of two maps in result, the elements with a key found in x or in y, on several threads (extension, C++11)
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_union(parallel_t policy, const map<Key, T, Compare, Alloc, NodePolicy> &x, const map<Key, T, Compare, Alloc, NodePolicy> &y, map<Key, T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(policy, set_union_op, x, y, result);
+    }
+
+    /**
+     * Store the intersection of two maps in result, the elements of x with a key found in y, on several threads (extension, C++11)
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_intersection(parallel_t policy, const map<Key, T, Compare, Alloc, NodePolicy> &x, const map<Key, T, Compare, Alloc, NodePolicy> &y, map<Key, T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(policy, set_intersection_op, x, y, result);
+    }
+
+    /**
+     * Store the difference of two maps in result, the elements of x with a key not found in y, on several threads (extension, C++11)
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_difference(parallel_t policy, const map<Key, T, Compare, Alloc, NodePolicy> &x, const map<Key, T, Compare, Alloc, NodePolicy> &y, map<Key, T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(policy, set_difference_op, x, y, result);
+    }
+
+    /**
+     * Store the symmetric difference of two maps in result, the elements with a key found in only one of x and y, on several threads (extension, C++11)
+     */
+    template<typename Key, typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_symmetric_difference(parallel_t policy, const map<Key, T, Compare, Alloc, NodePolicy> &x, const map<Key, T, Compare, Alloc, NodePolicy> &y, map<Key, T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(policy, set_symmetric_difference_op, x, y, result);
+    }
+# endif
+
 }
 
 #endif //FT_CONTAINERS_MAP_HPP
@@ -0,0 +1,298 @@
+#ifndef FT_CONTAINERS_POOL_ALLOCATOR_HPP
+# define FT_CONTAINERS_POOL_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <new>
+# include <limits>
+# include "type_traits.hpp"
+
+namespace ft {
+
+    /**
+     * Free-list allocator of fixed-size blocks, carved from slabs of consecutive blocks.
+     * Allocation pops the free list or bumps a pointer into the current slab and deallocation
+     * pushes the block back on the free list, both in constant time. Slabs are kept for the whole
+     * run of the program and reused, so the pool can safely outlive static containers.
+     * Not thread safe
+     * @tparam Size Object size in bytes, a multiple of the alignment of every type stored in it.
+     *              Blocks are rounded up to a multiple of the pointer size to hold the free-list link
+     */
+    template<size_t Size>
+    class fixed_pool {
+    public:
+        static const size_t block_size = (Size + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+        static const size_t slab_blocks = 64 * 1024 / block_size < 16 ? 16 : 64 * 1024 / block_size;
+
+    private:
+        struct free_block {
+            free_block *next;
+        };
+
+        free_block *_free;
+        char       *_next;
+        char       *_limit;
+        size_t     _slabs;
+        size_t     _used;
+
+        fixed_pool();
+        fixed_pool(const fixed_pool &src);
+        fixed_pool &operator=(const fixed_pool &other);
+
+        void       _grow();
+
+    public:
+        static fixed_pool &instance();
+
+        void       *allocate();
+        void       deallocate(void *p);
+
+        size_t     slabs() const;
+        size_t     used_blocks() const;
+    };
+
+    template<size_t Size>
+    fixed_pool<Size>::fixed_pool(): _free(NULL), _next(NULL), _limit(NULL), _slabs(0), _used(0) {}
+
+    /**
+     * Pool shared by every allocator whose blocks have this size.
+     * Allocated once and never destroyed, so containers with static storage can release their nodes at exit
+     */
+    template<size_t Size>
+    fixed_pool<Size> &fixed_pool<Size>::instance() {
+        static fixed_pool *pool = new fixed_pool();
+        return (*pool);
+    }
+
+    /**
+     * Add a new slab, its blocks are handed out by bumping _next
+     */
+    template<size_t Size>
+    void fixed_pool<Size>::_grow() {
+        _next = static_cast<char*>(::operator new(block_size * slab_blocks));
+        _limit = _next + block_size * slab_blocks;
+        _slabs++;
+    }
+
+    /**
+     * Allocate one block
+     * @return Pointer to a block of block_size bytes
+     */
+    template<size_t Size>
+    void *fixed_pool<Size>::allocate() {
+        void *p;
+
+        if (_free) {
+            p = _free;
+            _free = _free->next;
+        } else {
+            if (_next == _limit)
+                _grow();
+            p = _next;
+            _next += block_size;
+        }
+        _used++;
+        return (p);
+    }
+
+    /**
+     * Return a block to the pool
+     * @param p Block previously returned by allocate
+     */
+    template<size_t Size>
+    void fixed_pool<Size>::deallocate(void *p) {
+        free_block *block = static_cast<free_block*>(p);
+
+        block->next = _free;
+        _free = block;
+        _used--;
+    }
+
+    /**
+     * Get number of slabs
+     * @return The number of slabs allocated from the system so far
+     */
+    template<size_t Size>
+    size_t fixed_pool<Size>::slabs() const {
+        return (_slabs);
+    }
+
+    /**
+     * Get number of used blocks
+     * @return The number of blocks allocated and not yet returned
+     */
+    template<size_t Size>
+    size_t fixed_pool<Size>::used_blocks() const {
+        return (_used);
+    }
+
+    /**
+     * Allocator that serves single objects from a fixed_pool and larger arrays from operator new.
+     * Node based containers rebind their allocator to the node type, so ft::map, ft::set and ft::list
+     * using a pool_allocator take every node from the pool of the node size: allocating and freeing a node
+     * is a free-list pop or push and nodes allocated together sit next to each other in the same slab.
+     * All pool_allocators are stateless and compare equal, objects of the same size share one pool
+     * @tparam T Type of the elements
+     */
+    template<typename T>
+    class pool_allocator {
+    public:
+        typedef T         value_type;
+        typedef T         *pointer;
+        typedef const T   *const_pointer;
+        typedef T         &reference;
+        typedef const T   &const_reference;
+        typedef size_t    size_type;
+        typedef ptrdiff_t difference_type;
+
+        template<typename U>
+        struct rebind {
+            typedef pool_allocator<U> other;
+        };
+
+        static const size_t block_size = (sizeof(T) + alignment_of<T>::value - 1) / alignment_of<T>::value * alignment_of<T>::value;
+
+        typedef fixed_pool<block_size> pool_type;
+
+        pool_allocator();
+        pool_allocator(const pool_allocator &src);
+        template<typename U>
+        pool_allocator(const pool_allocator<U> &src);
+
+        ~pool_allocator();
+
+        pool_allocator          &operator=(const pool_allocator &other);
+
+        pointer                 address(reference x) const;
+        const_pointer           address(const_reference x) const;
+
+        pointer                 allocate(size_type n, const void *hint = 0);
+        void                    deallocate(pointer p, size_type n);
+
+        size_type               max_size() const;
+
+# if FT_CXX11
+        template<typename U, typename... Args>
+        void                    construct(U *p, Args&&... args);
+# else
+        void                    construct(pointer p, const_reference val);
+# endif
+        void                    destroy(pointer p);
+
+        static pool_type        &pool();
+
+        template<typename U>
+        bool                    operator==(const pool_allocator<U> &other) const;
+        template<typename U>
+        bool                    operator!=(const pool_allocator<U> &other) const;
+    };
+
+    template<typename T>
+    pool_allocator<T>::pool_allocator() {}
+
+    template<typename T>
+    pool_allocator<T>::pool_allocator(const pool_allocator &src) {
+        (void)src;
+    }
+
+    template<typename T>
+    template<typename U>
+    pool_allocator<T>::pool_allocator(const pool_allocator<U> &src) {
+        (void)src;
+    }
+
+    template<typename T>
+    pool_allocator<T>::~pool_allocator() {}
+
+    template<typename T>
+    pool_allocator<T> &pool_allocator<T>::operator=(const pool_allocator &other) {
+        (void)other;
+        return (*this);
+    }
+
+    template<typename T>
+    typename pool_allocator<T>::pointer pool_allocator<T>::address(reference x) const {
+        return (&x);
+    }
+
+    template<typename T>
+    typename pool_allocator<T>::const_pointer pool_allocator<T>::address(const_reference x) const {
+        return (&x);
+    }
+
+    /**
+     * Allocate block of storage, a single object comes from the pool
+     * @param n Number of elements
+     * @return A pointer to the initial element in the block of storage
+     */
+    template<typename T>
+    typename pool_allocator<T>::pointer pool_allocator<T>::allocate(size_type n, const void *hint) {
+        (void)hint;
+        if (n == 1)
+            return (static_cast<pointer>(pool().allocate()));
+        if (n > max_size())
+            throw std::bad_alloc();
+        return (static_cast<pointer>(::operator new(n * sizeof(T))));
+    }
+
+    /**
+     * Release block of storage
+     * @param p Pointer to a block of storage previously allocated with allocate
+     * @param n Number of elements allocated on the call to allocate for this block of storage
+     */
+    template<typename T>
+    void pool_allocator<T>::deallocate(pointer p, size_type n) {
+        if (n == 1)
+            pool().deallocate(p);
+        else
+            ::operator delete(p);
+    }
+
+    template<typename T>
+    typename pool_allocator<T>::size_type pool_allocator<T>::max_size() const {
+        return (std::numeric_limits<size_type>::max() / sizeof(T));
+    }
+
+# if FT_CXX11
+    template<typename T>
+    template<typename U, typename... Args>
+    void pool_allocator<T>::construct(U *p, Args&&... args) {
+        new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+    }
+# else
+    template<typename T>
+    void pool_allocator<T>::construct(pointer p, const_reference val) {
+        new(static_cast<void*>(p)) T(val);
+    }
+# endif
+
+    template<typename T>
+    void pool_allocator<T>::destroy(pointer p) {
+        p->~T();
+    }
+
+    /**
+     * Get pool
+     * @return The pool single objects of type T are allocated from
+     */
+    template<typename T>
+    typename pool_allocator<T>::pool_type &pool_allocator<T>::pool() {
+        return (pool_type::instance());
+    }
+
+    template<typename T>
+    template<typename U>
+    bool pool_allocator<T>::operator==(const pool_allocator<U> &other) const {
+        (void)other;
+        return (true);
+    }
+
+    template<typename T>
+    template<typename U>
+    bool pool_allocator<T>::operator!=(const pool_allocator<U> &other) const {
+        (void)other;
+        return (false);
+    }
+
+}
+
+#endif //FT_CONTAINERS_POOL_ALLOCATOR_HPP
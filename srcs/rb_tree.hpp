@@ -2,90 +2,490 @@
 # define FT_CONTAINERS_RB_TREE_HPP
 
 namespace ft {
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc> class RBTree;
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc> class RBTree;
     template<typename T> struct RBTreeNode;
 }
 
+# include <cstddef>
 # include <memory>
+# include <new>
 # include <iostream>
 # include "algorithm.hpp"
 # include "iterators/rb_tree_iterator.hpp"
 # include "utility.hpp"
 # include "functional.hpp"
+# if FT_CXX11
+#  include <exception>
+#  include <thread>
+#  include <vector>
+# endif
+
+/**
+ * Build with -DFT_RB_TREE_PREFETCH=1 to make the search descents prefetch both children of every visited node,
+ * which hides part of the cache miss latency on trees much larger than the cache
+ */
+# ifndef FT_RB_TREE_PREFETCH
+#  define FT_RB_TREE_PREFETCH 0
+# endif
+
+/**
+ * Number of descents find_batch advances in lockstep. Each one waits on a cache miss per level on a large tree,
+ * interleaving them keeps that many misses in flight instead of one
+ */
+# ifndef FT_RB_TREE_BATCH_LANES
+#  define FT_RB_TREE_BATCH_LANES 16
+# endif
+
+/**
+ * Smallest total size of the operands for which the parallel set operations start threads,
+ * below it starting them costs more than the merge and the calling thread does all the work
+ */
+# ifndef FT_RB_TREE_PARALLEL_MIN
+#  define FT_RB_TREE_PARALLEL_MIN 65536
+# endif
 
 namespace ft {
 
     /**
-     * Red-black tree node
+     * Red-black tree node.
+     * The element is stored inside the node, in raw storage that the tree constructs and destroys itself,
+     * so a node costs one allocation and the end node holds no element at all. The storage is aligned only as
+     * much as T requires, so small elements fill the padding after the color instead of starting a new word.
+     * Before C++17 operator new does not honor an alignment stricter than the fundamental types, so over-aligned
+     * elements are rejected at compile time there instead of being stored misaligned
      * @tparam T Type of the element
      */
     template<typename T>
     struct RBTreeNode {
-        T          *value;
         RBTreeNode *left;
         RBTreeNode *right;
         RBTreeNode *parent;
         bool       color;
 
-        RBTreeNode(T *value);
+        union {
+# if FT_CXX11
+            alignas(T) char                                            bytes[sizeof(T)];
+# else
+            char                                                       bytes[sizeof(T)];
+# endif
+            typename type_with_alignment<alignment_of<T>::value>::type align;
+        }          storage;
+
+# if !FT_CXX11
+        typedef char requires_fundamental_alignment[alignment_of<T>::value
+                <= alignment_of<typename type_with_alignment<alignment_of<T>::value>::type>::value ? 1 : -1];
+# elif !defined(__cpp_aligned_new)
+        static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned elements require C++17 aligned new");
+# endif
+
+        RBTreeNode();
+
+        T          *valptr();
+        const T    *valptr() const;
+        T          &value();
+        const T    &value() const;
     };
 
     template<typename T>
-    RBTreeNode<T>::RBTreeNode(T *value): value(value), left(NULL), right(NULL), parent(NULL), color(true) {}
+    RBTreeNode<T>::RBTreeNode(): left(NULL), right(NULL), parent(NULL), color(true) {}
 
     /**
-     * Red-black tree container
-     * @tparam T         Type of the elements
-     * @tparam Compare   A binary predicate that takes two element keys as arguments and returns a bool
-     * @tparam Alloc     Type of the allocator object used to define the storage allocation model
-     * @tparam NodeAlloc Type of the allocator object used to define the storage allocation model for nodes
+     * Get pointer to the element storage
+     * @return Pointer to the element, valid only once the tree has constructed it
      */
-    template< typename T, typename Compare = ft::less<T>, typename Alloc = std::allocator<T>, typename NodeAlloc = std::allocator< RBTreeNode<T> > >
+    template<typename T>
+    T *RBTreeNode<T>::valptr() {
+        return (reinterpret_cast<T*>(storage.bytes));
+    }
+
+    template<typename T>
+    const T *RBTreeNode<T>::valptr() const {
+        return (reinterpret_cast<const T*>(storage.bytes));
+    }
+
+    template<typename T>
+    T &RBTreeNode<T>::value() {
+        return (*valptr());
+    }
+
+    template<typename T>
+    const T &RBTreeNode<T>::value() const {
+        return (*valptr());
+    }
+
+    /**
+     * Red-black tree node that also counts the elements of its subtree, used by order_statistics trees.
+     * The tree allocates these in place of plain nodes and reaches the count through a cast,
+     * so iterators and the rest of the tree code keep working on RBTreeNode
+     * @tparam T Type of the element
+     */
+    template<typename T>
+    struct RBTreeCountedNode: RBTreeNode<T> {
+        size_t count;
+
+        RBTreeCountedNode();
+    };
+
+    template<typename T>
+    RBTreeCountedNode<T>::RBTreeCountedNode(): RBTreeNode<T>(), count(0) {}
+
+    /**
+     * Node policy of the tree based containers: plain nodes, no order statistics
+     */
+    struct no_order_statistics {
+        static const bool enabled = false;
+
+        template<typename T>
+        struct node {
+            typedef RBTreeNode<T> type;
+        };
+
+        template<typename T>
+        static size_t count(const RBTreeNode<T> *node) {
+            (void)node;
+            return (0);
+        }
+
+        template<typename T>
+        static void set_count(RBTreeNode<T> *node, size_t count) {
+            (void)node;
+            (void)count;
+        }
+    };
+
+    /**
+     * Node policy of the tree based containers: every node counts the elements of its subtree,
+     * which costs one word per node and makes nth, rank and count_range logarithmic
+     */
+    struct order_statistics {
+        static const bool enabled = true;
+
+        template<typename T>
+        struct node {
+            typedef RBTreeCountedNode<T> type;
+        };
+
+        /**
+         * Number of elements in the subtree of a node, 0 for NULL
+         */
+        template<typename T>
+        static size_t count(const RBTreeNode<T> *node) {
+            return (node ? static_cast<const RBTreeCountedNode<T>*>(node)->count : 0);
+        }
+
+        template<typename T>
+        static void set_count(RBTreeNode<T> *node, size_t count) {
+            static_cast<RBTreeCountedNode<T>*>(node)->count = count;
+        }
+    };
+
+    /**
+     * Owning handle to a node taken out of a tree based container by extract, and given back to one by insert.
+     * The element stays in its node, so moving it between containers of the same type relinks the node without
+     * allocating or copying the element. Like std::auto_ptr, copying a handle transfers the node and leaves
+     * the source empty, which lets it be returned and passed by value in C++98. A handle that still owns a node
+     * when it is destroyed destroys the node with the allocators of the container it came from
+     * @tparam T         Type of the element
+     * @tparam Alloc     Type of the allocator of the container
+     * @tparam NodeAlloc Type of the allocator of the nodes, its value_type is the type the node was allocated as
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    class rb_tree_node_handle {
+        template<typename, typename, typename, typename, typename, typename, typename> friend class RBTree;
+
+    public:
+        typedef T     value_type;
+        typedef Alloc allocator_type;
+
+    private:
+        typedef typename NodeAlloc::value_type node_type;
+
+        mutable RBTreeNode<T> *_node;
+        allocator_type        _alloc;
+        NodeAlloc             _node_alloc;
+
+        rb_tree_node_handle(RBTreeNode<T> *node, const allocator_type &alloc, const NodeAlloc &node_alloc);
+
+        RBTreeNode<T>         *_release() const;
+        void                  _destroy();
+
+    public:
+        rb_tree_node_handle();
+        rb_tree_node_handle(const rb_tree_node_handle &src);
+
+        ~rb_tree_node_handle();
+
+        rb_tree_node_handle   &operator=(const rb_tree_node_handle &other);
+
+        bool                  empty() const;
+        value_type            &value() const;
+        allocator_type        get_allocator() const;
+        void                  swap(rb_tree_node_handle &x);
+    };
+
+    template<typename T, typename Alloc, typename NodeAlloc>
+    rb_tree_node_handle<T, Alloc, NodeAlloc>::rb_tree_node_handle(RBTreeNode<T> *node, const allocator_type &alloc, const NodeAlloc &node_alloc):
+    _node(node), _alloc(alloc), _node_alloc(node_alloc) {}
+
+    /**
+     * Give up the node without destroying it
+     * @return The node, NULL if the handle is empty
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    RBTreeNode<T> *rb_tree_node_handle<T, Alloc, NodeAlloc>::_release() const {
+        RBTreeNode<T> *node = _node;
+
+        _node = NULL;
+        return (node);
+    }
+
+    /**
+     * Destroy and deallocate the owned node, if any
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    void rb_tree_node_handle<T, Alloc, NodeAlloc>::_destroy() {
+        if (!_node)
+            return;
+        _alloc.destroy(_node->valptr());
+        _node_alloc.destroy(static_cast<node_type*>(_node));
+        _node_alloc.deallocate(static_cast<node_type*>(_node), 1);
+        _node = NULL;
+    }
+
+    /**
+     * Construct an empty handle
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    rb_tree_node_handle<T, Alloc, NodeAlloc>::rb_tree_node_handle(): _node(NULL), _alloc(), _node_alloc() {}
+
+    /**
+     * Take the node of src, src is left empty
+     * @param src Another handle of the same type
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    rb_tree_node_handle<T, Alloc, NodeAlloc>::rb_tree_node_handle(const rb_tree_node_handle &src):
+    _node(src._release()), _alloc(src._alloc), _node_alloc(src._node_alloc) {}
+
+    /**
+     * Destructor, destroys the node if the handle still owns one
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    rb_tree_node_handle<T, Alloc, NodeAlloc>::~rb_tree_node_handle() {
+        _destroy();
+    }
+
+    /**
+     * Destroy the owned node and take the node of other, other is left empty
+     * @param other Another handle of the same type
+     * @return *this
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    rb_tree_node_handle<T, Alloc, NodeAlloc> &rb_tree_node_handle<T, Alloc, NodeAlloc>::operator=(const rb_tree_node_handle &other) {
+        if (this == &other)
+            return (*this);
+
+        _destroy();
+        _node = other._release();
+        _alloc = other._alloc;
+        _node_alloc = other._node_alloc;
+
+        return (*this);
+    }
+
+    /**
+     * Test whether the handle owns no node
+     * @return true if the handle is empty
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    bool rb_tree_node_handle<T, Alloc, NodeAlloc>::empty() const {
+        return (!_node);
+    }
+
+    /**
+     * Access the element of the node, the handle must not be empty
+     * @return A reference to the element
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    typename rb_tree_node_handle<T, Alloc, NodeAlloc>::value_type &rb_tree_node_handle<T, Alloc, NodeAlloc>::value() const {
+        return (_node->value());
+    }
+
+    /**
+     * Get allocator
+     * @return A copy of the allocator of the container the node came from
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    typename rb_tree_node_handle<T, Alloc, NodeAlloc>::allocator_type rb_tree_node_handle<T, Alloc, NodeAlloc>::get_allocator() const {
+        return (_alloc);
+    }
+
+    /**
+     * Swap the nodes and the allocators of two handles
+     * @param x Another handle of the same type
+     */
+    template<typename T, typename Alloc, typename NodeAlloc>
+    void rb_tree_node_handle<T, Alloc, NodeAlloc>::swap(rb_tree_node_handle &x) {
+        ft::swap(_node, x._node);
+        ft::swap(_alloc, x._alloc);
+        ft::swap(_node_alloc, x._node_alloc);
+    }
+
+    /**
+     * Result of inserting a node handle: the inserted element and true, with an empty handle,
+     * or the element with an equivalent key and false, with the handle still owning the node
+     * @tparam Iterator   Type of the iterators of the container
+     * @tparam NodeHandle Type of the node handles of the container
+     */
+    template<typename Iterator, typename NodeHandle>
+    struct node_insert_return {
+        Iterator   position;
+        bool       inserted;
+        NodeHandle node;
+    };
+
+    /**
+     * Red-black tree container.
+     * Elements are ordered and looked up by their key only, so searching never builds an element.
+     * The end node is the parent of the root, its left child is the root and its right child the rightmost node,
+     * the leftmost node is cached in _leftmost, so begin(), rbegin() and the first and last elements are O(1)
+     * @tparam Key        Type of the keys
+     * @tparam T          Type of the elements
+     * @tparam KeyOfValue Function object that returns the key of an element, ft::identity or ft::select1st
+     * @tparam Compare    A binary predicate that takes two element keys as arguments and returns a bool
+     * @tparam Alloc      Type of the allocator object used to define the storage allocation model
+     * @tparam NodePolicy ft::no_order_statistics, or ft::order_statistics to keep subtree sizes in the nodes
+     * @tparam NodeAlloc  Type of the allocator object used to define the storage allocation model for nodes
+     */
+    template< typename Key, typename T, typename KeyOfValue, typename Compare = ft::less<Key>, typename Alloc = std::allocator<T>,
+              typename NodePolicy = no_order_statistics,
+              typename NodeAlloc = typename Alloc::template rebind< typename NodePolicy::template node<T>::type >::other >
     class RBTree {
     public:
+        typedef Key                                     key_type;
         typedef T                                       value_type;
         typedef Alloc                                   allocator_type;
         typedef NodeAlloc                               node_allocator_type;
-        typedef Compare                                 value_compare;
+        typedef Compare                                 key_compare;
         typedef rb_tree_iterator<T, T*, T&>             iterator;
         typedef rb_tree_iterator<T, const T*, const T&> const_iterator;
         typedef ft::reverse_iterator<iterator>          reverse_iterator;
         typedef ft::reverse_iterator<const_iterator>    const_reverse_iterator;
         typedef ptrdiff_t                               difference_type;
         typedef size_t                                  size_type;
+        typedef rb_tree_node_handle<T, Alloc, NodeAlloc>       node_handle_type;
+        typedef node_insert_return<iterator, node_handle_type> insert_return_type;
 
     private:
+        typedef typename NodePolicy::template node<value_type>::type node_type;
+
         allocator_type         _alloc;
         node_allocator_type    _node_alloc;
-        value_compare          _comp;
+        key_compare            _comp;
         RBTreeNode<value_type> *_root;
         RBTreeNode<value_type> *_end;
+        RBTreeNode<value_type> *_leftmost;
         size_type              _size;
 
+        static const key_type               &_key(const RBTreeNode<value_type> *node);
         RBTreeNode<value_type>              *_find_leftmost_node(RBTreeNode<value_type> *node) const;
         RBTreeNode<value_type>              *_find_rightmost_node(RBTreeNode<value_type> *node) const;
+# if FT_CXX11
+        template<typename... Args>
+        RBTreeNode<value_type>              *_create_node(Args&&... args);
+# else
         RBTreeNode<value_type>              *_create_node(const value_type &val);
+# endif
+        RBTreeNode<value_type>              *_create_end_node();
+        void                                _relink_end();
         void                                _clear_node(RBTreeNode<value_type> *node);
-        pair<RBTreeNode<value_type>*, bool> _bst_insert(RBTreeNode<value_type> *node);
-        RBTreeNode<value_type>              *_bst_erase(RBTreeNode<value_type> *node);
+        pair<RBTreeNode<value_type>*, int>  _insert_position(const key_type &k) const;
+        pair<RBTreeNode<value_type>*, int>  _insert_position(iterator position, const key_type &k) const;
+        pair<iterator, bool>                _insert_node(RBTreeNode<value_type> *node);
+        iterator                            _insert_node(iterator position, RBTreeNode<value_type> *node);
+        iterator                            _link_node(RBTreeNode<value_type> *node, RBTreeNode<value_type> *parent, bool left);
+        RBTreeNode<value_type>              *_prev_node(RBTreeNode<value_type> *node) const;
+        RBTreeNode<value_type>              *_next_node(RBTreeNode<value_type> *node) const;
+        void                                _bst_erase(RBTreeNode<value_type> *node);
+        void                                _unlink_node(RBTreeNode<value_type> *node);
+        void                                _replace_child(RBTreeNode<value_type> *node, RBTreeNode<value_type> *replacement);
         void                                _bst_clear(RBTreeNode<value_type> *node);
-        RBTreeNode<typename RBTree<T, Compare, Alloc, NodeAlloc>::value_type> *
-        _bst_clone(RBTreeNode <value_type> *node, RBTreeNode <value_type> *parent);
-        RBTreeNode<value_type>              *_bst_find(const value_type &val, RBTreeNode<value_type> *node) const;
-        RBTreeNode<value_type>              *_bst_lower_bound(const value_type &val, RBTreeNode<value_type> *node) const;
-        RBTreeNode<value_type>              *_bst_upper_bound(const value_type &val, RBTreeNode<value_type> *node) const;
+        void                                _bst_release(RBTreeNode<value_type> *node, RBTreeNode<value_type> *&chain);
+        void                                _clear_chain(RBTreeNode<value_type> *chain);
+        RBTreeNode<value_type>              *_reuse_node(RBTreeNode<value_type> *&chain, const value_type &val);
+        void                                _copy_value(RBTreeNode<value_type> *node, const value_type &val, ft::true_type);
+        void                                _copy_value(RBTreeNode<value_type> *node, const value_type &val, ft::false_type);
+        RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *
+        _bst_clone(RBTreeNode <value_type> *node, RBTreeNode <value_type> *parent, RBTreeNode<value_type> *&reuse);
+        static void                         _prefetch_children(const RBTreeNode<value_type> *node);
+        template<typename K>
+        int                                 _compare(const K &k, const RBTreeNode<value_type> *node) const;
+        template<typename K>
+        RBTreeNode<value_type>              *_bst_find(const K &k) const;
+        template<typename K>
+        RBTreeNode<value_type>              *_bst_lower_bound(const K &k, RBTreeNode<value_type> *node,
+                                                              RBTreeNode<value_type> *bound) const;
+        template<typename K>
+        RBTreeNode<value_type>              *_bst_upper_bound(const K &k, RBTreeNode<value_type> *node,
+                                                              RBTreeNode<value_type> *bound) const;
+        template<typename K>
+        pair<RBTreeNode<value_type>*, RBTreeNode<value_type>*> _bst_equal_range(const K &k) const;
+        template<typename K>
+        RBTreeNode<value_type>              *_finger_lower_bound(const K &k, RBTreeNode<value_type> *node) const;
+        template<typename Iterator, typename ForwardIterator, typename OutputIterator>
+        OutputIterator                      _find_batch_sorted(ForwardIterator first, ForwardIterator last,
+                                                               OutputIterator out) const;
+        template<typename Iterator, typename ForwardIterator, typename OutputIterator>
+        OutputIterator                      _find_batch_interleaved(ForwardIterator first, ForwardIterator last,
+                                                                    OutputIterator out) const;
+        template<typename Iterator, typename ForwardIterator, typename OutputIterator>
+        OutputIterator                      _find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const;
         void                                _rotateLeft(RBTreeNode<value_type> *node);
         void                                _rotateRight(RBTreeNode<value_type> *node);
-        void                                _balance(RBTreeNode<value_type> *node);
+        bool                                _balance(RBTreeNode<value_type> *node);
+        void                                _erase_balance(RBTreeNode<value_type> *node, RBTreeNode<value_type> *parent);
+        static size_type                    _black_height(const RBTreeNode<value_type> *node);
+        RBTreeNode<value_type>              *_join(RBTreeNode<value_type> *left, size_type left_height,
+                                                   RBTreeNode<value_type> *pivot,
+                                                   RBTreeNode<value_type> *right, size_type right_height,
+                                                   size_type &height);
+        template<typename K>
+        void                                _split(RBTreeNode<value_type> *node, size_type height, const K &k,
+                                                   RBTreeNode<value_type> *&lo, size_type &lo_height,
+                                                   RBTreeNode<value_type> *&hi, size_type &hi_height);
+        void                                _move_nodes(RBTree &x);
+        template<typename InputIterator>
+        void                                _build_sorted(InputIterator &first, InputIterator last, bool check);
+        RBTreeNode<value_type>              *_build_balanced(RBTreeNode<value_type> *&chain, size_type n,
+                                                             size_type depth, size_type red_depth);
+# if FT_CXX11
+        void                                _top_nodes(RBTreeNode<value_type> *node, size_type depth,
+                                                       std::vector<RBTreeNode<value_type>*> &out) const;
+        template<typename InputIterator>
+        static void                         _insert_sorted_part(RBTree *tree, InputIterator first, InputIterator last,
+                                                                std::exception_ptr *error);
+# endif
+        size_type                           _height(const RBTreeNode<value_type> *node) const;
+        int                                 _verify_subtree(const RBTreeNode<value_type> *node) const;
+        static void                         _update_count(RBTreeNode<value_type> *node);
+        void                                _add_count(RBTreeNode<value_type> *node, ptrdiff_t diff);
+        template<typename K>
+        size_type                           _rank(const K &k) const;
         void                                _print(RBTreeNode<value_type> *root, int space) const;
 
     public:
-        RBTree(const value_compare &comp = value_compare(), const allocator_type &alloc = allocator_type(), const node_allocator_type &node_alloc = node_allocator_type());
+        RBTree(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
+        RBTree(const key_compare &comp, const allocator_type &alloc, const node_allocator_type &node_alloc);
         RBTree(const RBTree &src);
+# if FT_CXX11
+        RBTree(RBTree &&src);
+# endif
 
         ~RBTree();
 
         RBTree                               &operator=(const RBTree &other);
+# if FT_CXX11
+        RBTree                               &operator=(RBTree &&other);
+# endif
 
         iterator                             begin();
         const_iterator                       begin() const;
@@ -105,45 +505,100 @@ namespace ft {
 
         pair<iterator, bool>                 insert(const value_type &value);
         iterator                             insert(iterator position, const value_type &val);
+# if FT_CXX11
+        pair<iterator, bool>                 insert(value_type &&val);
+        iterator                             insert(iterator position, value_type &&val);
+        template<typename... Args>
+        pair<iterator, bool>                 emplace(Args&&... args);
+        template<typename... Args>
+        iterator                             emplace_hint(iterator position, Args&&... args);
+# endif
         template<typename InputIterator>
         void                                 insert(InputIterator first, InputIterator last,
                                                     typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        void                                 insert(assume_sorted_t, InputIterator first, InputIterator last);
+        insert_return_type                   insert(const node_handle_type &nh);
+        iterator                             insert(iterator position, const node_handle_type &nh);
 
         void                                 erase(iterator position);
-        size_type                            erase(const value_type &val);
+        size_type                            erase(const key_type &k);
         void                                 erase(iterator first, iterator last);
 
+        node_handle_type                     extract(iterator position);
+        node_handle_type                     extract(const key_type &k);
+
         void                                 swap(RBTree &x);
         void                                 clear();
 
-        value_compare                        value_comp() const;
+        void                                 split(const key_type &k, RBTree &x);
+        void                                 join(RBTree &x);
+# if FT_CXX11
+        template<typename ValueCompare>
+        void                                 assign_set_operation(parallel_t policy, set_operation op,
+                                                                  const RBTree &x, const RBTree &y, ValueCompare comp);
+# endif
+
+        key_compare                          key_comp() const;
+
+        template<typename K>
+        iterator                             find(const K &k);
+        template<typename K>
+        const_iterator                       find(const K &k) const;
 
-        iterator                             find(const value_type &val);
-        const_iterator                       find(const value_type &val) const;
+        template<typename K>
+        size_type                            count(const K &k) const;
 
-        size_type                            count(const value_type &val) const;
+        template<typename K>
+        iterator                             lower_bound(const K &k);
+        template<typename K>
+        const_iterator                       lower_bound(const K &k) const;
 
-        iterator                             lower_bound(const value_type &val);
-        const_iterator                       lower_bound(const value_type &val) const;
+        template<typename K>
+        iterator                             upper_bound(const K &k);
+        template<typename K>
+        const_iterator                       upper_bound(const K &k) const;
 
-        iterator                             upper_bound(const value_type &val);
-        const_iterator                       upper_bound(const value_type &val) const;
+        template<typename K>
+        pair<iterator, iterator>             equal_range(const K &k);
+        template<typename K>
+        pair<const_iterator, const_iterator> equal_range(const K &k) const;
 
-        pair<iterator, iterator>             equal_range(const value_type &val);
-        pair<const_iterator, const_iterator> equal_range(const value_type &val) const;
+        template<typename ForwardIterator, typename OutputIterator>
+        OutputIterator                       find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out);
+        template<typename ForwardIterator, typename OutputIterator>
+        OutputIterator                       find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const;
 
         allocator_type                       get_allocator() const;
 
+        iterator                             nth(size_type n);
+        const_iterator                       nth(size_type n) const;
+        size_type                            rank(const key_type &k) const;
+        size_type                            count_range(const key_type &lo, const key_type &hi) const;
+
+        size_type                            height() const;
+        bool                                 verify() const;
+
         void                                 print() const;
     };
 
+    /**
+     * Get key of the element of a node
+     * @param node Node holding a constructed element
+     * @return The key, as returned by KeyOfValue
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    const typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::key_type &RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_key(const RBTreeNode<value_type> *node) {
+        return (KeyOfValue()(node->value()));
+    }
+
     /**
      * Find leftmost child of given node
      * @param node Root node
      * @return Leftmost child
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTreeNode<typename RBTree<T, Compare, Alloc, NodeAlloc>::value_type> *RBTree<T, Compare, Alloc, NodeAlloc>::_find_leftmost_node(RBTreeNode<value_type> *node) const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_find_leftmost_node(RBTreeNode<value_type> *node) const {
         while (node && node->left)
             node = node->left;
         return (node);
@@ -154,244 +609,553 @@ namespace ft {
      * @param node Root node
      * @return Rightmost child
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTreeNode<typename RBTree<T, Compare, Alloc, NodeAlloc>::value_type> *RBTree<T, Compare, Alloc, NodeAlloc>::_find_rightmost_node(RBTreeNode<value_type> *node) const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_find_rightmost_node(RBTreeNode<value_type> *node) const {
         while (node && node->right)
             node = node->right;
         return (node);
     }
 
+# if FT_CXX11
     /**
-     * Creates new node
+     * Creates new node, the value is constructed inside the node with a single allocation
+     * @param args Arguments forwarded to the constructor of the value
+     * @return New node
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename... Args>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_create_node(Args&&... args) {
+        RBTreeNode<value_type> *node = _create_end_node();
+
+        try {
+            ft::allocator_construct(_alloc, node->valptr(), std::forward<Args>(args)...);
+        } catch (...) {
+            _node_alloc.destroy(static_cast<node_type*>(node));
+            _node_alloc.deallocate(static_cast<node_type*>(node), 1);
+            throw;
+        }
+
+        return (node);
+    }
+# else
+    /**
+     * Creates new node, the value is constructed inside the node with a single allocation
      * @param val Value of new node
      * @return New node
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTreeNode<typename RBTree<T, Compare, Alloc, NodeAlloc>::value_type> *RBTree<T, Compare, Alloc, NodeAlloc>::_create_node(const value_type &val) {
-        value_type *p = _alloc.allocate(1);
-        _alloc.construct(p, val);
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_create_node(const value_type &val) {
+        RBTreeNode<value_type> *node = _create_end_node();
+
+        try {
+            _alloc.construct(node->valptr(), val);
+        } catch (...) {
+            _node_alloc.destroy(static_cast<node_type*>(node));
+            _node_alloc.deallocate(static_cast<node_type*>(node), 1);
+            throw;
+        }
 
-        RBTreeNode<value_type> *node = _node_alloc.allocate(1);
-        _node_alloc.construct(node, RBTreeNode<value_type>(p));
+        return (node);
+    }
+# endif
 
+    /**
+     * Creates node without value, used as the end node
+     * @return New node
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_create_end_node() {
+        node_type *node = _node_alloc.allocate(1);
+        new(static_cast<void*>(node)) node_type();
         return (node);
     }
 
     /**
-     * Destroy and deallocate one node
-     * @param node
+     * Link the root below the end node and recompute the leftmost and rightmost nodes,
+     * after the whole tree was replaced
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::_clear_node(RBTreeNode<value_type> *node) {
-        if (node->value) {
-            _alloc.destroy(node->value);
-            _alloc.deallocate(node->value, 1);
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_relink_end() {
+        if (_root) {
+            _root->parent = _end;
+            _end->left = _root;
+            _end->right = _find_rightmost_node(_root);
+            _leftmost = _find_leftmost_node(_root);
+        } else {
+            _end->left = NULL;
+            _end->right = NULL;
+            _leftmost = _end;
         }
-        _node_alloc.destroy(node);
-        _node_alloc.deallocate(node, 1);
     }
 
     /**
-     * Inserts new node to binary search tree
+     * Destroy and deallocate one node
      * @param node
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    pair<RBTreeNode<typename RBTree<T, Compare, Alloc, NodeAlloc>::value_type>*, bool> RBTree<T, Compare, Alloc, NodeAlloc>::_bst_insert(RBTreeNode<value_type> *node) {
-        if (!_root) {
-            _root = node;
-            return (ft::make_pair(node, true));
-        }
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_clear_node(RBTreeNode<value_type> *node) {
+        if (node != _end)
+            _alloc.destroy(node->valptr());
+        _node_alloc.destroy(static_cast<node_type*>(node));
+        _node_alloc.deallocate(static_cast<node_type*>(node), 1);
+    }
 
-        RBTreeNode<T> *x = _root;
-        RBTreeNode<T> *y = NULL;
+    /**
+     * Unlink one node from the tree and restore the red-black properties, the node itself is left untouched.
+     * A node with two children is replaced by its in-order predecessor: the predecessor node is unlinked
+     * from its own position and spliced into the place of the node, taking over its children and its color,
+     * so no element is copied and iterators to other elements stay valid. The position left empty has
+     * at most one child; if it held a black node, its subtree is one black node short, which _erase_balance repairs
+     * @param node Node to unlink
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_bst_erase(RBTreeNode<value_type> *node) {
+        RBTreeNode<value_type> *child;
+        RBTreeNode<value_type> *parent;
+        bool                   black;
 
-        while (x) {
-            y = x;
+        if (node->left && node->right) {
+            RBTreeNode<value_type> *prev = _find_rightmost_node(node->left);
 
-            if (_comp(*x->value, *node->value))
-                x = y->right;
-            else if (_comp(*node->value, *x->value))
-                x = y->left;
-            else
-                return (ft::make_pair(x, false));
+            child = prev->left;
+            if (prev == node->left) {
+                parent = prev;
+            } else {
+                parent = prev->parent;
+                parent->right = child;
+                if (child)
+                    child->parent = parent;
+                prev->left = node->left;
+                node->left->parent = prev;
+            }
+            prev->right = node->right;
+            node->right->parent = prev;
+            _replace_child(node, prev);
+            black = !prev->color;
+            prev->color = node->color;
+            NodePolicy::set_count(prev, NodePolicy::count(node));
+        } else {
+            child = node->left ? node->left : node->right;
+            parent = node->parent;
+            _replace_child(node, child);
+            black = !node->color;
         }
 
-        node->parent = y;
+        _add_count(parent, -1);
+        if (black)
+            _erase_balance(child, parent);
+    }
 
-        if (_comp(*y->value, *node->value))
-            y->right = node;
-        else
-            y->left = node;
+    /**
+     * Put a node, or nothing, in the place of another node under the parent of the latter
+     * @param node        Node whose place is taken
+     * @param replacement Node taking the place, may be NULL
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_replace_child(RBTreeNode<value_type> *node, RBTreeNode<value_type> *replacement) {
+        RBTreeNode<value_type> *parent = node->parent;
 
-        return (ft::make_pair(node, true));
+        if (replacement)
+            replacement->parent = parent;
+        if (parent == _end)
+            _root = replacement;
+        else if (parent->left == node)
+            parent->left = replacement;
+        else
+            parent->right = replacement;
     }
 
     /**
-     * Remove one node from binary search tree
-     * @param node
-     * @return Node to perform balance function
+     * Clear binary search tree
+     * @param node Root
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTreeNode<typename RBTree<T, Compare, Alloc, NodeAlloc>::value_type> *RBTree<T, Compare, Alloc, NodeAlloc>::_bst_erase(RBTreeNode<value_type> *node) {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_bst_clear(RBTreeNode<value_type> *node) {
         if (!node)
-            return (NULL);
+            return;
+        _bst_clear(node->left);
+        _bst_clear(node->right);
+        _clear_node(node);
+    }
 
-        RBTreeNode<value_type> *parent = node->parent;
+    /**
+     * Chain the nodes of a subtree through their right pointer, without destroying them, for _bst_clone to reuse
+     * @param node  Root of the subtree
+     * @param chain Chain the nodes are pushed on
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_bst_release(RBTreeNode<value_type> *node, RBTreeNode<value_type> *&chain) {
+        if (!node)
+            return;
+        _bst_release(node->left, chain);
+        _bst_release(node->right, chain);
+        node->right = chain;
+        chain = node;
+    }
 
-        if (!node->left && !node->right) {
-            if (parent == _end) {
-                _root = NULL;
-            } else if (parent->left == node) {
-                parent->left = NULL;
-            } else {
-                parent->right = NULL;
-            }
+    /**
+     * Destroy and deallocate the nodes of a chain left by _bst_release
+     * @param chain First node of the chain
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_clear_chain(RBTreeNode<value_type> *chain) {
+        while (chain) {
+            RBTreeNode<value_type> *next = chain->right;
 
-            _clear_node(node);
-            return (parent);
+            _clear_node(chain);
+            chain = next;
         }
+    }
 
-        if (!node->right) {
-            RBTreeNode<value_type> *left = node->left;
-
-            if (node->parent == _end) {
-                _root = left;
-                left->parent = NULL;
-            } else if (node->parent->left == node) {
-                node->parent->left = left;
-                left->parent = node->parent;
-            } else {
-                node->parent->right = left;
-                left->parent = node->parent;
-            }
-
-            _clear_node(node);
-            return (left);
+    /**
+     * Take the first node of a chain of released nodes and replace its element with a copy of val in place,
+     * a new node is created only once the chain is empty. If the copy throws, the taken node is freed
+     * @param chain Chain of released nodes, advanced past the taken node
+     * @param val   Value of the element
+     * @return Node without children
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_reuse_node(RBTreeNode<value_type> *&chain, const value_type &val) {
+        if (!chain)
+            return (_create_node(val));
+
+        RBTreeNode<value_type> *node = chain;
+
+        chain = node->right;
+        try {
+            _copy_value(node, val, ft::integral_constant<bool, ft::is_copy_assignable<value_type>::value>());
+        } catch (...) {
+            _node_alloc.destroy(static_cast<node_type*>(node));
+            _node_alloc.deallocate(static_cast<node_type*>(node), 1);
+            throw;
         }
+        node->left = NULL;
+        node->right = NULL;
 
-        if (!node->left) {
-            RBTreeNode<value_type> *right = node->right;
-
-            if (node->parent == _end) {
-                _root = right;
-                right->parent = NULL;
-            } else if (node->parent->left == node) {
-                node->parent->left = right;
-                right->parent = node->parent;
-            } else {
-                node->parent->right = right;
-                right->parent = node->parent;
-            }
+        return (node);
+    }
 
-            _clear_node(node);
-            return (right);
+    /**
+     * Copy val over the element of a node by assignment, so that the element can keep the memory it owns.
+     * If the assignment throws, the element is destroyed
+     * @param node Node holding an element
+     * @param val  Value of the element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_copy_value(RBTreeNode<value_type> *node, const value_type &val, ft::true_type) {
+        try {
+            node->value() = val;
+        } catch (...) {
+            _alloc.destroy(node->valptr());
+            throw;
         }
-
-        RBTreeNode<value_type> *prev = _find_rightmost_node(node->left);
-
-        _alloc.destroy(node->value);
-        _alloc.construct(node->value, *prev->value);
-
-        return (_bst_erase(prev));
     }
 
     /**
-     * Clear binary search tree
-     * @param node Root
+     * Copy val over the element of a node, for elements that cannot be assigned such as the pairs of a map:
+     * the element is destroyed and copy constructed in place. If the copy throws, the node holds no element
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::_bst_clear(RBTreeNode<value_type> *node) {
-        if (!node)
-            return;
-        _bst_clear(node->left);
-        _bst_clear(node->right);
-        _clear_node(node);
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_copy_value(RBTreeNode<value_type> *node, const value_type &val, ft::false_type) {
+        _alloc.destroy(node->valptr());
+        _alloc.construct(node->valptr(), val);
     }
 
     /**
-     * Clone binary tree
+     * Clone binary tree, taking the nodes from a chain of released nodes first.
+     * If copying an element throws, the nodes cloned so far are destroyed
      * @param node   Root of old tree
      * @param parent Pointer to the parent
+     * @param reuse  Chain of released nodes, NULL to allocate every node
      * @return Root of new tree
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTreeNode<typename RBTree<T, Compare, Alloc, NodeAlloc>::value_type> *RBTree<T, Compare, Alloc, NodeAlloc>::_bst_clone(RBTreeNode <value_type> *node, RBTreeNode <value_type> *parent) {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_bst_clone(RBTreeNode <value_type> *node, RBTreeNode <value_type> *parent, RBTreeNode<value_type> *&reuse) {
         if (!node)
             return (NULL);
 
-        RBTreeNode<value_type> *new_node = _create_node(*node->value);
+        RBTreeNode<value_type> *new_node = _reuse_node(reuse, node->value());
         new_node->parent = parent;
         new_node->color = node->color;
-
-        new_node->left = _bst_clone(node->left, new_node);
-        new_node->right = _bst_clone(node->right, new_node);
+        NodePolicy::set_count(new_node, NodePolicy::count(node));
+
+        try {
+            new_node->left = _bst_clone(node->left, new_node, reuse);
+            new_node->right = _bst_clone(node->right, new_node, reuse);
+        } catch (...) {
+            _bst_clear(new_node);
+            throw;
+        }
 
         return (new_node);
     }
 
     /**
-     * Find node in binary search tree
-     * @param val  Value to be searched for
-     * @param node Root
-     * @return A pointer to the node, if a node with specified value is found, pointer to end otherwise
+     * Prefetch both children of a node, only one of them is visited next but the choice is not known yet.
+     * Does nothing unless FT_RB_TREE_PREFETCH is set
+     * @param node Node being visited
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTreeNode<typename RBTree<T, Compare, Alloc, NodeAlloc>::value_type> *
-    RBTree<T, Compare, Alloc, NodeAlloc>::_bst_find(const value_type &val, RBTreeNode<value_type> *node) const {
-        if (!node)
-            return (_end);
-        if (_comp(*node->value, val))
-            return (_bst_find(val, node->right));
-        else if (_comp(val, *node->value))
-            return (_bst_find(val, node->left));
-        else
-            return (node);
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_prefetch_children(const RBTreeNode<value_type> *node) {
+# if FT_RB_TREE_PREFETCH
+        FT_PREFETCH(node->left);
+        FT_PREFETCH(node->right);
+# else
+        (void)node;
+# endif
     }
 
     /**
-     * Return pointer to lower bound node
-     * @param val  Value to search for
-     * @param node Root
-     * @return
+     * Compare a key with the key of a node through three_way_compare
+     * @param k    Key
+     * @param node Node
+     * @return A negative number, zero or a positive number when k goes before, is equivalent to or goes after the node
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTreeNode<typename RBTree<T, Compare, Alloc, NodeAlloc>::value_type> *
-    RBTree<T, Compare, Alloc, NodeAlloc>::_bst_lower_bound(const value_type &val, RBTreeNode<value_type> *node) const {
-        if (!node)
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    int RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_compare(const K &k, const RBTreeNode<value_type> *node) const {
+        return (three_way_compare<Compare, K>::compare(_comp, k, _key(node)));
+    }
+
+    /**
+     * Find node in binary search tree. A three-way comparator stops the descent at the first equivalent node,
+     * otherwise the lower bound is the only candidate, so the descent costs one comparison per level and one more at the end
+     * @param k Key to be searched for
+     * @return A pointer to the node, if a node with specified key is found, pointer to end otherwise
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_bst_find(const K &k) const {
+        if (three_way_compare<Compare, K>::value) {
+            RBTreeNode<value_type> *node = _root;
+
+            while (node) {
+                _prefetch_children(node);
+                int c = _compare(k, node);
+                if (c < 0)
+                    node = node->left;
+                else if (c > 0)
+                    node = node->right;
+                else
+                    return (node);
+            }
             return (_end);
-        if (_comp(*node->value, val))
-            return (_bst_lower_bound(val, node->right));
-        else {
-            RBTreeNode<value_type> *left = _bst_lower_bound(val, node->left);
-            return (left != _end ? left : node);
         }
+
+        RBTreeNode<value_type> *node = _bst_lower_bound(k, _root, _end);
+
+        if (node == _end || _comp(k, _key(node)))
+            return (_end);
+        return (node);
     }
 
     /**
-     * Return pointer to upper bound node
-     * @param val  Value to search for
-     * @param node Root
-     * @return
+     * Return pointer to lower bound node, the descent keeps the last node that does not go before k
+     * @param k     Key to search for
+     * @param node  Root of the subtree to search
+     * @param bound Node returned if no node of the subtree qualifies
+     * @return The first node whose key is not considered to go before k
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTreeNode<typename RBTree<T, Compare, Alloc, NodeAlloc>::value_type> *
-    RBTree<T, Compare, Alloc, NodeAlloc>::_bst_upper_bound(const value_type &val, RBTreeNode<value_type> *node) const {
-        if (!node)
-            return (_end);
-        if (!_comp(val, *node->value))
-            return (_bst_upper_bound(val, node->right));
-        else {
-            RBTreeNode<value_type> *left = _bst_upper_bound(val, node->left);
-            return (left != _end ? left : node);
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_bst_lower_bound(const K &k, RBTreeNode<value_type> *node, RBTreeNode<value_type> *bound) const {
+        while (node) {
+            _prefetch_children(node);
+            if (!_comp(_key(node), k)) {
+                bound = node;
+                node = node->left;
+            } else {
+                node = node->right;
+            }
+        }
+        return (bound);
+    }
+
+    /**
+     * Return pointer to upper bound node, the descent keeps the last node that goes after k
+     * @param k     Key to search for
+     * @param node  Root of the subtree to search
+     * @param bound Node returned if no node of the subtree qualifies
+     * @return The first node whose key is considered to go after k
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_bst_upper_bound(const K &k, RBTreeNode<value_type> *node, RBTreeNode<value_type> *bound) const {
+        while (node) {
+            _prefetch_children(node);
+            if (_comp(k, _key(node))) {
+                bound = node;
+                node = node->left;
+            } else {
+                node = node->right;
+            }
         }
+        return (bound);
+    }
+
+    /**
+     * Return pointers to the bounds of the range of nodes equivalent to k.
+     * Both bounds share the descent down to the first equivalent node, where it splits into a lower bound
+     * search of the left subtree and an upper bound search of the right subtree
+     * @param k Key to search for
+     * @return The lower bound and the upper bound nodes
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    pair<RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type>*, RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type>*>
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_bst_equal_range(const K &k) const {
+        RBTreeNode<value_type> *node = _root;
+        RBTreeNode<value_type> *upper = _end;
+
+        while (node) {
+            _prefetch_children(node);
+            int c = _compare(k, node);
+            if (c > 0) {
+                node = node->right;
+            } else if (c < 0) {
+                upper = node;
+                node = node->left;
+            } else {
+                return (ft::make_pair(_bst_lower_bound(k, node->left, node),
+                                      _bst_upper_bound(k, node->right, upper)));
+            }
+        }
+        return (ft::make_pair(upper, upper));
+    }
+
+    /**
+     * Return pointer to lower bound node, starting from a node whose key goes before k instead of from the root.
+     * The nodes between node and the first ancestor it is a left descendant of are its right subtree:
+     * climb until that ancestor does not go before k, then search the right subtree with the ancestor as bound.
+     * Takes time logarithmic in the distance between node and the result
+     * @param k    Key to search for
+     * @param node Node of the tree whose key goes before k
+     * @return The first node whose key is not considered to go before k
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_finger_lower_bound(const K &k, RBTreeNode<value_type> *node) const {
+        while (true) {
+            RBTreeNode<value_type> *up = node;
+
+            while (up->parent != _end && up == up->parent->right)
+                up = up->parent;
+            up = up->parent;
+            if (up == _end || !_comp(_key(up), k))
+                return (_bst_lower_bound(k, node->right, up));
+            node = up;
+        }
+    }
+
+    /**
+     * Look up sorted keys as a merge with the tree: the lower bound of each key is searched from the lower bound
+     * of the previous one, so close keys cost a few steps and the whole batch at most one walk of the tree
+     * @param first Forward iterator to the first key, the keys are sorted
+     * @param last  Forward iterator past the last key
+     * @param out   Output iterator that receives one Iterator per key, to the element or to end
+     * @return out past the last iterator written
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename Iterator, typename ForwardIterator, typename OutputIterator>
+    OutputIterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_find_batch_sorted(ForwardIterator first, ForwardIterator last, OutputIterator out) const {
+        RBTreeNode<value_type> *node = NULL;
+
+        for (; first != last; ++first, ++out) {
+            if (!node)
+                node = _bst_lower_bound(*first, _root, _end);
+            else if (node != _end && _comp(_key(node), *first))
+                node = _finger_lower_bound(*first, node);
+            *out = Iterator(node == _end || _comp(*first, _key(node)) ? _end : node);
+        }
+        return (out);
+    }
+
+    /**
+     * Look up keys in groups of FT_RB_TREE_BATCH_LANES descents advanced in lockstep: each round moves every descent
+     * one level down and prefetches the node it will read in the next round, so the cache misses of the whole group
+     * overlap instead of following each other. The descents search the lower bound, then check it for equality
+     * @param first Forward iterator to the first key
+     * @param last  Forward iterator past the last key
+     * @param out   Output iterator that receives one Iterator per key, to the element or to end
+     * @return out past the last iterator written
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename Iterator, typename ForwardIterator, typename OutputIterator>
+    OutputIterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_find_batch_interleaved(ForwardIterator first, ForwardIterator last, OutputIterator out) const {
+        ForwardIterator        keys[FT_RB_TREE_BATCH_LANES];
+        RBTreeNode<value_type> *node[FT_RB_TREE_BATCH_LANES];
+        RBTreeNode<value_type> *bound[FT_RB_TREE_BATCH_LANES];
+
+        while (first != last) {
+            size_type lanes = 0;
+
+            for (; lanes < FT_RB_TREE_BATCH_LANES && first != last; ++lanes, ++first) {
+                keys[lanes] = first;
+                node[lanes] = _root;
+                bound[lanes] = _end;
+            }
+            for (bool active = true; active;) {
+                active = false;
+                for (size_type i = 0; i < lanes; i++) {
+                    if (!node[i])
+                        continue;
+                    if (!_comp(_key(node[i]), *keys[i])) {
+                        bound[i] = node[i];
+                        node[i] = node[i]->left;
+                    } else {
+                        node[i] = node[i]->right;
+                    }
+                    FT_PREFETCH(node[i]);
+                    active |= node[i] != NULL;
+                }
+            }
+            for (size_type i = 0; i < lanes; i++, ++out)
+                *out = Iterator(bound[i] == _end || _comp(*keys[i], _key(bound[i])) ? _end : bound[i]);
+        }
+        return (out);
+    }
+
+    /**
+     * Look up a batch of keys with the cheapest strategy. Checking whether the keys are sorted costs one comparison
+     * per key, against one per level of the tree for a descent. A sorted batch holding at least one key per 32 elements
+     * is merged with the tree; on a sparser batch the merge climbs and descends most of the tree for every key.
+     * Interleaving pays off once the tree outgrows the cache, a smaller tree is searched one key after the other
+     * @param first Forward iterator to the first key
+     * @param last  Forward iterator past the last key
+     * @param out   Output iterator that receives one Iterator per key
+     * @return out past the last iterator written
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename Iterator, typename ForwardIterator, typename OutputIterator>
+    OutputIterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const {
+        if (first == last)
+            return (out);
+
+        ForwardIterator prev = first;
+        ForwardIterator it = first;
+        size_type       count = 1;
+
+        for (++it; it != last && !_comp(*it, *prev); ++it, ++prev)
+            count++;
+        if (it == last && _size / count <= 32)
+            return (_find_batch_sorted<Iterator>(first, last, out));
+        if (_size >= 4096)
+            return (_find_batch_interleaved<Iterator>(first, last, out));
+        for (; first != last; ++first, ++out)
+            *out = Iterator(_bst_find(*first));
+        return (out);
     }
 
     /**
      * Rotate subtree left
      * @param node Root
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::_rotateLeft(RBTreeNode<value_type> *node) {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_rotateLeft(RBTreeNode<value_type> *node) {
         RBTreeNode<value_type> *right = node->right;
         node->right = right->left;
 
@@ -400,7 +1164,7 @@ namespace ft {
 
         right->parent = node->parent;
 
-        if (!node->parent)
+        if (!node->parent || node->parent == _end)
             _root = right;
         else if (node == node->parent->left)
             node->parent->left = right;
@@ -409,14 +1173,19 @@ namespace ft {
 
         right->left = node;
         node->parent = right;
+
+        if (NodePolicy::enabled) {
+            NodePolicy::set_count(right, NodePolicy::count(node));
+            _update_count(node);
+        }
     }
 
     /**
      * Rotate subtree right
      * @param node Root
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::_rotateRight(RBTreeNode<value_type> *node) {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_rotateRight(RBTreeNode<value_type> *node) {
         RBTreeNode<value_type> *left = node->left;
         node->left = left->right;
 
@@ -425,7 +1194,7 @@ namespace ft {
 
         left->parent = node->parent;
 
-        if (!node->parent)
+        if (!node->parent || node->parent == _end)
             _root = left;
         else if (node == node->parent->left)
             node->parent->left = left;
@@ -434,14 +1203,20 @@ namespace ft {
 
         left->right = node;
         node->parent = left;
+
+        if (NodePolicy::enabled) {
+            NodePolicy::set_count(left, NodePolicy::count(node));
+            _update_count(node);
+        }
     }
 
     /**
      * Balance red-black tree
      * @param node
+     * @return Whether the root was red and had to be made black, which adds one to the black height of the tree
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::_balance(RBTreeNode<value_type> *node) {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    bool RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_balance(RBTreeNode<value_type> *node) {
         RBTreeNode<value_type> *parent;
         RBTreeNode<value_type> *grandparent;
         RBTreeNode<value_type> *uncle;
@@ -491,103 +1266,486 @@ namespace ft {
             }
         }
 
+        bool grown = _root->color;
+
         _root->color = false;
+        return (grown);
     }
 
     /**
-     * Default constructor
+     * Balance red-black tree after a black node was unlinked: the subtree rooted at node has one black node less
+     * than its sibling. The deficit is pushed up while the sibling and its children are black, and removed by at
+     * most three rotations otherwise
+     * @param node   Node that took the place of the unlinked one, may be NULL
+     * @param parent Parent of node
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_erase_balance(RBTreeNode<value_type> *node, RBTreeNode<value_type> *parent) {
+        RBTreeNode<value_type> *sibling;
+
+        while (node != _root && (!node || !node->color)) {
+            if (node == parent->left) {
+                sibling = parent->right;
+
+                if (sibling->color) {
+                    sibling->color = false;
+                    parent->color = true;
+                    _rotateLeft(parent);
+                    sibling = parent->right;
+                }
+
+                if ((!sibling->left || !sibling->left->color) && (!sibling->right || !sibling->right->color)) {
+                    sibling->color = true;
+                    node = parent;
+                    parent = node->parent;
+                } else {
+                    if (!sibling->right || !sibling->right->color) {
+                        sibling->left->color = false;
+                        sibling->color = true;
+                        _rotateRight(sibling);
+                        sibling = parent->right;
+                    }
+
+                    sibling->color = parent->color;
+                    parent->color = false;
+                    sibling->right->color = false;
+                    _rotateLeft(parent);
+                    node = _root;
+                }
+            } else {
+                sibling = parent->left;
+
+                if (sibling->color) {
+                    sibling->color = false;
+                    parent->color = true;
+                    _rotateRight(parent);
+                    sibling = parent->left;
+                }
+
+                if ((!sibling->left || !sibling->left->color) && (!sibling->right || !sibling->right->color)) {
+                    sibling->color = true;
+                    node = parent;
+                    parent = node->parent;
+                } else {
+                    if (!sibling->left || !sibling->left->color) {
+                        sibling->right->color = false;
+                        sibling->color = true;
+                        _rotateLeft(sibling);
+                        sibling = parent->left;
+                    }
+
+                    sibling->color = parent->color;
+                    parent->color = false;
+                    sibling->left->color = false;
+                    _rotateRight(parent);
+                    node = _root;
+                }
+            }
+        }
+
+        if (node)
+            node->color = false;
+    }
+
+    /**
+     * Get the black height of a subtree
+     * @param node Root of the subtree, may be NULL
+     * @return The number of black nodes on a path from node down to a leaf
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_black_height(const RBTreeNode<value_type> *node) {
+        size_type height = 0;
+
+        for (; node; node = node->left) {
+            if (!node->color)
+                height++;
+        }
+        return (height);
+    }
+
+    /**
+     * Join two red-black trees and a node whose key goes between them into one red-black tree.
+     * The pivot replaces the black node of the same black height as the shorter tree on the facing spine
+     * of the taller tree, takes that node and the shorter tree as children and is rebalanced like an inserted node,
+     * so the join takes time proportional to the difference of the black heights, which the caller passes in.
+     * The result is left in _root, but the cached nodes and the size are not updated
+     * @param left         Root of a tree with a black root whose keys go before the pivot, may be NULL
+     * @param left_height  Black height of left
+     * @param pivot        Node that is not linked into any tree
+     * @param right        Root of a tree with a black root whose keys go after the pivot, may be NULL
+     * @param right_height Black height of right
+     * @param height       Receives the black height of the joined tree
+     * @return The root of the joined tree
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_join(RBTreeNode<value_type> *left, size_type left_height,
+                                                                             RBTreeNode<value_type> *pivot,
+                                                                             RBTreeNode<value_type> *right, size_type right_height,
+                                                                             size_type &height) {
+        RBTreeNode<value_type> *parent = _end;
+
+        height = ft::max(left_height, right_height);
+
+        if (left_height > right_height) {
+            _root = left;
+            left->parent = _end;
+            while (left_height > right_height || (left && left->color)) {
+                if (!left->color)
+                    left_height--;
+                parent = left;
+                left = left->right;
+            }
+            parent->right = pivot;
+        } else if (right_height > left_height) {
+            _root = right;
+            right->parent = _end;
+            while (right_height > left_height || (right && right->color)) {
+                if (!right->color)
+                    right_height--;
+                parent = right;
+                right = right->left;
+            }
+            parent->left = pivot;
+        } else {
+            _root = pivot;
+        }
+
+        pivot->parent = parent;
+        pivot->left = left;
+        pivot->right = right;
+        pivot->color = true;
+        if (left)
+            left->parent = pivot;
+        if (right)
+            right->parent = pivot;
+
+        _update_count(pivot);
+        _add_count(parent, NodePolicy::count(pivot) - NodePolicy::count(parent->left == pivot ? right : left));
+        if (_balance(pivot))
+            height++;
+        _end->left = _root;
+
+        return (_root);
+    }
+
+    /**
+     * Split a subtree by a key with one descent: the nodes passed on the way down are the pivots
+     * that join the pieces on each side back together. The black heights are carried along the descent
+     * instead of being measured, so each join costs the difference of the heights it joins and the joins
+     * add up to logarithmic time
+     * @param node      Root of the subtree, may be NULL
+     * @param height    Black height of the subtree, node included
+     * @param k         Key
+     * @param lo        Receives the root of a red-black tree of the elements whose key goes before k
+     * @param lo_height Receives the black height of lo
+     * @param hi        Receives the root of a red-black tree of the other elements
+     * @param hi_height Receives the black height of hi
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_split(RBTreeNode<value_type> *node, size_type height, const K &k,
+                                                                                   RBTreeNode<value_type> *&lo, size_type &lo_height,
+                                                                                   RBTreeNode<value_type> *&hi, size_type &hi_height) {
+        if (!node) {
+            lo = NULL;
+            hi = NULL;
+            lo_height = 0;
+            hi_height = 0;
+            return;
+        }
+
+        RBTreeNode<value_type> *left = node->left;
+        RBTreeNode<value_type> *right = node->right;
+        size_type              below = height - !node->color;
+        size_type              left_height = below;
+        size_type              right_height = below;
+
+        if (left && left->color) {
+            left->color = false;
+            left_height++;
+        }
+        if (right && right->color) {
+            right->color = false;
+            right_height++;
+        }
+        if (_comp(_key(node), k)) {
+            _split(right, right_height, k, right, right_height, hi, hi_height);
+            lo = _join(left, left_height, node, right, right_height, lo_height);
+        } else {
+            _split(left, left_height, k, lo, lo_height, left, left_height);
+            hi = _join(left, left_height, node, right, right_height, hi_height);
+        }
+    }
+
+    /**
+     * Move every node of x whose key is not in the tree yet into the tree, one at a time.
+     * The nodes are relinked, nothing is allocated or copied
+     * @param x Another tree of the same type, keeps the nodes whose key was already present
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_move_nodes(RBTree &x) {
+        RBTreeNode<value_type> *node = x._leftmost;
+
+        while (node != x._end) {
+            RBTreeNode<value_type>             *next = x._next_node(node);
+            pair<RBTreeNode<value_type>*, int> pos = _insert_position(_key(node));
+
+            if (pos.second) {
+                x._unlink_node(node);
+                node->left = NULL;
+                node->right = NULL;
+                node->color = true;
+                _link_node(node, pos.first, pos.second < 0);
+            }
+            node = next;
+        }
+    }
+
+    /**
+     * Build an empty tree from the sorted prefix of a range in linear time.
+     * The nodes are created in key order and chained through their right pointer, then the chain
+     * is turned into a tree whose subtrees differ in size by at most one. Every level is black except
+     * the deepest one, which is red unless it holds the root, so the red-black properties hold
+     * @param first Start of the range, advanced past the consumed prefix
+     * @param last  End of the range
+     * @param check If true, equivalent keys are skipped and the prefix ends with the first element that goes
+     *              before its predecessor, which is inserted from the root; otherwise the whole range is trusted
+     *              to be sorted and unique
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename InputIterator>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_build_sorted(InputIterator &first, InputIterator last, bool check) {
+        RBTreeNode<value_type> *head = NULL;
+        RBTreeNode<value_type> *tail = NULL;
+        RBTreeNode<value_type> *unsorted = NULL;
+        size_type              n = 0;
+
+        try {
+            for (; first != last; ++first) {
+                RBTreeNode<value_type> *node = _create_node(*first);
+
+                if (check && tail) {
+                    if (_comp(_key(node), _key(tail))) {
+                        unsorted = node;
+                        ++first;
+                        break;
+                    }
+                    if (!_comp(_key(tail), _key(node))) {
+                        _clear_node(node);
+                        continue;
+                    }
+                }
+
+                if (tail)
+                    tail->right = node;
+                else
+                    head = node;
+                tail = node;
+                n++;
+            }
+        } catch (...) {
+            while (head) {
+                RBTreeNode<value_type> *next = head->right;
+                _clear_node(head);
+                head = next;
+            }
+            throw;
+        }
+
+        if (!n)
+            return;
+
+        size_type red_depth = 0;
+        while ((static_cast<size_type>(2) << red_depth) - 1 < n)
+            red_depth++;
+
+        _root = _build_balanced(head, n, 0, red_depth);
+        _relink_end();
+        _size = n;
+
+        if (unsorted)
+            _insert_node(unsorted);
+    }
+
+    /**
+     * Build a balanced subtree from the first n nodes of a chain
+     * @param chain     Nodes in key order linked through their right pointer, advanced past the n used nodes
+     * @param n         Number of nodes in the subtree
+     * @param depth     Depth of the subtree root
+     * @param red_depth Depth of the deepest level, whose nodes are colored red
+     * @return Root of the subtree
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_build_balanced(RBTreeNode<value_type> *&chain, size_type n, size_type depth, size_type red_depth) {
+        if (!n)
+            return (NULL);
+
+        size_type              left_size = (n - 1) / 2;
+        RBTreeNode<value_type> *left = _build_balanced(chain, left_size, depth + 1, red_depth);
+        RBTreeNode<value_type> *node = chain;
+
+        chain = chain->right;
+        node->left = left;
+        if (left)
+            left->parent = node;
+        node->right = _build_balanced(chain, n - 1 - left_size, depth + 1, red_depth);
+        if (node->right)
+            node->right->parent = node;
+        node->color = depth && depth == red_depth;
+        NodePolicy::set_count(node, n);
+
+        return (node);
+    }
+
+    /**
+     * Default constructor, nodes are allocated by a copy of alloc rebound to the node type
+     * @param comp  Binary predicate that, taking two element keys as argument, returns true if the first argument
+     *              goes before the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::RBTree(const key_compare &comp, const allocator_type &alloc):
+    _alloc(alloc), _node_alloc(alloc), _comp(comp), _root(NULL), _size(0) {
+        _end = _create_end_node();
+        _leftmost = _end;
+    }
+
+    /**
+     * Constructor with a separate node allocator
      * @param comp       Binary predicate that, taking two element keys as argument, returns true if the first argument
      *                   goes before the second argument in the strict weak ordering it defines, and false otherwise
      * @param alloc      Allocator object
      * @param node_alloc Allocator object for nodes
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTree<T, Compare, Alloc, NodeAlloc>::RBTree(const value_compare &comp, const allocator_type &alloc, const node_allocator_type &node_alloc):
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::RBTree(const key_compare &comp, const allocator_type &alloc, const node_allocator_type &node_alloc):
     _alloc(alloc), _node_alloc(node_alloc), _comp(comp), _root(NULL), _size(0) {
-        _end = _node_alloc.allocate(1);
-        _node_alloc.construct(_end, RBTreeNode<value_type>(NULL));
+        _end = _create_end_node();
+        _leftmost = _end;
     }
 
     /**
      * Copy constructor
      * @param src Another RBTree object of the same type
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTree<T, Compare, Alloc, NodeAlloc>::RBTree(const RBTree &src):
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::RBTree(const RBTree &src):
     _alloc(src._alloc), _node_alloc(src._node_alloc), _comp(src._comp), _root(NULL), _size(src._size) {
-        _root = _bst_clone(src._root, NULL);
-        _end = _node_alloc.allocate(1);
-        _node_alloc.construct(_end, RBTreeNode<value_type>(NULL));
-        if (_root) {
-            _root->parent = _end;
-            _end->left = _root;
-        }
+        RBTreeNode<value_type> *reuse = NULL;
+
+        _root = _bst_clone(src._root, NULL, reuse);
+        _end = _create_end_node();
+        _relink_end();
+    }
+
+# if FT_CXX11
+    /**
+     * Move constructor, takes over the nodes of src and leaves it empty
+     * @param src Another RBTree object of the same type
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::RBTree(RBTree &&src):
+    _alloc(src._alloc), _node_alloc(src._node_alloc), _comp(src._comp), _root(src._root), _size(src._size) {
+        _end = _create_end_node();
+        _relink_end();
+        src._root = NULL;
+        src._relink_end();
+        src._size = 0;
     }
+# endif
 
     /**
      * Destructor
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTree<T, Compare, Alloc, NodeAlloc>::~RBTree() {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::~RBTree() {
         clear();
         _clear_node(_end);
     }
 
     /**
-     * Copy container content
+     * Copy container content.
+     * If the node allocators compare equal, the nodes of the tree are released rather than destroyed and the copy
+     * is built from them, each one getting a copy of an element of other in place: nodes are allocated only for
+     * the elements other has in excess, and deallocated only if the tree had more elements than other
      * @param other A map object of the same type
      * @return *this
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    RBTree<T, Compare, Alloc, NodeAlloc> &RBTree<T, Compare, Alloc, NodeAlloc>::operator=(const RBTree &other) {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc> &RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::operator=(const RBTree &other) {
         if (this == &other)
             return (*this);
 
-        clear();
+        RBTreeNode<value_type> *reuse = NULL;
+
+        if (_node_alloc == other._node_alloc)
+            _bst_release(_root, reuse);
+        else
+            _bst_clear(_root);
+        _root = NULL;
+        _size = 0;
+        _relink_end();
 
         _alloc = other._alloc;
         _node_alloc = other._node_alloc;
         _comp = other._comp;
-        _root = _bst_clone(other._root, NULL);
+        try {
+            _root = _bst_clone(other._root, NULL, reuse);
+        } catch (...) {
+            _clear_chain(reuse);
+            throw;
+        }
         _size = other._size;
+        _relink_end();
+        _clear_chain(reuse);
 
         return (*this);
     }
 
+# if FT_CXX11
     /**
-     * Return iterator to beginning
-     * @return An iterator to the first element in the container
+     * Move container content, other is left empty
+     * @param other A map object of the same type
+     * @return *this
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::iterator RBTree<T, Compare, Alloc, NodeAlloc>::begin() {
-        RBTreeNode<T> *node = _root;
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc> &RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::operator=(RBTree &&other) {
+        if (this == &other)
+            return (*this);
 
-        if (!node)
-            return (end());
+        clear();
+        swap(other);
 
-        return (iterator(_find_leftmost_node(node)));
+        return (*this);
+    }
+# endif
+
+    /**
+     * Return iterator to beginning
+     * @return An iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::begin() {
+        return (iterator(_leftmost));
     }
 
     /**
      * Return const iterator to beginning
      * @return A const iterator to the first element in the container
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::const_iterator RBTree<T, Compare, Alloc, NodeAlloc>::begin() const {
-        RBTreeNode<T> *node = _root;
-
-        if (!node)
-            return (end());
-
-        return (const_iterator(_find_leftmost_node(node)));
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::const_iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::begin() const {
+        return (const_iterator(_leftmost));
     }
 
     /**
      * Return iterator to end
      * @return An iterator to the past-the-end element in the container
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::iterator RBTree<T, Compare, Alloc, NodeAlloc>::end() {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::end() {
         return (iterator(_end));
     }
 
@@ -595,8 +1753,8 @@ namespace ft {
      * Return const iterator to end
      * @return A const iterator to the past-the-end element in the container
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::const_iterator RBTree<T, Compare, Alloc, NodeAlloc>::end() const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::const_iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::end() const {
         return (const_iterator(_end));
     }
 
@@ -604,8 +1762,8 @@ namespace ft {
      * Return reverse iterator to reverse beginning
      * @return A reverse iterator to the reverse beginning of the sequence container
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::reverse_iterator RBTree<T, Compare, Alloc, NodeAlloc>::rbegin() {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::reverse_iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::rbegin() {
         return (reverse_iterator(end()));
     }
 
@@ -613,8 +1771,8 @@ namespace ft {
      * Return const reverse iterator to reverse beginning
      * @return A const reverse iterator to the reverse beginning of the sequence container
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::const_reverse_iterator RBTree<T, Compare, Alloc, NodeAlloc>::rbegin() const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::const_reverse_iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::rbegin() const {
         return (const_reverse_iterator(end()));
     }
 
@@ -622,8 +1780,8 @@ namespace ft {
      * Return reverse iterator to reverse end
      * @return A reverse iterator to the reverse end of the sequence container
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::reverse_iterator RBTree<T, Compare, Alloc, NodeAlloc>::rend() {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::reverse_iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::rend() {
         return (reverse_iterator(begin()));
     }
 
@@ -631,8 +1789,8 @@ namespace ft {
      * Return const reverse iterator to reverse end
      * @return A const reverse iterator to the reverse end of the sequence container
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::const_reverse_iterator RBTree<T, Compare, Alloc, NodeAlloc>::rend() const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::const_reverse_iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::rend() const {
         return (const_reverse_iterator(begin()));
     }
 
@@ -640,8 +1798,8 @@ namespace ft {
      * Test whether container is empty
      * @return true if the container size is 0, false otherwise
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    bool RBTree<T, Compare, Alloc, NodeAlloc>::empty() const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    bool RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::empty() const {
         return (!_root);
     }
 
@@ -649,8 +1807,8 @@ namespace ft {
      * Return container size
      * @return The number of elements in the container
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::size_type RBTree<T, Compare, Alloc, NodeAlloc>::size() const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size() const {
         return (_size);
     }
 
@@ -658,74 +1816,374 @@ namespace ft {
      * Return maximum size
      * @return The maximum number of elements a map container can hold as content
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::size_type RBTree<T, Compare, Alloc, NodeAlloc>::max_size() const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::max_size() const {
         size_type a = _alloc.max_size();
         size_type b = _node_alloc.max_size();
         return (a < b ? a : b);
     }
 
     /**
-     * Insert element
+     * Insert element, the node is allocated only if no equivalent element is present
      * @param val Value to be copied to the inserted element
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    pair<typename RBTree<T, Compare, Alloc, NodeAlloc>::iterator, bool> RBTree<T, Compare, Alloc, NodeAlloc>::insert(const value_type &val) {
-        RBTreeNode<value_type> *node = _create_node(val);
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    pair<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator, bool> RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::insert(const value_type &val) {
+        pair<RBTreeNode<value_type>*, int> pos = _insert_position(KeyOfValue()(val));
 
-        if (_root)
-            _root->parent = NULL;
+        if (!pos.second)
+            return (ft::make_pair(iterator(pos.first), false));
+        return (ft::make_pair(_link_node(_create_node(val), pos.first, pos.second < 0), true));
+    }
+
+    /**
+     * Find where an element with key k goes.
+     * A three-way comparator stops the descent at an equivalent node, otherwise the descent takes one comparison
+     * per level and only the in-order predecessor of the free slot it reaches can be equivalent to k
+     * @param k Key of the element
+     * @return A pair of the equivalent node and 0 if there is one, otherwise a pair of the parent of the free slot,
+     *         NULL if the tree is empty, and -1 or 1 if the slot is the left or the right child
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    pair<RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type>*, int> RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_insert_position(const key_type &k) const {
+        RBTreeNode<value_type> *x = _root;
+        RBTreeNode<value_type> *parent = NULL;
+        bool                   left = true;
+
+        if (three_way_compare<Compare, key_type>::value) {
+            while (x) {
+                parent = x;
+                int c = _compare(k, x);
+                if (c == 0)
+                    return (ft::make_pair(x, 0));
+                left = c < 0;
+                x = left ? x->left : x->right;
+            }
+            return (ft::make_pair(parent, left ? -1 : 1));
+        }
+
+        while (x) {
+            parent = x;
+            left = _comp(k, _key(x));
+            x = left ? x->left : x->right;
+        }
+
+        if (parent) {
+            RBTreeNode<value_type> *prev = left ? _prev_node(parent) : parent;
+
+            if (prev != _end && !_comp(_key(prev), k))
+                return (ft::make_pair(prev, 0));
+        }
+        return (ft::make_pair(parent, left ? -1 : 1));
+    }
+
+    /**
+     * Find where an element with key k goes, next to the hinted position.
+     * The hint is used when the element goes right before or right after it, which takes
+     * one or two key comparisons, otherwise the position is searched from the root
+     * @param position Hint for the position of the element
+     * @param k        Key of the element
+     * @return Same as _insert_position(k)
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    pair<RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type>*, int> RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_insert_position(iterator position, const key_type &k) const {
+        RBTreeNode<value_type> *hint = position.baseNode();
+
+        if (!_root)
+            return (ft::make_pair(_root, -1));
+
+        if (hint == _end) {
+            RBTreeNode<value_type> *last = _end->right;
+
+            if (_comp(_key(last), k))
+                return (ft::make_pair(last, 1));
+            return (_insert_position(k));
+        }
+
+        int c = _compare(k, hint);
+        if (c < 0) {
+            RBTreeNode<value_type> *prev = _prev_node(hint);
+
+            if (prev == _end)
+                return (ft::make_pair(hint, -1));
+            if (_comp(_key(prev), k)) {
+                if (!prev->right)
+                    return (ft::make_pair(prev, 1));
+                return (ft::make_pair(hint, -1));
+            }
+        } else if (c > 0) {
+            RBTreeNode<value_type> *next = _next_node(hint);
+
+            if (next == _end || _comp(k, _key(next))) {
+                if (!hint->right)
+                    return (ft::make_pair(hint, 1));
+                return (ft::make_pair(next, -1));
+            }
+        } else {
+            return (ft::make_pair(hint, 0));
+        }
+
+        return (_insert_position(k));
+    }
 
-        ft::pair<RBTreeNode<value_type>*, bool> res = _bst_insert(node);
+    /**
+     * Link a new node into the tree and rebalance, the node is destroyed if an equivalent element already exists.
+     * Used when the key is only known once the element is constructed
+     * @param node New node
+     * @return A pair of an iterator to the inserted or the already present element, and whether the node was inserted
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    pair<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator, bool> RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_insert_node(RBTreeNode<value_type> *node) {
+        pair<RBTreeNode<value_type>*, int> pos = _insert_position(_key(node));
 
-        if (!res.second) {
+        if (!pos.second) {
             _clear_node(node);
-            _root->parent = _end;
-            _end->left = _root;
-            return (ft::make_pair(iterator(res.first), false));
+            return (ft::make_pair(iterator(pos.first), false));
+        }
+        return (ft::make_pair(_link_node(node, pos.first, pos.second < 0), true));
+    }
+
+    /**
+     * Link a new node into the tree next to the hinted position and rebalance,
+     * the node is destroyed if an equivalent element already exists
+     * @param position Hint for the position of the node
+     * @param node     New node
+     * @return An iterator to the inserted or the already present element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_insert_node(iterator position, RBTreeNode<value_type> *node) {
+        pair<RBTreeNode<value_type>*, int> pos = _insert_position(position, _key(node));
+
+        if (!pos.second) {
+            _clear_node(node);
+            return (iterator(pos.first));
+        }
+        return (_link_node(node, pos.first, pos.second < 0));
+    }
+
+    /**
+     * Attach a new node as a child of a node known to have a free slot on that side, then rebalance.
+     * Rotations keep the in-order sequence, so only the attachment can change the leftmost and rightmost nodes
+     * @param node   New node
+     * @param parent Parent of the new node, NULL if the tree is empty
+     * @param left   Whether the node becomes the left child of parent
+     * @return An iterator to the inserted element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_link_node(RBTreeNode<value_type> *node, RBTreeNode<value_type> *parent, bool left) {
+        if (_root)
+            _root->parent = NULL;
+
+        node->parent = parent;
+        if (!parent) {
+            _root = node;
+            _leftmost = node;
+            _end->right = node;
+        } else if (left) {
+            parent->left = node;
+            if (parent == _leftmost)
+                _leftmost = node;
+        } else {
+            parent->right = node;
+            if (parent == _end->right)
+                _end->right = node;
         }
 
+        NodePolicy::set_count(node, 1);
+        _add_count(parent, 1);
         _balance(node);
 
         _root->parent = _end;
         _end->left = _root;
         _size++;
 
-        return (ft::make_pair(iterator(res.first), true));
+        return (iterator(node));
+    }
+
+    /**
+     * In-order predecessor of a node
+     * @param node Node of the tree, not the end node
+     * @return The previous node, or the end node if node is the first one
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_prev_node(RBTreeNode<value_type> *node) const {
+        if (node->left)
+            return (_find_rightmost_node(node->left));
+        while (node->parent != _end && node == node->parent->left)
+            node = node->parent;
+        return (node->parent);
+    }
+
+    /**
+     * In-order successor of a node
+     * @param node Node of the tree, not the end node
+     * @return The next node, or the end node if node is the last one
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    RBTreeNode<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::value_type> *RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_next_node(RBTreeNode<value_type> *node) const {
+        if (node->right)
+            return (_find_leftmost_node(node->right));
+        while (node->parent != _end && node == node->parent->right)
+            node = node->parent;
+        return (node->parent);
+    }
+
+    /**
+     * Insert element with hint
+     * @param position Hint for the position where the element can be inserted,
+     *                 insertion takes amortized constant time if the element goes right before or after position
+     * @param val      Value to be copied to the inserted element
+     * @return An iterator to the inserted or the already present element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::insert(iterator position, const value_type &val) {
+        pair<RBTreeNode<value_type>*, int> pos = _insert_position(position, KeyOfValue()(val));
+
+        if (!pos.second)
+            return (iterator(pos.first));
+        return (_link_node(_create_node(val), pos.first, pos.second < 0));
+    }
+
+# if FT_CXX11
+    /**
+     * Insert element, the node is allocated and val is moved only if no equivalent element is present
+     * @param val Value to be moved to the inserted element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    pair<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator, bool> RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::insert(value_type &&val) {
+        pair<RBTreeNode<value_type>*, int> pos = _insert_position(KeyOfValue()(val));
+
+        if (!pos.second)
+            return (ft::make_pair(iterator(pos.first), false));
+        return (ft::make_pair(_link_node(_create_node(std::move(val)), pos.first, pos.second < 0), true));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::insert(iterator position, value_type &&val) {
+        pair<RBTreeNode<value_type>*, int> pos = _insert_position(position, KeyOfValue()(val));
+
+        if (!pos.second)
+            return (iterator(pos.first));
+        return (_link_node(_create_node(std::move(val)), pos.first, pos.second < 0));
+    }
+
+    /**
+     * Construct and insert element
+     * @param args Arguments forwarded to the constructor of the element
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename... Args>
+    pair<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator, bool> RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::emplace(Args&&... args) {
+        return (_insert_node(_create_node(std::forward<Args>(args)...)));
     }
 
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::RBTree::iterator RBTree<T, Compare, Alloc, NodeAlloc>::insert(RBTree::iterator position, const value_type &val) {
-        (void)position;
-        return (insert(val).first);
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename... Args>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::emplace_hint(iterator position, Args&&... args) {
+        return (_insert_node(position, _create_node(std::forward<Args>(args)...)));
     }
+# endif
 
     /**
-     * Insert elements
+     * Insert elements.
+     * If the tree is empty, the sorted prefix of the range is built into a balanced tree in linear time,
+     * the rest of the range is inserted one element at a time
      * @param first Input iterator to the initial position in a range
      * @param last  Input iterator to the final position in a range
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
     template<typename InputIterator>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::insert(InputIterator first, InputIterator last,
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::insert(InputIterator first, InputIterator last,
                                                       typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*) {
+        if (!_root)
+            _build_sorted(first, last, true);
         while (first != last) {
-            insert(*first);
+            insert(end(), *first);
             first++;
         }
     }
 
     /**
-     * Erase element
-     * @param position Iterator pointing to a single element to be removed from the tree
+     * Insert a range sorted by key that holds no equivalent keys.
+     * An empty tree is built from it in linear time without comparing the elements,
+     * otherwise every element is inserted with end() as the hint
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename InputIterator>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::insert(assume_sorted_t, InputIterator first, InputIterator last) {
+        if (!_root)
+            _build_sorted(first, last, false);
+        while (first != last) {
+            insert(end(), *first);
+            first++;
+        }
+    }
+
+    /**
+     * Insert the node owned by a handle, the node is relinked and nothing is allocated or copied.
+     * The handle must come from a tree whose allocators compare equal
+     * @param nh Handle to a node, it is emptied only if the node is inserted
+     * @return The inserted element, true and an empty handle, or the element with an equivalent key,
+     *         false and a handle owning the node. An empty nh gives end(), false and an empty handle
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::insert_return_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::insert(const node_handle_type &nh) {
+        insert_return_type ret;
+
+        ret.position = end();
+        ret.inserted = false;
+        if (nh.empty())
+            return (ret);
+
+        pair<RBTreeNode<value_type>*, int> pos = _insert_position(_key(nh._node));
+
+        if (!pos.second) {
+            ret.position = iterator(pos.first);
+            ret.node = nh;
+            return (ret);
+        }
+        ret.position = _link_node(nh._release(), pos.first, pos.second < 0);
+        ret.inserted = true;
+        return (ret);
+    }
+
+    /**
+     * Insert the node owned by a handle with hint, the node is relinked and nothing is allocated or copied.
+     * The handle must come from a tree whose allocators compare equal
+     * @param position Hint for the position where the element can be inserted
+     * @param nh       Handle to a node, it is emptied only if the node is inserted
+     * @return An iterator to the inserted element or to the element with an equivalent key, end() if nh is empty
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::insert(iterator position, const node_handle_type &nh) {
+        if (nh.empty())
+            return (end());
+
+        pair<RBTreeNode<value_type>*, int> pos = _insert_position(position, _key(nh._node));
+
+        if (!pos.second)
+            return (iterator(pos.first));
+        return (_link_node(nh._release(), pos.first, pos.second < 0));
+    }
+
+    /**
+     * Take one node out of the tree without destroying it: rebalance, then fix the cached nodes and the size
+     * @param node Node of the tree, not the end node
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::erase(RBTree::iterator position) {
-        RBTreeNode<value_type> *parent = _bst_erase(position.baseNode());
-        if (parent != _end)
-            _balance(parent);
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_unlink_node(RBTreeNode<value_type> *node) {
+        if (node == _leftmost)
+            _leftmost = _next_node(node);
+        if (node == _end->right)
+            _end->right = _prev_node(node);
+
+        _bst_erase(node);
         if (_size == 1) {
             _root = NULL;
+            _end->left = NULL;
+            _end->right = NULL;
         } else{
             _root->parent = _end;
             _end->left = _root;
@@ -735,11 +2193,23 @@ namespace ft {
 
     /**
      * Erase element
-     * @param val Value of the element to be removed from the tree
+     * @param position Iterator pointing to a single element to be removed from the tree
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::erase(RBTree::iterator position) {
+        RBTreeNode<value_type> *node = position.baseNode();
+
+        _unlink_node(node);
+        _clear_node(node);
+    }
+
+    /**
+     * Erase element
+     * @param k Key of the element to be removed from the tree
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::size_type RBTree<T, Compare, Alloc, NodeAlloc>::erase(const value_type &val) {
-        iterator it = find(val);
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::erase(const key_type &k) {
+        iterator it = find(k);
         if (it == end())
             return (0);
 
@@ -752,8 +2222,8 @@ namespace ft {
      * @param first Iterator to the initial position in a range
      * @param last  Iterator to the final position in a range
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::erase(RBTree::iterator first, RBTree::iterator last) {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::erase(RBTree::iterator first, RBTree::iterator last) {
         iterator next;
         while (first != last) {
             next = first;
@@ -763,17 +2233,49 @@ namespace ft {
         }
     }
 
+    /**
+     * Take an element out of the tree, its node is unlinked and handed over without being destroyed
+     * @param position Iterator to the element
+     * @return A handle owning the node
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::node_handle_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::extract(iterator position) {
+        RBTreeNode<value_type> *node = position.baseNode();
+
+        _unlink_node(node);
+        node->left = NULL;
+        node->right = NULL;
+        node->parent = NULL;
+        node->color = true;
+        return (node_handle_type(node, _alloc, _node_alloc));
+    }
+
+    /**
+     * Take the element with a key out of the tree, its node is unlinked and handed over without being destroyed
+     * @param k Key of the element
+     * @return A handle owning the node, or an empty handle if no element has the key
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::node_handle_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::extract(const key_type &k) {
+        RBTreeNode<value_type> *node = _bst_find(k);
+
+        if (node == _end)
+            return (node_handle_type(NULL, _alloc, _node_alloc));
+        return (extract(iterator(node)));
+    }
+
     /**
      * Swap content
      * @param x Another RBTree container of the same type as this
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::swap(RBTree &x) {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::swap(RBTree &x) {
         allocator_type         _alloc_tmp = this->_alloc;
         node_allocator_type    _node_alloc_tmp = this->_node_alloc;
-        value_compare          _comp_tmp = this->_comp;
+        key_compare            _comp_tmp = this->_comp;
         RBTreeNode<value_type> *_root_tmp = this->_root;
         RBTreeNode<value_type> *_end_tmp = this->_end;
+        RBTreeNode<value_type> *_leftmost_tmp = this->_leftmost;
         size_type              _size_tmp = this->_size;
 
         this->_alloc = x._alloc;
@@ -781,6 +2283,7 @@ namespace ft {
         this->_comp = x._comp;
         this->_root = x._root;
         this->_end = x._end;
+        this->_leftmost = x._leftmost;
         this->_size = x._size;
 
         x._alloc = _alloc_tmp;
@@ -788,136 +2291,561 @@ namespace ft {
         x._comp = _comp_tmp;
         x._root = _root_tmp;
         x._end = _end_tmp;
+        x._leftmost = _leftmost_tmp;
         x._size = _size_tmp;
     }
 
     /**
      * Clear content
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::clear() {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::clear() {
         _bst_clear(_root);
         _root = NULL;
         _size = 0;
+        _relink_end();
+    }
+
+    /**
+     * Move the elements whose key is not before k into x.
+     * The tree is cut along the search path of k and both sides are joined back into red-black trees in
+     * logarithmic time, the nodes are relinked and nothing is allocated or copied. With ft::order_statistics
+     * the new sizes are read from the roots and the whole split is O(log n). Without it the nodes carry no
+     * sizes, so they are counted by walking both trees in step until the end of the smaller one, which makes
+     * the split O(log n + min(m, n - m)) where m elements go before k.
+     * The allocators must compare equal
+     * @param k Key where the tree is split
+     * @param x Another tree of the same type, its previous elements are destroyed
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::split(const key_type &k, RBTree &x) {
+        if (&x == this)
+            return;
+
+        RBTreeNode<value_type> *lo;
+        RBTreeNode<value_type> *hi;
+        size_type              size = _size;
+
+        size_type              lo_height;
+        size_type              hi_height;
+
+        x.clear();
+        _split(_root, _black_height(_root), k, lo, lo_height, hi, hi_height);
+        _root = lo;
+        _relink_end();
+        x._root = hi;
+        x._relink_end();
+
+        if (NodePolicy::enabled) {
+            x._size = NodePolicy::count(hi);
+        } else {
+            iterator  a = begin();
+            iterator  b = x.begin();
+            size_type n = 0;
+
+            for (; a != end() && b != x.end(); a++, b++)
+                n++;
+            x._size = a == end() ? size - n : n;
+        }
+        _size = size - x._size;
+    }
+
+    /**
+     * Move every element of x into the tree.
+     * If all the keys of x go after the keys of the tree, or all before them, the trees are concatenated
+     * in logarithmic time: the first or the last node of x is unlinked and joins both trees as the pivot.
+     * Otherwise the nodes of x are moved one at a time and the ones whose key is already present stay in x.
+     * The nodes are relinked, nothing is allocated or copied. The allocators must compare equal
+     * @param x Another tree of the same type
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::join(RBTree &x) {
+        if (&x == this || !x._root)
+            return;
+        if (_root && !_comp(_key(_end->right), _key(x._leftmost)) && !_comp(_key(x._end->right), _key(_leftmost))) {
+            _move_nodes(x);
+            return;
+        }
+
+        size_type              size = _size + x._size;
+        bool                   after = !_root || _comp(_key(_end->right), _key(x._leftmost));
+        RBTreeNode<value_type> *pivot = after ? x._leftmost : x._end->right;
+        RBTreeNode<value_type> *root = _root;
+        size_type              height;
+
+        x._unlink_node(pivot);
+        if (after)
+            _join(root, _black_height(root), pivot, x._root, _black_height(x._root), height);
+        else
+            _join(x._root, _black_height(x._root), pivot, root, _black_height(root), height);
+        x._root = NULL;
+        x._size = 0;
+        x._relink_end();
+        _size = size;
+        _relink_end();
+    }
+
+# if FT_CXX11
+    /**
+     * Collect the nodes of the first levels of a subtree in key order
+     * @param node  Root of the subtree, may be NULL
+     * @param depth Number of levels
+     * @param out   Receives the nodes
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_top_nodes(RBTreeNode<value_type> *node, size_type depth, std::vector<RBTreeNode<value_type>*> &out) const {
+        if (!node || !depth)
+            return;
+        _top_nodes(node->left, depth - 1, out);
+        out.push_back(node);
+        _top_nodes(node->right, depth - 1, out);
+    }
+
+    /**
+     * Build an empty tree from a sorted range on a worker thread.
+     * An exception is stored for the thread that started the worker instead of ending the program
+     * @param tree  Empty tree
+     * @param first Input iterator to the initial position in a range sorted by key without equivalent keys
+     * @param last  Input iterator to the final position in the range
+     * @param error Receives the exception thrown while building the tree, if any
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename InputIterator>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_insert_sorted_part(RBTree *tree, InputIterator first, InputIterator last, std::exception_ptr *error) {
+        try {
+            tree->insert(assume_sorted, first, last);
+        } catch (...) {
+            *error = std::current_exception();
+        }
+    }
+
+    /**
+     * Replace the content of the tree by the result of a set operation on two trees, on several threads.
+     * The keys of the first levels of the larger tree cut both trees into ranges of the same keys, one per thread:
+     * the levels are taken two deeper than the threads need and threads - 1 of their keys are picked at even steps,
+     * so that the ranges hold about as many elements of the larger tree each and no more threads run than asked.
+     * Each thread merges its ranges into a balanced tree of its own and the trees are joined in key order,
+     * in logarithmic time each. The threads share nothing but the operands, which they only read, and the
+     * allocator, which must be safe to use from several threads at once. Operands smaller than
+     * FT_RB_TREE_PARALLEL_MIN elements in total are merged on the calling thread.
+     * If a thread throws, the tree is left unchanged and the exception is rethrown once all of them are done.
+     * The tree may be x or y, it keeps its allocators and takes the comparison object of x
+     * @param policy Number of threads, as many as the hardware runs at once if 0
+     * @param op     Operation
+     * @param x      First tree, an element found in both trees is copied from it
+     * @param y      Second tree, ordered by the same comparison object
+     * @param comp   Comparison object ordering two elements by key
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename ValueCompare>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::assign_set_operation(parallel_t policy, set_operation op, const RBTree &x, const RBTree &y, ValueCompare comp) {
+        typedef set_operation_iterator<const_iterator, const_iterator, ValueCompare> merge_iterator;
+
+        std::vector<RBTreeNode<value_type>*> pivots;
+
+        if (x._size + y._size >= FT_RB_TREE_PARALLEL_MIN) {
+            const RBTree                         &larger = x._size < y._size ? y : x;
+            size_type                            threads = policy.threads ? policy.threads : std::thread::hardware_concurrency();
+            size_type                            depth = 2;
+            std::vector<RBTreeNode<value_type>*> top;
+
+            while ((static_cast<size_type>(1) << depth) < 4 * threads)
+                depth++;
+            if (threads > 1)
+                larger._top_nodes(larger._root, depth, top);
+            if (top.size() + 1 < threads)
+                pivots.swap(top);
+            else {
+                for (size_type i = 1; i < threads; i++)
+                    pivots.push_back(top[i * (top.size() + 1) / threads - 1]);
+            }
+        }
+        if (pivots.empty()) {
+            RBTree tmp(x._comp, _alloc, _node_alloc);
+
+            tmp.insert(assume_sorted, merge_iterator(op, x.begin(), x.end(), y.begin(), y.end(), comp),
+                       merge_iterator(op, x.end(), x.end(), y.end(), y.end(), comp));
+            swap(tmp);
+            return;
+        }
+
+        size_type                   parts = pivots.size() + 1;
+        std::vector<const_iterator> x_bounds(1, x.begin());
+        std::vector<const_iterator> y_bounds(1, y.begin());
+
+        for (size_type i = 0; i < pivots.size(); i++) {
+            x_bounds.push_back(x.lower_bound(_key(pivots[i])));
+            y_bounds.push_back(y.lower_bound(_key(pivots[i])));
+        }
+        x_bounds.push_back(x.end());
+        y_bounds.push_back(y.end());
+
+        std::vector<RBTree>             trees(parts, RBTree(x._comp, _alloc, _node_alloc));
+        std::vector<std::exception_ptr> errors(parts);
+        std::vector<std::thread>        workers;
+
+        workers.reserve(parts - 1);
+        try {
+            for (size_type i = 1; i < parts; i++) {
+                workers.push_back(std::thread(&RBTree::_insert_sorted_part<merge_iterator>, &trees[i],
+                                              merge_iterator(op, x_bounds[i], x_bounds[i + 1], y_bounds[i], y_bounds[i + 1], comp),
+                                              merge_iterator(op, x_bounds[i + 1], x_bounds[i + 1], y_bounds[i + 1], y_bounds[i + 1], comp),
+                                              &errors[i]));
+            }
+        } catch (...) {
+            for (size_type i = 0; i < workers.size(); i++)
+                workers[i].join();
+            throw;
+        }
+        _insert_sorted_part(&trees[0],
+                            merge_iterator(op, x_bounds[0], x_bounds[1], y_bounds[0], y_bounds[1], comp),
+                            merge_iterator(op, x_bounds[1], x_bounds[1], y_bounds[1], y_bounds[1], comp),
+                            &errors[0]);
+        for (size_type i = 0; i < workers.size(); i++)
+            workers[i].join();
+        for (size_type i = 0; i < parts; i++) {
+            if (errors[i])
+                std::rethrow_exception(errors[i]);
+        }
+
+        for (size_type i = 1; i < parts; i++)
+            trees[0].join(trees[i]);
+        swap(trees[0]);
     }
+# endif
 
     /**
-     * Return value comparison object
-     * @return The comparison object for element values
+     * Return key comparison object
+     * @return The comparison object for element keys
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::value_compare RBTree<T, Compare, Alloc, NodeAlloc>::value_comp() const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::key_compare RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::key_comp() const {
         return (_comp);
     }
 
     /**
      * Get iterator to element
-     * @param val Value to be searched for
+     * @param k Key to be searched for
      * @return An iterator to the element, if an element with specified key is found, or RBTree::end otherwise
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::iterator RBTree<T, Compare, Alloc, NodeAlloc>::find(const value_type &val) {
-        return (iterator(_bst_find(val, _root)));
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::find(const K &k) {
+        return (iterator(_bst_find(k)));
     }
 
     /**
      * Get const iterator to element
-     * @param val Value to be searched for
+     * @param k Key to be searched for
      * @return A const iterator to the element, if an element with specified key is found, or RBTree::end otherwise
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::const_iterator RBTree<T, Compare, Alloc, NodeAlloc>::find(const value_type &val) const {
-        return (const_iterator(_bst_find(val, _root)));
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::const_iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::find(const K &k) const {
+        return (const_iterator(_bst_find(k)));
     }
 
     /**
-     * Count elements with a specific value
-     * @param val Value to search for
-     * @return 1 if the container contains an element whose value is equivalent to val, or zero otherwise
+     * Count elements with a specific key
+     * @param k Key to search for
+     * @return 1 if the container contains an element whose key is equivalent to k, or zero otherwise
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::size_type RBTree<T, Compare, Alloc, NodeAlloc>::count(const value_type &val) const {
-        iterator it = find(val);
-        return (it == end() ? 0 : 1);
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::count(const K &k) const {
+        return (_bst_find(k) == _end ? 0 : 1);
     }
 
     /**
      * Return iterator to lower bound
-     * @param val Value to search for
-     * @return An iterator to the the first element in the container whose value is not considered to go before val,
-     *         or RBTree::end if all values are considered to go before val
+     * @param k Key to search for
+     * @return An iterator to the the first element in the container whose key is not considered to go before k,
+     *         or RBTree::end if all keys are considered to go before k
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::iterator RBTree<T, Compare, Alloc, NodeAlloc>::lower_bound(const value_type &val) {
-        return (iterator(_bst_lower_bound(val, _root)));
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::lower_bound(const K &k) {
+        return (iterator(_bst_lower_bound(k, _root, _end)));
     }
 
     /**
      * Return const iterator to lower bound
-     * @param val Value to search for
-     * @return A const iterator to the the first element in the container whose value is not considered to go before val,
-     *         or RBTree::end if all values are considered to go before val
+     * @param k Key to search for
+     * @return A const iterator to the the first element in the container whose key is not considered to go before k,
+     *         or RBTree::end if all keys are considered to go before k
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::const_iterator RBTree<T, Compare, Alloc, NodeAlloc>::lower_bound(const value_type &val) const {
-        return (const_iterator(_bst_lower_bound(val, _root)));
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::const_iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::lower_bound(const K &k) const {
+        return (const_iterator(_bst_lower_bound(k, _root, _end)));
     }
 
     /**
      * Return iterator to upper bound
-     * @param val Value to search for
-     * @return An iterator to the the first element in the container whose value is considered to go after val,
-     *         or RBTree::end if no values are considered to go after val
+     * @param k Key to search for
+     * @return An iterator to the the first element in the container whose key is considered to go after k,
+     *         or RBTree::end if no keys are considered to go after k
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::iterator RBTree<T, Compare, Alloc, NodeAlloc>::upper_bound(const value_type &val) {
-        return (iterator(_bst_upper_bound(val, _root)));
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::upper_bound(const K &k) {
+        return (iterator(_bst_upper_bound(k, _root, _end)));
     }
 
     /**
      * Return const iterator to upper bound
-     * @param val Value to search for
-     * @return A const iterator to the the first element in the container whose value is considered to go after val,
-     *         or RBTree::end if no values are considered to go after val
+     * @param k Key to search for
+     * @return A const iterator to the the first element in the container whose key is considered to go after k,
+     *         or RBTree::end if no keys are considered to go after k
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::const_iterator RBTree<T, Compare, Alloc, NodeAlloc>::upper_bound(const value_type &val) const {
-        return (const_iterator(_bst_upper_bound(val, _root)));
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::const_iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::upper_bound(const K &k) const {
+        return (const_iterator(_bst_upper_bound(k, _root, _end)));
     }
 
     /**
      * Get range of equal elements
-     * @param val Value to search for
+     * @param k Key to search for
      * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    pair<typename RBTree<T, Compare, Alloc, NodeAlloc>::iterator, typename RBTree<T, Compare, Alloc, NodeAlloc>::iterator>
-    RBTree<T, Compare, Alloc, NodeAlloc>::equal_range(const value_type &val) {
-        return (ft::make_pair(lower_bound(val), upper_bound(val)));
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    pair<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator, typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator>
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::equal_range(const K &k) {
+        pair<RBTreeNode<value_type>*, RBTreeNode<value_type>*> range = _bst_equal_range(k);
+        return (ft::make_pair(iterator(range.first), iterator(range.second)));
     }
 
     /**
      * Get const range of equal elements
-     * @param val Value to search for
+     * @param k Key to search for
      * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    pair<typename RBTree<T, Compare, Alloc, NodeAlloc>::const_iterator, typename RBTree<T, Compare, Alloc, NodeAlloc>::const_iterator>
-    RBTree<T, Compare, Alloc, NodeAlloc>::equal_range(const value_type &val) const {
-        return (ft::make_pair(lower_bound(val), upper_bound(val)));
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    pair<typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::const_iterator, typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::const_iterator>
+    RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::equal_range(const K &k) const {
+        pair<RBTreeNode<value_type>*, RBTreeNode<value_type>*> range = _bst_equal_range(k);
+        return (ft::make_pair(const_iterator(range.first), const_iterator(range.second)));
+    }
+
+    /**
+     * Get iterators to the elements of a batch of keys, faster than one find per key (extension).
+     * Sorted keys are merged with the tree, other batches advance several descents at once so that their cache misses overlap
+     * @param first Forward iterator to the first key
+     * @param last  Forward iterator past the last key
+     * @param out   Output iterator that receives, for each key in order, an iterator to its element or RBTree::end
+     * @return out past the last iterator written
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename ForwardIterator, typename OutputIterator>
+    OutputIterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) {
+        return (_find_batch<iterator>(first, last, out));
+    }
+
+    /**
+     * Get const iterators to the elements of a batch of keys (extension)
+     * @param first Forward iterator to the first key
+     * @param last  Forward iterator past the last key
+     * @param out   Output iterator that receives, for each key in order, a const iterator to its element or RBTree::end
+     * @return out past the last iterator written
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename ForwardIterator, typename OutputIterator>
+    OutputIterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const {
+        return (_find_batch<const_iterator>(first, last, out));
     }
 
     /**
      * Get allocator
      * @return The allocator
      */
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    typename RBTree<T, Compare, Alloc, NodeAlloc>::allocator_type RBTree<T, Compare, Alloc, NodeAlloc>::get_allocator() const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::allocator_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::get_allocator() const {
         return (_alloc);
     }
 
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::_print(RBTreeNode<value_type> *root, int space) const {
+    /**
+     * Recompute the subtree count of a node from its children, order_statistics only
+     * @param node Node
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_update_count(RBTreeNode<value_type> *node) {
+        NodePolicy::set_count(node, NodePolicy::count(node->left) + NodePolicy::count(node->right) + 1);
+    }
+
+    /**
+     * Add to the subtree count of a node and of all its ancestors, order_statistics only
+     * @param node First node to update, the walk stops above the root
+     * @param diff Number of elements added to or removed from the subtree
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_add_count(RBTreeNode<value_type> *node, ptrdiff_t diff) {
+        if (!NodePolicy::enabled)
+            return;
+        for (; node && node != _end; node = node->parent)
+            NodePolicy::set_count(node, NodePolicy::count(node) + diff);
+    }
+
+    /**
+     * Count the elements that go before a key, with one descent that adds up the left subtree counts
+     * @param k Key
+     * @return The number of elements whose key goes before k
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    template<typename K>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_rank(const K &k) const {
+        RBTreeNode<value_type> *node = _root;
+        size_type              rank = 0;
+
+        while (node) {
+            if (_comp(_key(node), k)) {
+                rank += NodePolicy::count(node->left) + 1;
+                node = node->right;
+            } else {
+                node = node->left;
+            }
+        }
+        return (rank);
+    }
+
+    /**
+     * Get the element at a given position in key order, in logarithmic time. Requires ft::order_statistics
+     * @param n Position of the element, 0 for the first one
+     * @return An iterator to the element, or end() if n is not less than size()
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::nth(size_type n) {
+        typedef char requires_order_statistics[NodePolicy::enabled ? 1 : -1];
+        (void)sizeof(requires_order_statistics);
+        RBTreeNode<value_type> *node = _root;
+
+        if (n >= _size)
+            return (end());
+        while (node) {
+            size_type left = NodePolicy::count(node->left);
+
+            if (n < left) {
+                node = node->left;
+            } else if (n > left) {
+                n -= left + 1;
+                node = node->right;
+            } else {
+                break;
+            }
+        }
+        return (iterator(node));
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::const_iterator RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::nth(size_type n) const {
+        return (const_iterator(const_cast<RBTree*>(this)->nth(n)));
+    }
+
+    /**
+     * Get the position of a key in key order, in logarithmic time. Requires ft::order_statistics
+     * @param k Key
+     * @return The number of elements whose key goes before k, which is the position of k if it is present
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::rank(const key_type &k) const {
+        typedef char requires_order_statistics[NodePolicy::enabled ? 1 : -1];
+        (void)sizeof(requires_order_statistics);
+        return (_rank(k));
+    }
+
+    /**
+     * Count the elements in a key range, in logarithmic time. Requires ft::order_statistics
+     * @param lo Lower bound of the range, included
+     * @param hi Upper bound of the range, excluded
+     * @return The number of elements whose key is not before lo and goes before hi, 0 if hi does not go after lo
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::count_range(const key_type &lo, const key_type &hi) const {
+        typedef char requires_order_statistics[NodePolicy::enabled ? 1 : -1];
+        (void)sizeof(requires_order_statistics);
+        if (!_comp(lo, hi))
+            return (0);
+        return (_rank(hi) - _rank(lo));
+    }
+
+    /**
+     * Get height of a subtree
+     * @param node Root of the subtree
+     * @return The number of nodes on the longest path from node down to a leaf
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_height(const RBTreeNode<value_type> *node) const {
+        if (!node)
+            return (0);
+        return (1 + ft::max(_height(node->left), _height(node->right)));
+    }
+
+    /**
+     * Check the links and the colors of a subtree
+     * @param node Root of the subtree
+     * @return The black height of the subtree, or -1 if a child does not point back to its parent,
+     *         a red node has a red child or two paths down to a leaf have a different number of black nodes
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    int RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_verify_subtree(const RBTreeNode<value_type> *node) const {
+        if (!node)
+            return (1);
+        if ((node->left && node->left->parent != node) || (node->right && node->right->parent != node))
+            return (-1);
+        if (node->color && ((node->left && node->left->color) || (node->right && node->right->color)))
+            return (-1);
+        if (NodePolicy::enabled && NodePolicy::count(node) != NodePolicy::count(node->left) + NodePolicy::count(node->right) + 1)
+            return (-1);
+
+        int left = _verify_subtree(node->left);
+        int right = _verify_subtree(node->right);
+
+        if (left < 0 || left != right)
+            return (-1);
+        return (left + (node->color ? 0 : 1));
+    }
+
+    /**
+     * Get height of the tree, a red-black tree of n elements is never higher than 2 * log2(n + 1)
+     * @return The number of nodes on the longest path from the root down to a leaf
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    typename RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::size_type RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::height() const {
+        return (_height(_root));
+    }
+
+    /**
+     * Check every invariant of the tree: the red-black properties, the parent links, the key order,
+     * the element count and the cached end, leftmost and rightmost nodes. Takes linear time
+     * @return true if the tree is valid
+     */
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    bool RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::verify() const {
+        if (!_root)
+            return (_size == 0 && _leftmost == _end && !_end->left && !_end->right);
+        if (_root->color || _root->parent != _end || _end->left != _root || _end->parent)
+            return (false);
+        if (_leftmost != _find_leftmost_node(_root) || _end->right != _find_rightmost_node(_root))
+            return (false);
+        if (_verify_subtree(_root) < 0)
+            return (false);
+
+        size_type              n = 1;
+        RBTreeNode<value_type> *prev = _leftmost;
+
+        for (RBTreeNode<value_type> *node = _next_node(prev); node != _end; node = _next_node(node)) {
+            if (!_comp(_key(prev), _key(node)))
+                return (false);
+            prev = node;
+            n++;
+        }
+        return (n == _size);
+    }
+
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::_print(RBTreeNode<value_type> *root, int space) const {
         if (!root)
             return;
 
@@ -927,13 +2855,13 @@ namespace ft {
 
         for (int i = 10; i < space; i++)
             std::cout << " ";
-        std::cout << *root->value << "(" << (root->color ? "R" : "B") << ")" << std::endl;
+        std::cout << root->value() << "(" << (root->color ? "R" : "B") << ")" << std::endl;
 
         _print(root->left, space);
     }
 
-    template<typename T, typename Compare, typename Alloc, typename NodeAlloc>
-    void RBTree<T, Compare, Alloc, NodeAlloc>::print() const {
+    template<typename Key, typename T, typename KeyOfValue, typename Compare, typename Alloc, typename NodePolicy, typename NodeAlloc>
+    void RBTree<Key, T, KeyOfValue, Compare, Alloc, NodePolicy, NodeAlloc>::print() const {
         std::cout << "---------------" << std::endl;
         _print(_root, 0);
         std::cout << "---------------" << std::endl;
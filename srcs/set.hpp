@@ -2,6 +2,8 @@
 # define FT_CONTAINERS_SET_HPP
 
 # include <memory>
+# include "algorithm.hpp"
+# include "functional.hpp"
 # include "rb_tree.hpp"
 # include "iterator.hpp"
 
@@ -9,11 +11,13 @@ namespace ft {
 
     /**
      * Set container
-     * @tparam T       Type of the elements
-     * @tparam Compare A binary predicate that takes two arguments of the same type as the elements and returns a bool
-     * @tparam Alloc   Type of the allocator object used to define the storage allocation model
+     * @tparam T          Type of the elements
+     * @tparam Compare    A binary predicate that takes two arguments of the same type as the elements and returns a bool
+     * @tparam Alloc      Type of the allocator object used to define the storage allocation model
+     * @tparam NodePolicy ft::no_order_statistics, or ft::order_statistics for nth, rank and count_range in O(log n)
+     *                    at the cost of one more word per node
      */
-    template< typename T, typename Compare = less<T>, typename Alloc = std::allocator<T> >
+    template< typename T, typename Compare = less<T>, typename Alloc = std::allocator<T>, typename NodePolicy = no_order_statistics >
     class set {
     public:
         typedef T                                                   key_type;
@@ -25,15 +29,23 @@ namespace ft {
         typedef typename allocator_type::const_reference            const_reference;
         typedef typename allocator_type::pointer                    pointer;
         typedef typename allocator_type::const_pointer              const_pointer;
-        typedef typename RBTree<T>::iterator                        iterator;
-        typedef typename RBTree<T>::const_iterator                  const_iterator;
+        typedef typename RBTree<T, T, ft::identity<T>, Compare, Alloc, NodePolicy>::iterator       iterator;
+        typedef typename RBTree<T, T, ft::identity<T>, Compare, Alloc, NodePolicy>::const_iterator const_iterator;
         typedef ft::reverse_iterator<iterator>                      reverse_iterator;
         typedef ft::reverse_iterator<const_iterator>                const_reverse_iterator;
         typedef typename iterator_traits<iterator>::difference_type difference_type;
         typedef size_t                                              size_type;
+        typedef typename RBTree<T, T, ft::identity<T>, Compare, Alloc, NodePolicy>::node_handle_type   node_type;
+        typedef typename RBTree<T, T, ft::identity<T>, Compare, Alloc, NodePolicy>::insert_return_type insert_return_type;
 
     private:
-        RBTree<value_type, value_compare, allocator_type> _tree;
+        RBTree<key_type, value_type, ft::identity<value_type>, key_compare, allocator_type, NodePolicy> _tree;
+
+# if FT_CXX11
+        template<typename U, typename C, typename A, typename P>
+        friend void assign_set_operation(parallel_t policy, set_operation op, const set<U, C, A, P> &x,
+                                         const set<U, C, A, P> &y, set<U, C, A, P> &result);
+# endif
 
     public:
         explicit set(const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
@@ -41,11 +53,20 @@ namespace ft {
         set(InputIterator first, InputIterator last,
             const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type(),
             typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        set(assume_sorted_t, InputIterator first, InputIterator last,
+            const key_compare &comp = key_compare(), const allocator_type &alloc = allocator_type());
         set(const set &src);
+# if FT_CXX11
+        set(set &&src);
+# endif
 
         ~set();
 
         set                      &operator=(const set &other);
+# if FT_CXX11
+        set                      &operator=(set &&other);
+# endif
 
         iterator                 begin();
         const_iterator           begin() const;
@@ -65,17 +86,36 @@ namespace ft {
 
         pair<iterator, bool>     insert(const value_type &val);
         iterator                 insert(iterator position, const value_type &val);
+# if FT_CXX11
+        pair<iterator, bool>     insert(value_type &&val);
+        iterator                 insert(iterator position, value_type &&val);
+        template<typename... Args>
+        pair<iterator, bool>     emplace(Args&&... args);
+        template<typename... Args>
+        iterator                 emplace_hint(iterator position, Args&&... args);
+# endif
         template<typename InputIterator>
         void                     insert(InputIterator first, InputIterator last,
                                         typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        template<typename InputIterator>
+        void                     insert(assume_sorted_t, InputIterator first, InputIterator last);
+        insert_return_type       insert(const node_type &nh);
+        iterator                 insert(iterator position, const node_type &nh);
 
         void                     erase(iterator position);
         size_type                erase(const value_type &val);
         void                     erase(iterator first, iterator last);
 
+        node_type                extract(iterator position);
+        node_type                extract(const value_type &val);
+
         void                     swap(set &x);
         void                     clear();
 
+        void                     split(const value_type &val, set &x);
+        void                     join(set &x);
+        void                     merge(set &x);
+
         key_compare              key_comp() const;
         value_compare            value_comp() const;
 
@@ -86,7 +126,33 @@ namespace ft {
         iterator                 upper_bound(const value_type &val) const;
         pair<iterator, iterator> equal_range(const value_type &val) const;
 
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                 find(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, size_type>::type
+                                 count(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                 lower_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, iterator>::type
+                                 upper_bound(const K &k) const;
+        template<typename K>
+        typename ft::enable_if<ft::is_transparent<key_compare, K>::value, pair<iterator, iterator> >::type
+                                 equal_range(const K &k) const;
+
+        template<typename ForwardIterator, typename OutputIterator>
+        OutputIterator           find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const;
+
         allocator_type           get_allocator() const;
+
+        iterator                 nth(size_type n) const;
+        size_type                rank(const value_type &val) const;
+        size_type                count_range(const value_type &lo, const value_type &hi) const;
+
+        size_type                height() const;
+        bool                     verify() const;
     };
 
     /**
@@ -95,9 +161,9 @@ namespace ft {
      *              returns true if the first argument goes before the second argument in the strict weak ordering it defines, and false otherwise
      * @param alloc Allocator object
      */
-    template<typename T, typename Compare, typename Alloc>
-    set<T, Compare, Alloc>::set(const key_compare &comp, const allocator_type &alloc):
-    _tree(RBTree<value_type, value_compare, allocator_type>(comp, alloc)) {}
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    set<T, Compare, Alloc, NodePolicy>::set(const key_compare &comp, const allocator_type &alloc):
+    _tree(comp, alloc) {}
 
     /**
      * Range constructor
@@ -107,45 +173,81 @@ namespace ft {
      *              returns true if the first argument goes before the second argument in the strict weak ordering it defines, and false otherwise
      * @param alloc Allocator object
      */
-    template<typename T, typename Compare, typename Alloc>
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
     template<typename InputIterator>
-    set<T, Compare, Alloc>::set(InputIterator first, InputIterator last,
+    set<T, Compare, Alloc, NodePolicy>::set(InputIterator first, InputIterator last,
                                 const key_compare &comp, const allocator_type &alloc,
                                 typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*):
-                                _tree(RBTree<value_type, value_compare, allocator_type>(comp, alloc)) {
+                                _tree(comp, alloc) {
         _tree.insert(first, last);
     }
 
+    /**
+     * Sorted range constructor, builds the tree in linear time without comparing the elements
+     * @param first Input iterator to the initial position in a range sorted by key and holding no equivalent keys
+     * @param last  Input iterator to the final position in a range
+     * @param comp  Binary predicate that, taking two values of the same type of those contained in the set,
+     *              returns true if the first argument goes before the second argument in the strict weak ordering it defines, and false otherwise
+     * @param alloc Allocator object
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename InputIterator>
+    set<T, Compare, Alloc, NodePolicy>::set(assume_sorted_t, InputIterator first, InputIterator last,
+                                const key_compare &comp, const allocator_type &alloc):
+                                _tree(comp, alloc) {
+        _tree.insert(assume_sorted, first, last);
+    }
+
     /**
      * Copy constructor
      * @param src Another set object of the same type
      */
-    template<typename T, typename Compare, typename Alloc>
-    set<T, Compare, Alloc>::set(const set &src): _tree(src._tree) {}
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    set<T, Compare, Alloc, NodePolicy>::set(const set &src): _tree(src._tree) {}
+
+# if FT_CXX11
+    /**
+     * Move constructor, src is left empty
+     * @param src Another set object of the same type
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    set<T, Compare, Alloc, NodePolicy>::set(set &&src): _tree(std::move(src._tree)) {}
+# endif
 
     /**
      * Destructor
      */
-    template<typename T, typename Compare, typename Alloc>
-    set<T, Compare, Alloc>::~set() {}
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    set<T, Compare, Alloc, NodePolicy>::~set() {}
 
     /**
      * Copy container content
      */
-    template<typename T, typename Compare, typename Alloc>
-    set<T, Compare, Alloc> &set<T, Compare, Alloc>::operator=(const set &other) {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    set<T, Compare, Alloc, NodePolicy> &set<T, Compare, Alloc, NodePolicy>::operator=(const set &other) {
         if (this == &other)
             return (*this);
         _tree = other._tree;
         return (*this);
     }
 
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    set<T, Compare, Alloc, NodePolicy> &set<T, Compare, Alloc, NodePolicy>::operator=(set &&other) {
+        _tree = std::move(other._tree);
+        return (*this);
+    }
+# endif
+
     /**
      * Return iterator to beginning
      * @return An iterator to the first element in the container
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::iterator set<T, Compare, Alloc>::begin() {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::iterator set<T, Compare, Alloc, NodePolicy>::begin() {
         return (_tree.begin());
     }
 
@@ -153,8 +255,8 @@ namespace ft {
      * Return const iterator to beginning
      * @return A const iterator to the first element in the container
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::const_iterator set<T, Compare, Alloc>::begin() const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::const_iterator set<T, Compare, Alloc, NodePolicy>::begin() const {
         return (_tree.begin());
     }
 
@@ -162,8 +264,8 @@ namespace ft {
      * Return iterator to end
      * @return An iterator to the past-the-end element in the container
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::iterator set<T, Compare, Alloc>::end() {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::iterator set<T, Compare, Alloc, NodePolicy>::end() {
         return (_tree.end());
     }
 
@@ -171,8 +273,8 @@ namespace ft {
      * Return const iterator to end
      * @return A const iterator to the past-the-end element in the container
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::const_iterator set<T, Compare, Alloc>::end() const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::const_iterator set<T, Compare, Alloc, NodePolicy>::end() const {
         return (_tree.end());
     }
 
@@ -180,8 +282,8 @@ namespace ft {
      * Return reverse iterator to reverse beginning
      * @return A reverse iterator to the reverse beginning of the sequence container
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::reverse_iterator set<T, Compare, Alloc>::rbegin() {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::reverse_iterator set<T, Compare, Alloc, NodePolicy>::rbegin() {
         return (_tree.rbegin());
     }
 
@@ -189,8 +291,8 @@ namespace ft {
      * Return const reverse iterator to reverse beginning
      * @return A const reverse iterator to the reverse beginning of the sequence container
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::const_reverse_iterator set<T, Compare, Alloc>::rbegin() const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::const_reverse_iterator set<T, Compare, Alloc, NodePolicy>::rbegin() const {
         return (_tree.rbegin());
     }
 
@@ -198,8 +300,8 @@ namespace ft {
      * Return reverse iterator to reverse end
      * @return A reverse iterator to the reverse end of the sequence container
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::reverse_iterator set<T, Compare, Alloc>::rend() {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::reverse_iterator set<T, Compare, Alloc, NodePolicy>::rend() {
         return (_tree.rend());
     }
 
@@ -207,8 +309,8 @@ namespace ft {
      * Return const reverse iterator to reverse end
      * @return A const reverse iterator to the reverse end of the sequence container
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::const_reverse_iterator set<T, Compare, Alloc>::rend() const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::const_reverse_iterator set<T, Compare, Alloc, NodePolicy>::rend() const {
         return (_tree.rend());
     }
 
@@ -216,8 +318,8 @@ namespace ft {
      * Test whether container is empty
      * @return true if the container size is 0, false otherwise
      */
-    template<typename T, typename Compare, typename Alloc>
-    bool set<T, Compare, Alloc>::empty() const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    bool set<T, Compare, Alloc, NodePolicy>::empty() const {
         return (_tree.empty());
     }
 
@@ -225,8 +327,8 @@ namespace ft {
      * Return container size
      * @return The number of elements in the container
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::size_type set<T, Compare, Alloc>::size() const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::size_type set<T, Compare, Alloc, NodePolicy>::size() const {
         return (_tree.size());
     }
 
@@ -234,8 +336,8 @@ namespace ft {
      * Return maximum size
      * @return The maximum number of elements a set container can hold as content
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::size_type set<T, Compare, Alloc>::max_size() const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::size_type set<T, Compare, Alloc, NodePolicy>::max_size() const {
         return (_tree.max_size());
     }
 
@@ -246,8 +348,8 @@ namespace ft {
      *         to the element with an equivalent value in the set. The pair::second element in the pair is set to true
      *         if a new element was inserted or false if an equivalent key already existed
      */
-    template<typename T, typename Compare, typename Alloc>
-    pair<typename set<T, Compare, Alloc>::iterator, bool> set<T, Compare, Alloc>::insert(const value_type &val) {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    pair<typename set<T, Compare, Alloc, NodePolicy>::iterator, bool> set<T, Compare, Alloc, NodePolicy>::insert(const value_type &val) {
         return (_tree.insert(val));
     }
 
@@ -257,29 +359,113 @@ namespace ft {
      * @param val      Value to be copied to the inserted element
      * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent value in the set
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::iterator set<T, Compare, Alloc>::insert(set::iterator position, const value_type &val) {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::iterator set<T, Compare, Alloc, NodePolicy>::insert(set::iterator position, const value_type &val) {
         return (_tree.insert(position, val));
     }
 
+# if FT_CXX11
+    /**
+     * Insert element
+     * @param val Value to be moved to the inserted element
+     * @return A pair, with its member pair::first set to an iterator pointing to either the newly inserted element or
+     *         to the element with an equivalent value in the set. The pair::second element in the pair is set to true
+     *         if a new element was inserted or false if an equivalent value already existed
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    pair<typename set<T, Compare, Alloc, NodePolicy>::iterator, bool> set<T, Compare, Alloc, NodePolicy>::insert(value_type &&val) {
+        return (_tree.insert(std::move(val)));
+    }
+
+    /**
+     * Insert element
+     * @param position Hint for the position where the element can be inserted
+     * @param val      Value to be moved to the inserted element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent value in the set
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::iterator set<T, Compare, Alloc, NodePolicy>::insert(iterator position, value_type &&val) {
+        return (_tree.insert(position, std::move(val)));
+    }
+
+    /**
+     * Construct and insert element
+     * @param args Arguments forwarded to the constructor of the new element
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename... Args>
+    pair<typename set<T, Compare, Alloc, NodePolicy>::iterator, bool> set<T, Compare, Alloc, NodePolicy>::emplace(Args&&... args) {
+        return (_tree.emplace(std::forward<Args>(args)...));
+    }
+
+    /**
+     * Construct and insert element
+     * @param position Hint for the position where the element can be inserted
+     * @param args     Arguments forwarded to the constructor of the new element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equivalent value in the set
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename... Args>
+    typename set<T, Compare, Alloc, NodePolicy>::iterator set<T, Compare, Alloc, NodePolicy>::emplace_hint(iterator position, Args&&... args) {
+        return (_tree.emplace_hint(position, std::forward<Args>(args)...));
+    }
+# endif
+
     /**
      * Insert elements
      * @param first Input iterator to the initial position in a range
      * @param last  Input iterator to the final position in a range
      */
-    template<typename T, typename Compare, typename Alloc>
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
     template<typename InputIterator>
-    void set<T, Compare, Alloc>::insert(InputIterator first, InputIterator last,
+    void set<T, Compare, Alloc, NodePolicy>::insert(InputIterator first, InputIterator last,
                                         typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*) {
         _tree.insert(first, last);
     }
 
+    /**
+     * Insert elements from a range sorted by key that holds no equivalent keys,
+     * an empty set is built from it in linear time
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename InputIterator>
+    void set<T, Compare, Alloc, NodePolicy>::insert(assume_sorted_t, InputIterator first, InputIterator last) {
+        _tree.insert(assume_sorted, first, last);
+    }
+
+    /**
+     * Insert the node owned by a handle returned by extract, without allocating or copying the element.
+     * The allocators must compare equal
+     * @param nh Node handle, emptied only if the node is inserted
+     * @return The inserted element, or the equivalent element, whether the node was inserted,
+     *         and the node if it was not
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::insert_return_type set<T, Compare, Alloc, NodePolicy>::insert(const node_type &nh) {
+        return (_tree.insert(nh));
+    }
+
+    /**
+     * Insert the node owned by a handle returned by extract with hint, without allocating or copying the element.
+     * The allocators must compare equal
+     * @param position Hint for the position where the element can be inserted
+     * @param nh       Node handle, emptied only if the node is inserted
+     * @return An iterator to the inserted element or to the equivalent element, end() if nh is empty
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::iterator set<T, Compare, Alloc, NodePolicy>::insert(iterator position, const node_type &nh) {
+        return (_tree.insert(position, nh));
+    }
+
     /**
      * Erase elements
      * @param position Iterator pointing to a single element to be removed from the set
      */
-    template<typename T, typename Compare, typename Alloc>
-    void set<T, Compare, Alloc>::erase(iterator position) {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set<T, Compare, Alloc, NodePolicy>::erase(iterator position) {
         _tree.erase(position);
     }
 
@@ -288,8 +474,8 @@ namespace ft {
      * @param val Value of the element to be removed from the set
      * @return Number of elements erased
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::size_type set<T, Compare, Alloc>::erase(const value_type &val) {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::size_type set<T, Compare, Alloc, NodePolicy>::erase(const value_type &val) {
         return (_tree.erase(val));
     }
 
@@ -298,44 +484,99 @@ namespace ft {
      * @param first Iterator to the initial position in a range
      * @param last  Iterator to the final position in a range
      */
-    template<typename T, typename Compare, typename Alloc>
-    void set<T, Compare, Alloc>::erase(set::iterator first, set::iterator last) {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set<T, Compare, Alloc, NodePolicy>::erase(set::iterator first, set::iterator last) {
         _tree.erase(first, last);
     }
 
+    /**
+     * Take an element out of the set without destroying it, its node is unlinked and owned by the returned handle
+     * @param position Iterator pointing to a single element of the set
+     * @return A node handle owning the element
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::node_type set<T, Compare, Alloc, NodePolicy>::extract(iterator position) {
+        return (_tree.extract(position));
+    }
+
+    /**
+     * Take the element equivalent to val out of the set without destroying it
+     * @param val Value of the element
+     * @return A node handle owning the element, empty if no element is equivalent to val
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::node_type set<T, Compare, Alloc, NodePolicy>::extract(const value_type &val) {
+        return (_tree.extract(val));
+    }
+
     /**
     * Swap content
     * @param x Another set container of the same type as this
     */
-    template<typename T, typename Compare, typename Alloc>
-    void set<T, Compare, Alloc>::swap(set &x) {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set<T, Compare, Alloc, NodePolicy>::swap(set &x) {
         _tree.swap(x._tree);
     }
 
     /**
     * Clear content
     */
-    template<typename T, typename Compare, typename Alloc>
-    void set<T, Compare, Alloc>::clear() {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set<T, Compare, Alloc, NodePolicy>::clear() {
         _tree.clear();
     }
 
+    /**
+     * Move the elements with a value not before val into x (extension).
+     * Takes logarithmic time with ft::order_statistics, otherwise counting the new sizes adds time linear in
+     * the smaller part. Nodes are relinked, nothing is allocated or copied, the allocators must compare equal
+     * @param val Value where the container is split
+     * @param x   Another set object of the same type, its previous content is destroyed
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set<T, Compare, Alloc, NodePolicy>::split(const value_type &val, set &x) {
+        _tree.split(val, x._tree);
+    }
+
+    /**
+     * Move the elements of x into the container (extension).
+     * Takes logarithmic time if all the values of x go after, or all before, the values of the container,
+     * otherwise the elements are moved one at a time and those with an equivalent value stay in x.
+     * Nodes are relinked, nothing is allocated or copied, the allocators must compare equal
+     * @param x Another set object of the same type
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set<T, Compare, Alloc, NodePolicy>::join(set &x) {
+        _tree.join(x._tree);
+    }
+
+    /**
+     * Move the elements of x that are not in the container into it, the others stay in x.
+     * Nodes are relinked, nothing is allocated or copied, the allocators must compare equal.
+     * Same as join, which concatenates the trees in logarithmic time when the value ranges do not overlap
+     * @param x Another set object of the same type
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set<T, Compare, Alloc, NodePolicy>::merge(set &x) {
+        _tree.join(x._tree);
+    }
+
     /**
      * Return key comparison object
      * @return The comparison object
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::key_compare set<T, Compare, Alloc>::key_comp() const {
-        return (_tree.value_comp());
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::key_compare set<T, Compare, Alloc, NodePolicy>::key_comp() const {
+        return (_tree.key_comp());
     }
 
     /**
      * Return value comparison object
      * @return The comparison object for element values
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::value_compare set<T, Compare, Alloc>::value_comp() const {
-        return (_tree.value_comp());
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::value_compare set<T, Compare, Alloc, NodePolicy>::value_comp() const {
+        return (_tree.key_comp());
     }
 
     /**
@@ -343,8 +584,8 @@ namespace ft {
      * @param val Value to be searched for
      * @return An iterator to the element, if an element with specified value is found, or set::end otherwise
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::iterator set<T, Compare, Alloc>::find(const value_type &val) const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::iterator set<T, Compare, Alloc, NodePolicy>::find(const value_type &val) const {
         return (_tree.find(val));
     }
 
@@ -353,8 +594,8 @@ namespace ft {
     * @param val Value to search for
     * @return 1 if the container contains an element whose value is equivalent to val, or zero otherwise
     */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::size_type set<T, Compare, Alloc>::count(const value_type &val) const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::size_type set<T, Compare, Alloc, NodePolicy>::count(const value_type &val) const {
         return (_tree.count(val));
     }
 
@@ -364,8 +605,8 @@ namespace ft {
      * @return An iterator to the the first element in the container which is not considered to go before val,
      *         or set::end if all elements are considered to go before val
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::iterator set<T, Compare, Alloc>::lower_bound(const value_type &val) const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::iterator set<T, Compare, Alloc, NodePolicy>::lower_bound(const value_type &val) const {
         return (_tree.lower_bound(val));
     }
 
@@ -375,9 +616,9 @@ namespace ft {
      * @return An iterator to the the first element in the container which is considered to go after val,
      *         or set::end if no elements are considered to go after val
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::iterator set<T, Compare, Alloc>::upper_bound(const value_type &val) const {
-        return (_tree.lower_bound(val));
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::iterator set<T, Compare, Alloc, NodePolicy>::upper_bound(const value_type &val) const {
+        return (_tree.upper_bound(val));
     }
 
     /**
@@ -386,21 +627,250 @@ namespace ft {
      * @return pair, whose member pair::first is the lower bound of the range (the same as lower_bound),
      *         and pair::second is the upper bound (the same as upper_bound)
      */
-    template<typename T, typename Compare, typename Alloc>
-    pair <typename set<T, Compare, Alloc>::iterator, typename set<T, Compare, Alloc>::iterator>
-    set<T, Compare, Alloc>::equal_range(const value_type &val) const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    pair <typename set<T, Compare, Alloc, NodePolicy>::iterator, typename set<T, Compare, Alloc, NodePolicy>::iterator>
+    set<T, Compare, Alloc, NodePolicy>::equal_range(const value_type &val) const {
         return (_tree.equal_range(val));
     }
 
+    /**
+     * Get iterator to element, with a transparent comparison object
+     * @param k Value comparable with the elements, looked up without being converted to value_type
+     * @return An iterator to the element, if an element equivalent to k is found, or set::end otherwise
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename set<T, Compare, Alloc, NodePolicy>::iterator>::type
+    set<T, Compare, Alloc, NodePolicy>::find(const K &k) const {
+        return (_tree.find(k));
+    }
+
+    /**
+     * Count elements equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return 1 if the container contains an element equivalent to k, or zero otherwise
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename set<T, Compare, Alloc, NodePolicy>::size_type>::type
+    set<T, Compare, Alloc, NodePolicy>::count(const K &k) const {
+        return (_tree.count(k));
+    }
+
+    /**
+     * Return iterator to lower bound, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return An iterator to the the first element in the container which is not considered to go before k
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename set<T, Compare, Alloc, NodePolicy>::iterator>::type
+    set<T, Compare, Alloc, NodePolicy>::lower_bound(const K &k) const {
+        return (_tree.lower_bound(k));
+    }
+
+    /**
+     * Return iterator to upper bound, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return An iterator to the the first element in the container which is considered to go after k
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, typename set<T, Compare, Alloc, NodePolicy>::iterator>::type
+    set<T, Compare, Alloc, NodePolicy>::upper_bound(const K &k) const {
+        return (_tree.upper_bound(k));
+    }
+
+    /**
+     * Get range of elements equivalent to k, with a transparent comparison object
+     * @param k Value comparable with the elements
+     * @return pair, whose member pair::first is the lower bound of the range, and pair::second is the upper bound
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename K>
+    typename ft::enable_if<ft::is_transparent<Compare, K>::value, pair<typename set<T, Compare, Alloc, NodePolicy>::iterator, typename set<T, Compare, Alloc, NodePolicy>::iterator> >::type
+    set<T, Compare, Alloc, NodePolicy>::equal_range(const K &k) const {
+        return (_tree.equal_range(k));
+    }
+
+    /**
+     * Get iterators to the elements of a batch of values (extension).
+     * Faster than one find per value: a sorted batch is merged with the tree, any other batch advances several
+     * descents at once so that their cache misses overlap, see FT_RB_TREE_BATCH_LANES
+     * @param first Forward iterator to the first value
+     * @param last  Forward iterator past the last value
+     * @param out   Output iterator that receives, for each value in order, an iterator to its element or set::end
+     * @return out past the last iterator written
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    template<typename ForwardIterator, typename OutputIterator>
+    OutputIterator set<T, Compare, Alloc, NodePolicy>::find_batch(ForwardIterator first, ForwardIterator last, OutputIterator out) const {
+        return (_tree.find_batch(first, last, out));
+    }
+
     /**
      * Get allocator
      * @return The allocator
      */
-    template<typename T, typename Compare, typename Alloc>
-    typename set<T, Compare, Alloc>::allocator_type set<T, Compare, Alloc>::get_allocator() const {
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::allocator_type set<T, Compare, Alloc, NodePolicy>::get_allocator() const {
         return (_tree.get_allocator());
     }
 
+    /**
+     * Get the element at a position in order (extension), requires ft::order_statistics
+     * @param n Position of the element, 0 for the first one
+     * @return An iterator to the element, or end() if n is not less than size()
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::iterator set<T, Compare, Alloc, NodePolicy>::nth(size_type n) const {
+        return (_tree.nth(n));
+    }
+
+    /**
+     * Get the position of a value in order (extension), requires ft::order_statistics
+     * @param val Value
+     * @return The number of elements that go before val
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::size_type set<T, Compare, Alloc, NodePolicy>::rank(const value_type &val) const {
+        return (_tree.rank(val));
+    }
+
+    /**
+     * Count the elements in [lo, hi) (extension), requires ft::order_statistics
+     * @param lo Lower bound of the range, included
+     * @param hi Upper bound of the range, excluded
+     * @return The number of elements in the range
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::size_type set<T, Compare, Alloc, NodePolicy>::count_range(const value_type &lo, const value_type &hi) const {
+        return (_tree.count_range(lo, hi));
+    }
+
+    /**
+     * Get height of the underlying red-black tree (extension)
+     * @return The number of nodes on the longest path from the root down to a leaf, at most 2 * log2(size() + 1)
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    typename set<T, Compare, Alloc, NodePolicy>::size_type set<T, Compare, Alloc, NodePolicy>::height() const {
+        return (_tree.height());
+    }
+
+    /**
+     * Check the invariants of the underlying red-black tree (extension), takes linear time
+     * @return true if the tree is valid
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    bool set<T, Compare, Alloc, NodePolicy>::verify() const {
+        return (_tree.verify());
+    }
+
+    /**
+     * Replace the content of result by the result of a set operation on two sets, in linear time (extension).
+     * Both sets are merged in one pass and the result is built as a balanced tree from the merged sequence,
+     * so every element is compared once and copied once. result may be x or y
+     * @param op     Operation
+     * @param x      First set, an element found in both sets is copied from it
+     * @param y      Second set, ordered by the same comparison object
+     * @param result Set that receives the result, keeps its allocator and takes the comparison object of x
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void assign_set_operation(set_operation op, const set<T, Compare, Alloc, NodePolicy> &x, const set<T, Compare, Alloc, NodePolicy> &y, set<T, Compare, Alloc, NodePolicy> &result) {
+        typedef set<T, Compare, Alloc, NodePolicy>                                    set_type;
+        typedef typename set_type::const_iterator                                     const_iterator;
+        typedef typename set_type::value_compare                                      value_compare;
+        typedef set_operation_iterator<const_iterator, const_iterator, value_compare> merge_iterator;
+
+        merge_iterator first(op, x.begin(), x.end(), y.begin(), y.end(), x.value_comp());
+        merge_iterator last(op, x.end(), x.end(), y.end(), y.end(), x.value_comp());
+        set_type       tmp(assume_sorted, first, last, x.key_comp(), result.get_allocator());
+
+        result.swap(tmp);
+    }
+
+    /**
+     * Store the union of two sets in result, the elements found in x or in y, in linear time (extension)
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_union(const set<T, Compare, Alloc, NodePolicy> &x, const set<T, Compare, Alloc, NodePolicy> &y, set<T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(set_union_op, x, y, result);
+    }
+
+    /**
+     * Store the intersection of two sets in result, the elements of x found in y, in linear time (extension)
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_intersection(const set<T, Compare, Alloc, NodePolicy> &x, const set<T, Compare, Alloc, NodePolicy> &y, set<T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(set_intersection_op, x, y, result);
+    }
+
+    /**
+     * Store the difference of two sets in result, the elements of x not found in y, in linear time (extension)
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_difference(const set<T, Compare, Alloc, NodePolicy> &x, const set<T, Compare, Alloc, NodePolicy> &y, set<T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(set_difference_op, x, y, result);
+    }
+
+    /**
+     * Store the symmetric difference of two sets in result, the elements found in only one of x and y, in linear time (extension)
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_symmetric_difference(const set<T, Compare, Alloc, NodePolicy> &x, const set<T, Compare, Alloc, NodePolicy> &y, set<T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(set_symmetric_difference_op, x, y, result);
+    }
+
+# if FT_CXX11
+    /**
+     * Replace the content of result by the result of a set operation on two sets, on several threads (extension, C++11).
+     * The keys of the first levels of the larger set cut both sets into ranges, each thread merges one range of
+     * each into a balanced tree and the trees are joined. The allocator must be safe to use from several threads
+     * at once, which rules out ft::pool_allocator and ft::counting_allocator; operands smaller than
+     * FT_RB_TREE_PARALLEL_MIN elements in total are merged on the calling thread. result may be x or y
+     * @param policy ft::parallel, or ft::parallel_t(n) for n threads
+     * @param op     Operation
+     * @param x      First set, an element found in both sets is copied from it
+     * @param y      Second set, ordered by the same comparison object
+     * @param result Set that receives the result, keeps its allocator and takes the comparison object of x
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void assign_set_operation(parallel_t policy, set_operation op, const set<T, Compare, Alloc, NodePolicy> &x, const set<T, Compare, Alloc, NodePolicy> &y, set<T, Compare, Alloc, NodePolicy> &result) {
+        result._tree.assign_set_operation(policy, op, x._tree, y._tree, x.value_comp());
+    }
+
+    /**
+     * Store the union of two sets in result, the elements found in x or in y, on several threads (extension, C++11)
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_union(parallel_t policy, const set<T, Compare, Alloc, NodePolicy> &x, const set<T, Compare, Alloc, NodePolicy> &y, set<T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(policy, set_union_op, x, y, result);
+    }
+
+    /**
+     * Store the intersection of two sets in result, the elements of x found in y, on several threads (extension, C++11)
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_intersection(parallel_t policy, const set<T, Compare, Alloc, NodePolicy> &x, const set<T, Compare, Alloc, NodePolicy> &y, set<T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(policy, set_intersection_op, x, y, result);
+    }
+
+    /**
+     * Store the difference of two sets in result, the elements of x not found in y, on several threads (extension, C++11)
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_difference(parallel_t policy, const set<T, Compare, Alloc, NodePolicy> &x, const set<T, Compare, Alloc, NodePolicy> &y, set<T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(policy, set_difference_op, x, y, result);
+    }
+
+    /**
+     * Store the symmetric difference of two sets in result, the elements found in only one of x and y, on several threads (extension, C++11)
+     */
+    template<typename T, typename Compare, typename Alloc, typename NodePolicy>
+    void set_symmetric_difference(parallel_t policy, const set<T, Compare, Alloc, NodePolicy> &x, const set<T, Compare, Alloc, NodePolicy> &y, set<T, Compare, Alloc, NodePolicy> &result) {
+        assign_set_operation(policy, set_symmetric_difference_op, x, y, result);
+    }
+# endif
 
 }
 
@@ -22,6 +22,9 @@ namespace ft {
 
     public:
         explicit stack(const container_type &ctnr = container_type());
+# if FT_CXX11
+        explicit stack(container_type &&ctnr);
+# endif
 
         bool             empty() const;
         size_type        size() const;
@@ -30,6 +33,11 @@ namespace ft {
         const value_type &top() const;
 
         void             push(const value_type &val);
+# if FT_CXX11
+        void             push(value_type &&val);
+        template<typename... Args>
+        void             emplace(Args&&... args);
+# endif
         void             pop();
 
         friend bool operator==(const stack<T, Container> &lhs, const stack<T, Container> &rhs) {
@@ -64,6 +72,15 @@ namespace ft {
     template<typename T, typename Container>
     stack<T, Container>::stack(const container_type &ctnr): c(ctnr) {}
 
+# if FT_CXX11
+    /**
+     * Construct stack
+     * @param ctnr Container object moved into the stack
+     */
+    template<typename T, typename Container>
+    stack<T, Container>::stack(container_type &&ctnr): c(std::move(ctnr)) {}
+# endif
+
     /**
      * Test whether container is empty
      * @return true if the underlying container's size is 0, false otherwise
@@ -109,6 +126,27 @@ namespace ft {
         c.push_back(val);
     }
 
+# if FT_CXX11
+    /**
+     * Insert element
+     * @param val Value moved to the inserted element
+     */
+    template<typename T, typename Container>
+    void stack<T, Container>::push(value_type &&val) {
+        c.push_back(std::move(val));
+    }
+
+    /**
+     * Construct and insert element
+     * @param args Arguments forwarded to the constructor of the new element
+     */
+    template<typename T, typename Container>
+    template<typename... Args>
+    void stack<T, Container>::emplace(Args&&... args) {
+        c.emplace_back(std::forward<Args>(args)...);
+    }
+# endif
+
     /**
      * Remove top element
      */
@@ -1,6 +1,32 @@
 #ifndef FT_CONTAINERS_TYPE_TRAITS_HPP
 # define FT_CONTAINERS_TYPE_TRAITS_HPP
 
+# include <cstddef>
+
+/**
+ * FT_CXX11 is set when the headers are built as C++11 or later (make STD=c++11),
+ * it enables move semantics and the emplace family of functions
+ */
+# if __cplusplus >= 201103L
+#  define FT_CXX11 1
+#  include <type_traits>
+#  include <utility>
+#  define FT_MOVE(x) std::move(x)
+# else
+#  define FT_CXX11 0
+#  define FT_MOVE(x) (x)
+# endif
+
+/**
+ * FT_PREFETCH(addr) asks the CPU to start loading the cache line at addr, reading it never faults
+ * even for NULL. It compiles to nothing on compilers without __builtin_prefetch
+ */
+# if defined(__GNUC__) || defined(__clang__)
+#  define FT_PREFETCH(addr) __builtin_prefetch(static_cast<const void*>(addr))
+# else
+#  define FT_PREFETCH(addr) ((void)(addr))
+# endif
+
 namespace ft {
 
     template<bool Cond, typename T = void>
@@ -68,6 +94,131 @@ namespace ft {
         static const bool value = true;
     };
 
+    template<typename T, T v>
+    struct integral_constant {
+        static const T value = v;
+        typedef T                  value_type;
+        typedef integral_constant  type;
+    };
+
+    typedef integral_constant<bool, true>  true_type;
+    typedef integral_constant<bool, false> false_type;
+
+    template<typename T>
+    struct is_floating_point: false_type {};
+    template<>
+    struct is_floating_point<float>: true_type {};
+    template<>
+    struct is_floating_point<double>: true_type {};
+    template<>
+    struct is_floating_point<long double>: true_type {};
+
+    template<typename T>
+    struct is_pointer: false_type {};
+    template<typename T>
+    struct is_pointer<T*>: true_type {};
+
+    /**
+     * Whether an expression of type From converts implicitly to To, detected by overload resolution
+     * @tparam From Source type
+     * @tparam To Destination type
+     */
+    template<typename From, typename To>
+    struct is_convertible {
+    private:
+        typedef char yes;
+        struct no {
+            char c[2];
+        };
+
+        static yes  _test(To);
+        static no   _test(...);
+        static From _make();
+
+    public:
+        static const bool value = sizeof(_test(_make())) == sizeof(yes);
+    };
+
+    /**
+     * Types whose objects can be copy assigned. A C++98 build cannot detect a private or missing assignment operator
+     * and only rules out const types, as well as pairs holding one (utility.hpp), such as the elements of a map
+     */
+    template<typename T>
+    struct is_copy_assignable: integral_constant<bool,
+# if FT_CXX11
+        std::is_copy_assignable<T>::value
+# else
+        true
+# endif
+    > {};
+    template<typename T>
+    struct is_copy_assignable<const T>: false_type {};
+
+    /**
+     * Alignment requirement of a type, the offset of T in a struct that puts a char in front of it
+     * @tparam T Type
+     */
+    template<typename T>
+    struct alignment_of {
+    private:
+        struct holder {
+            char c;
+            T    t;
+        };
+
+    public:
+        static const size_t value = sizeof(holder) - sizeof(T);
+    };
+
+    /**
+     * Fundamental type whose alignment requirement is Align, for raw storage that must hold an object
+     * aligned like a type with that requirement. Falls back to long double, the strictest of them
+     * @tparam Align Alignment requirement, as given by alignment_of
+     */
+    template<size_t Align>
+    struct type_with_alignment {
+    private:
+        template<bool Cond, typename T, typename F>
+        struct select {
+            typedef T type;
+        };
+        template<typename T, typename F>
+        struct select<false, T, F> {
+            typedef F type;
+        };
+
+    public:
+        typedef typename select<alignment_of<char>::value == Align, char,
+                typename select<alignment_of<short>::value == Align, short,
+                typename select<alignment_of<int>::value == Align, int,
+                typename select<alignment_of<long>::value == Align, long,
+                typename select<alignment_of<long long>::value == Align, long long,
+                typename select<alignment_of<double>::value == Align, double,
+                    long double>::type>::type>::type>::type>::type>::type type;
+    };
+
+    /**
+     * Types whose objects can be copied with memcpy.
+     * Uses the compiler builtin where available, otherwise only arithmetic and pointer types are detected
+     */
+    template<typename T>
+    struct is_trivially_copyable: integral_constant<bool,
+# if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+        __is_trivially_copyable(T)
+# else
+        is_integral<T>::value || is_floating_point<T>::value || is_pointer<T>::value
+# endif
+    > {};
+
+    /**
+     * Types whose objects can be moved to another address with memcpy, the source then being treated as raw memory.
+     * Containers use it to move elements in bulk when they grow or shift their storage.
+     * Every trivially copyable type qualifies; specialize it for user types that do not point into themselves:
+     *     namespace ft { template<> struct is_trivially_relocatable<MyType>: true_type {}; }
+     */
+    template<typename T>
+    struct is_trivially_relocatable: integral_constant<bool, is_trivially_copyable<T>::value> {};
+
 }
 
 #endif //FT_CONTAINERS_TYPE_TRAITS_HPP
@@ -0,0 +1,558 @@
+#ifndef FT_CONTAINERS_UNORDERED_MAP_HPP
+# define FT_CONTAINERS_UNORDERED_MAP_HPP
+
+# include <memory>
+# include <stdexcept>
+# include "utility.hpp"
+# include "functional.hpp"
+# include "hash_table.hpp"
+# include "iterator.hpp"
+
+namespace ft {
+
+    /**
+     * Associative container that store elements formed by a combination of a key value and a mapped value, in no particular order.
+     * The elements live in an open addressing hash table, see HashTable: a lookup costs one hash and usually
+     * one group of control bytes, and erasing an element or growing the table may move the other elements,
+     * which invalidates the iterators and references to them
+     * @tparam Key      Type of the keys
+     * @tparam T        Type of the mapped value
+     * @tparam Hash     Hash function object of the keys
+     * @tparam KeyEqual A binary predicate that takes two keys as arguments and returns whether they are equal
+     * @tparam Alloc    Type of the allocator object used to define the storage allocation model
+     */
+    template< typename Key, typename T, typename Hash = hash<Key>, typename KeyEqual = equal_to<Key>,
+              typename Alloc = std::allocator< pair<const Key, T> > >
+    class unordered_map {
+    public:
+        typedef Key                                                                          key_type;
+        typedef T                                                                            mapped_type;
+        typedef pair<const key_type, mapped_type>                                            value_type;
+        typedef Hash                                                                         hasher;
+        typedef KeyEqual                                                                     key_equal;
+        typedef Alloc                                                                        allocator_type;
+        typedef typename allocator_type::reference                                           reference;
+        typedef typename allocator_type::const_reference                                     const_reference;
+        typedef typename allocator_type::pointer                                             pointer;
+        typedef typename allocator_type::const_pointer                                       const_pointer;
+
+    private:
+        typedef HashTable<key_type, value_type, ft::select1st<value_type>, hasher, key_equal, allocator_type> table_type;
+
+        table_type _table;
+
+    public:
+        typedef typename table_type::iterator                                                iterator;
+        typedef typename table_type::const_iterator                                          const_iterator;
+        typedef typename table_type::difference_type                                         difference_type;
+        typedef typename table_type::size_type                                               size_type;
+
+        explicit unordered_map(size_type n = 0, const hasher &hash = hasher(), const key_equal &eq = key_equal(),
+                               const allocator_type &alloc = allocator_type());
+        template<typename InputIterator>
+        unordered_map(InputIterator first, InputIterator last, size_type n = 0,
+                      const hasher &hash = hasher(), const key_equal &eq = key_equal(), const allocator_type &alloc = allocator_type(),
+                      typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+        unordered_map(const unordered_map &src);
+# if FT_CXX11
+        unordered_map(unordered_map &&src);
+# endif
+
+        ~unordered_map();
+
+        unordered_map                        &operator=(const unordered_map &other);
+# if FT_CXX11
+        unordered_map                        &operator=(unordered_map &&other);
+# endif
+
+        iterator                             begin();
+        const_iterator                       begin() const;
+
+        iterator                             end();
+        const_iterator                       end() const;
+
+        bool                                 empty() const;
+        size_type                            size() const;
+        size_type                            max_size() const;
+
+        mapped_type                          &operator[](const key_type &k);
+        mapped_type                          &at(const key_type &k);
+        const mapped_type                    &at(const key_type &k) const;
+
+        pair<iterator, bool>                 insert(const value_type &val);
+        iterator                             insert(iterator position, const value_type &val);
+# if FT_CXX11
+        pair<iterator, bool>                 insert(value_type &&val);
+        iterator                             insert(iterator position, value_type &&val);
+        template<typename... Args>
+        pair<iterator, bool>                 emplace(Args&&... args);
+        template<typename... Args>
+        iterator                             emplace_hint(iterator position, Args&&... args);
+        template<typename... Args>
+        pair<iterator, bool>                 try_emplace(const key_type &k, Args&&... args);
+        template<typename... Args>
+        pair<iterator, bool>                 try_emplace(key_type &&k, Args&&... args);
+# endif
+        template<typename InputIterator>
+        void                                 insert(InputIterator first, InputIterator last,
+                                                    typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
+
+        iterator                             erase(iterator position);
+        size_type                            erase(const key_type &k);
+        iterator                             erase(iterator first, iterator last);
+
+        void                                 swap(unordered_map &x);
+        void                                 clear();
+
+        iterator                             find(const key_type &k);
+        const_iterator                       find(const key_type &k) const;
+        size_type                            count(const key_type &k) const;
+        pair<iterator, iterator>             equal_range(const key_type &k);
+        pair<const_iterator, const_iterator> equal_range(const key_type &k) const;
+
+        size_type                            bucket_count() const;
+        float                                load_factor() const;
+        float                                max_load_factor() const;
+        void                                 max_load_factor(float ml);
+        void                                 rehash(size_type n);
+        void                                 reserve(size_type n);
+
+        hasher                               hash_function() const;
+        key_equal                            key_eq() const;
+        allocator_type                       get_allocator() const;
+    };
+
+    /**
+     * Empty container constructor
+     * @param n     Minimum number of buckets
+     * @param hash  Hash function object
+     * @param eq    Key equality predicate
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_map<Key, T, Hash, KeyEqual, Alloc>::unordered_map(size_type n, const hasher &hash, const key_equal &eq, const allocator_type &alloc):
+    _table(n, hash, eq, alloc) {}
+
+    /**
+     * Range constructor
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     * @param n     Minimum number of buckets
+     * @param hash  Hash function object
+     * @param eq    Key equality predicate
+     * @param alloc Allocator object
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    template<typename InputIterator>
+    unordered_map<Key, T, Hash, KeyEqual, Alloc>::unordered_map(InputIterator first, InputIterator last, size_type n,
+                                                                const hasher &hash, const key_equal &eq, const allocator_type &alloc,
+                                                                typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*):
+    _table(n, hash, eq, alloc) {
+        _table.insert(first, last);
+    }
+
+    /**
+     * Copy constructor
+     * @param src Another unordered_map object of the same type
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_map<Key, T, Hash, KeyEqual, Alloc>::unordered_map(const unordered_map &src): _table(src._table) {}
+
+# if FT_CXX11
+    /**
+     * Move constructor, src is left empty
+     * @param src Another unordered_map object of the same type
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_map<Key, T, Hash, KeyEqual, Alloc>::unordered_map(unordered_map &&src): _table(std::move(src._table)) {}
+# endif
+
+    /**
+     * Destructor
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_map<Key, T, Hash, KeyEqual, Alloc>::~unordered_map() {}
+
+    /**
+     * Copy container content
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_map<Key, T, Hash, KeyEqual, Alloc> &unordered_map<Key, T, Hash, KeyEqual, Alloc>::operator=(const unordered_map &other) {
+        if (this == &other)
+            return (*this);
+        _table = other._table;
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    unordered_map<Key, T, Hash, KeyEqual, Alloc> &unordered_map<Key, T, Hash, KeyEqual, Alloc>::operator=(unordered_map &&other) {
+        _table = std::move(other._table);
+        return (*this);
+    }
+# endif
+
+    /**
+     * Return iterator to beginning
+     * @return An iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::begin() {
+        return (_table.begin());
+    }
+
+    /**
+     * Return const iterator to beginning
+     * @return A const iterator to the first element in the container
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::const_iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::begin() const {
+        return (_table.begin());
+    }
+
+    /**
+     * Return iterator to end
+     * @return An iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::end() {
+        return (_table.end());
+    }
+
+    /**
+     * Return const iterator to end
+     * @return A const iterator to the past-the-end element in the container
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::const_iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::end() const {
+        return (_table.end());
+    }
+
+    /**
+     * Test whether container is empty
+     * @return true if the container size is 0, false otherwise
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    bool unordered_map<Key, T, Hash, KeyEqual, Alloc>::empty() const {
+        return (_table.empty());
+    }
+
+    /**
+     * Return container size
+     * @return The number of elements in the container
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::size_type unordered_map<Key, T, Hash, KeyEqual, Alloc>::size() const {
+        return (_table.size());
+    }
+
+    /**
+     * Return maximum size
+     * @return The maximum number of elements the container can hold as content
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::size_type unordered_map<Key, T, Hash, KeyEqual, Alloc>::max_size() const {
+        return (_table.max_size());
+    }
+
+    /**
+     * Access element, an existing element is found without building a value
+     * @param k Key value of the element whose mapped value is accessed
+     * @return A reference to the mapped value of the element with a key value equal to k
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::mapped_type &unordered_map<Key, T, Hash, KeyEqual, Alloc>::operator[](const key_type &k) {
+        iterator it = _table.find(k);
+
+        if (it == end())
+            it = _table.insert(value_type(k, mapped_type())).first;
+        return (it->second);
+    }
+
+    /**
+     * Access element
+     * @param k Key value of the element whose mapped value is accessed
+     * @return A reference to the mapped value of the element with a key value equal to k
+     * @throw std::out_of_range if there is no such element
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::mapped_type &unordered_map<Key, T, Hash, KeyEqual, Alloc>::at(const key_type &k) {
+        iterator it = _table.find(k);
+
+        if (it == end())
+            throw std::out_of_range("unordered_map::at");
+        return (it->second);
+    }
+
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    const typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::mapped_type &unordered_map<Key, T, Hash, KeyEqual, Alloc>::at(const key_type &k) const {
+        const_iterator it = _table.find(k);
+
+        if (it == end())
+            throw std::out_of_range("unordered_map::at");
+        return (it->second);
+    }
+
+    /**
+     * Insert elements
+     * @param val Value to be copied to the inserted element
+     * @return A pair, with its member pair::first set to an iterator pointing to either the newly inserted element or
+     *         to the element with an equal key in the container. The pair::second element in the pair is set to true
+     *         if a new element was inserted or false if an equal key already existed
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    pair<typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator, bool> unordered_map<Key, T, Hash, KeyEqual, Alloc>::insert(const value_type &val) {
+        return (_table.insert(val));
+    }
+
+    /**
+     * Insert elements, the hint is not used
+     * @param position Hint for the position where the element can be inserted
+     * @param val      Value to be copied to the inserted element
+     * @return Iterator pointing to either the newly inserted element or to the element that already had an equal key
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::insert(iterator position, const value_type &val) {
+        (void)position;
+        return (_table.insert(val).first);
+    }
+
+# if FT_CXX11
+    /**
+     * Insert elements
+     * @param val Value to be moved to the inserted element
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    pair<typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator, bool> unordered_map<Key, T, Hash, KeyEqual, Alloc>::insert(value_type &&val) {
+        return (_table.insert(std::move(val)));
+    }
+
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::insert(iterator position, value_type &&val) {
+        (void)position;
+        return (_table.insert(std::move(val)).first);
+    }
+
+    /**
+     * Construct and insert element
+     * @param args Arguments forwarded to the constructor of the new element
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    template<typename... Args>
+    pair<typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator, bool> unordered_map<Key, T, Hash, KeyEqual, Alloc>::emplace(Args&&... args) {
+        return (_table.emplace(std::forward<Args>(args)...));
+    }
+
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    template<typename... Args>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::emplace_hint(iterator position, Args&&... args) {
+        (void)position;
+        return (_table.emplace(std::forward<Args>(args)...).first);
+    }
+
+    /**
+     * Insert element if the key is not present, nothing is constructed or moved from otherwise
+     * @param k    Key of the element
+     * @param args Arguments forwarded to the constructor of the mapped value
+     * @return A pair of an iterator to the inserted or the already present element, and whether the element was inserted
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    template<typename... Args>
+    pair<typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator, bool> unordered_map<Key, T, Hash, KeyEqual, Alloc>::try_emplace(const key_type &k, Args&&... args) {
+        iterator it = _table.find(k);
+
+        if (it != end())
+            return (ft::make_pair(it, false));
+        return (_table.emplace(k, mapped_type(std::forward<Args>(args)...)));
+    }
+
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    template<typename... Args>
+    pair<typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator, bool> unordered_map<Key, T, Hash, KeyEqual, Alloc>::try_emplace(key_type &&k, Args&&... args) {
+        iterator it = _table.find(k);
+
+        if (it != end())
+            return (ft::make_pair(it, false));
+        return (_table.emplace(std::move(k), mapped_type(std::forward<Args>(args)...)));
+    }
+# endif
+
+    /**
+     * Insert elements
+     * @param first Input iterator to the initial position in a range
+     * @param last  Input iterator to the final position in a range
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    template<typename InputIterator>
+    void unordered_map<Key, T, Hash, KeyEqual, Alloc>::insert(InputIterator first, InputIterator last,
+                                                              typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*) {
+        _table.insert(first, last);
+    }
+
+    /**
+     * Erase elements
+     * @param position Iterator pointing to a single element to be removed
+     * @return An iterator to the next element, erasing while iterating visits every element once
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::erase(iterator position) {
+        return (_table.erase(position));
+    }
+
+    /**
+     * Erase elements
+     * @param k Key of the element to be removed
+     * @return Number of elements erased
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::size_type unordered_map<Key, T, Hash, KeyEqual, Alloc>::erase(const key_type &k) {
+        return (_table.erase(k));
+    }
+
+    /**
+     * Erase elements
+     * @param first Iterator to the initial position in a range
+     * @param last  Iterator to the final position in a range
+     * @return An iterator to the element that follows the erased ones
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::erase(iterator first, iterator last) {
+        return (_table.erase(first, last));
+    }
+
+    /**
+     * Swap content
+     * @param x Another unordered_map container of the same type as this
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key, T, Hash, KeyEqual, Alloc>::swap(unordered_map &x) {
+        _table.swap(x._table);
+    }
+
+    /**
+     * Clear content, the buckets are kept
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key, T, Hash, KeyEqual, Alloc>::clear() {
+        _table.clear();
+    }
+
+    /**
+     * Get iterator to element
+     * @param k Key to be searched for
+     * @return An iterator to the element, if an element with specified key is found, or end otherwise
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::find(const key_type &k) {
+        return (_table.find(k));
+    }
+
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::const_iterator unordered_map<Key, T, Hash, KeyEqual, Alloc>::find(const key_type &k) const {
+        return (_table.find(k));
+    }
+
+    /**
+     * Count elements with a specific key
+     * @param k Key to search for
+     * @return 1 if the container contains an element with key k, and zero otherwise
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::size_type unordered_map<Key, T, Hash, KeyEqual, Alloc>::count(const key_type &k) const {
+        return (_table.count(k));
+    }
+
+    /**
+     * Get range of equal elements
+     * @param k Key to search for
+     * @return The range holding the element with key k, empty if there is none
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    pair<typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator, typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::iterator>
+    unordered_map<Key, T, Hash, KeyEqual, Alloc>::equal_range(const key_type &k) {
+        return (_table.equal_range(k));
+    }
+
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    pair<typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::const_iterator, typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::const_iterator>
+    unordered_map<Key, T, Hash, KeyEqual, Alloc>::equal_range(const key_type &k) const {
+        return (_table.equal_range(k));
+    }
+
+    /**
+     * Return number of buckets
+     * @return A power of two, or 0 before the first insertion
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::size_type unordered_map<Key, T, Hash, KeyEqual, Alloc>::bucket_count() const {
+        return (_table.bucket_count());
+    }
+
+    /**
+     * Return load factor
+     * @return The number of elements per bucket
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    float unordered_map<Key, T, Hash, KeyEqual, Alloc>::load_factor() const {
+        return (_table.load_factor());
+    }
+
+    /**
+     * Return maximum load factor
+     * @return The load factor the table grows past, 0.8 by default
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    float unordered_map<Key, T, Hash, KeyEqual, Alloc>::max_load_factor() const {
+        return (_table.max_load_factor());
+    }
+
+    /**
+     * Set maximum load factor, at most 1 since every element takes a slot of its own
+     * @param ml New maximum load factor
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key, T, Hash, KeyEqual, Alloc>::max_load_factor(float ml) {
+        _table.max_load_factor(ml);
+    }
+
+    /**
+     * Set number of buckets
+     * @param n Minimum number of buckets
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key, T, Hash, KeyEqual, Alloc>::rehash(size_type n) {
+        _table.rehash(n);
+    }
+
+    /**
+     * Request a capacity change
+     * @param n Number of elements the container can hold without growing
+     */
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    void unordered_map<Key, T, Hash, KeyEqual, Alloc>::reserve(size_type n) {
+        _table.reserve(n);
+    }
+
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::hasher unordered_map<Key, T, Hash, KeyEqual, Alloc>::hash_function() const {
+        return (_table.hash_function());
+    }
+
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::key_equal unordered_map<Key, T, Hash, KeyEqual, Alloc>::key_eq() const {
+        return (_table.key_eq());
+    }
+
+    template<typename Key, typename T, typename Hash, typename KeyEqual, typename Alloc>
+    typename unordered_map<Key, T, Hash, KeyEqual, Alloc>::allocator_type unordered_map<Key, T, Hash, KeyEqual, Alloc>::get_allocator() const {
+        return (_table.get_allocator());
+    }
+
+}
+
+#endif //FT_CONTAINERS_UNORDERED_MAP_HPP
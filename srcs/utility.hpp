@@ -2,6 +2,11 @@
 # define FT_CONTAINERS_UTILITY_HPP
 
 # include <ostream>
+# include "type_traits.hpp"
+# if FT_CXX11
+#  include <memory>
+#  include <type_traits>
+# endif
 
 namespace ft {
 
@@ -24,6 +29,18 @@ namespace ft {
         pair(const first_type &a, const second_type &b);
 
         pair &operator=(const pair &pr);
+
+# if FT_CXX11
+        pair(const pair &pr) = default;
+        pair(pair &&pr) = default;
+        template<typename U, typename V, typename = typename std::enable_if<
+            std::is_constructible<T1, U&&>::value && std::is_constructible<T2, V&&>::value>::type>
+        pair(U &&a, V &&b);
+        template<typename U, typename V>
+        pair(pair<U, V> &&pr);
+
+        pair &operator=(pair &&pr);
+# endif
     };
 
     template<typename T1, typename T2>
@@ -47,6 +64,28 @@ namespace ft {
         return (*this);
     }
 
+# if FT_CXX11
+    /**
+     * Construct pair from values moved or forwarded into its members
+     * @param a Value for the member first
+     * @param b Value for the member second
+     */
+    template<typename T1, typename T2>
+    template<typename U, typename V, typename>
+    pair<T1, T2>::pair(U &&a, V &&b): first(std::forward<U>(a)), second(std::forward<V>(b)) {}
+
+    template<typename T1, typename T2>
+    template<typename U, typename V>
+    pair<T1, T2>::pair(pair<U, V> &&pr): first(std::forward<U>(pr.first)), second(std::forward<V>(pr.second)) {}
+
+    template<typename T1, typename T2>
+    pair<T1, T2> &pair<T1, T2>::operator=(pair &&pr) {
+        first = std::move(pr.first);
+        second = std::move(pr.second);
+        return (*this);
+    }
+# endif
+
     template<typename T1, typename T2>
     bool operator==(const pair<T1, T2> &lhs, const pair<T1, T2> &rhs) {
         return (lhs.first == rhs.first && lhs.second == rhs.second);
@@ -94,6 +133,64 @@ namespace ft {
         return (o);
     }
 
+    /**
+     * A pair can be moved with memcpy when both of its members can, whatever its assignment operator does
+     */
+    template<typename T1, typename T2>
+    struct is_trivially_relocatable< pair<T1, T2> >: integral_constant<bool,
+        is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value
+    > {};
+
+    /**
+     * pair declares its copy assignment whatever its members are, it can only be used when both members can be assigned
+     */
+    template<typename T1, typename T2>
+    struct is_copy_assignable< pair<T1, T2> >: integral_constant<bool,
+        is_copy_assignable<T1>::value && is_copy_assignable<T2>::value
+    > {};
+
+    /**
+     * Construct an object in storage obtained from alloc, through std::allocator_traits in a C++11 build:
+     * it forwards any arguments to alloc.construct when the allocator has one, and calls placement new otherwise,
+     * so it does not rely on std::allocator::construct (deprecated in C++17 and removed in C++20)
+     * @param alloc Allocator the storage comes from
+     * @param p     Pointer to raw storage for one object
+     * @param args  Arguments forwarded to the constructor (in C++98, the value to copy)
+     */
+# if FT_CXX11
+    template<typename Alloc, typename U, typename... Args>
+    void allocator_construct(Alloc &alloc, U *p, Args&&... args) {
+        std::allocator_traits<Alloc>::construct(alloc, p, std::forward<Args>(args)...);
+    }
+# else
+    template<typename Alloc, typename U, typename V>
+    void allocator_construct(Alloc &alloc, U *p, const V &val) {
+        alloc.construct(p, val);
+    }
+# endif
+
+    /**
+     * Tag for the map and set constructors and insert overloads that take a range already sorted by key
+     * and holding no equivalent keys, the tree is then built in linear time without comparing the elements
+     */
+    struct assume_sorted_t {};
+
+    static const assume_sorted_t assume_sorted = assume_sorted_t();
+
+# if FT_CXX11
+    /**
+     * Tag for the set operations on two sets or maps that divide the work between threads (C++11).
+     * Holds the number of threads, 0 for as many as the hardware runs at once
+     */
+    struct parallel_t {
+        size_t threads;
+
+        explicit parallel_t(size_t n = 0): threads(n) {}
+    };
+
+    static const parallel_t parallel = parallel_t();
+# endif
+
 }
 
 #endif //FT_CONTAINERS_UTILITY_HPP
@@ -7,7 +7,10 @@ namespace ft {
 
 # include <memory>
 # include <stdexcept>
+# include <cstring>
 # include "algorithm.hpp"
+# include "type_traits.hpp"
+# include "utility.hpp"
 # include "iterators/vector_iterator.hpp"
 
 namespace ft {
@@ -40,6 +43,13 @@ namespace ft {
         pointer        _data;
 
         void           _realloc(size_type n);
+        void           _relocate(pointer dst, pointer src, size_type n);
+        void           _relocate(pointer dst, pointer src, size_type n, ft::true_type);
+        void           _relocate(pointer dst, pointer src, size_type n, ft::false_type);
+        void           _copy_prefix(const_pointer src, size_type n, ft::true_type);
+        void           _copy_prefix(const_pointer src, size_type n, ft::false_type);
+        iterator       _make_gap(iterator position, size_type n);
+        void           _close_gap(iterator position, size_type filled, size_type n);
 
     public:
         explicit vector(const allocator_type &alloc = allocator_type());
@@ -49,10 +59,16 @@ namespace ft {
         vector(InputIterator first, InputIterator last, const allocator_type &alloc = allocator_type(),
                typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type * = NULL);
         vector(const vector &src);
+# if FT_CXX11
+        vector(vector &&src);
+# endif
 
         ~vector();
 
         vector &operator=(const vector &other);
+# if FT_CXX11
+        vector &operator=(vector &&other);
+# endif
 
         iterator               begin();
         const_iterator         begin() const;
@@ -92,9 +108,19 @@ namespace ft {
         void                   assign(size_type n, const value_type &val);
 
         void                   push_back(const value_type &val);
+# if FT_CXX11
+        void                   push_back(value_type &&val);
+        template<typename... Args>
+        reference              emplace_back(Args&&... args);
+# endif
         void                   pop_back();
 
         iterator               insert(iterator position, const value_type &val);
+# if FT_CXX11
+        iterator               insert(iterator position, value_type &&val);
+        template<typename... Args>
+        iterator               emplace(iterator position, Args&&... args);
+# endif
         void                   insert(iterator position, size_type n, const value_type &val);
         template<typename InputIterator>
         void                   insert(iterator position, InputIterator first, InputIterator last,
@@ -116,9 +142,11 @@ namespace ft {
 
         pointer _new_data = _alloc.allocate(n);
 
-        for (size_type i = 0; i < _size; i++) {
-            _alloc.construct(_new_data + i, _data[i]);
-            _alloc.destroy(_data + i);
+        try {
+            _relocate(_new_data, _data, _size);
+        } catch (...) {
+            _alloc.deallocate(_new_data, n);
+            throw;
         }
 
         _alloc.deallocate(_data, _capacity);
@@ -126,6 +154,158 @@ namespace ft {
         _capacity = n;
     }
 
+    /**
+     * Move n elements to possibly overlapping raw memory, the source is left as raw memory
+     * @param dst Destination of the first element
+     * @param src First element to move
+     * @param n   Number of elements
+     */
+    template<typename T, typename Alloc>
+    void vector<T, Alloc>::_relocate(pointer dst, pointer src, size_type n) {
+        if (dst == src || !n)
+            return;
+        _relocate(dst, src, n, ft::integral_constant<bool, ft::is_trivially_relocatable<T>::value>());
+    }
+
+    /**
+     * Bulk relocation of trivially relocatable elements
+     */
+    template<typename T, typename Alloc>
+    void vector<T, Alloc>::_relocate(pointer dst, pointer src, size_type n, ft::true_type) {
+        std::memmove(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+    }
+
+    /**
+     * Element by element relocation: copy (or move, in C++11) construct into the destination, then destroy the source.
+     * Between disjoint buffers every element is constructed before any source is destroyed, so if a copy throws the
+     * copies made so far are destroyed and the source is left as it was. Within one buffer the walk direction makes
+     * sure a destination slot is always raw memory when it gets constructed; if a copy throws, the elements already
+     * moved and the ones not moved yet are all destroyed, and the whole range is left as raw memory
+     */
+    template<typename T, typename Alloc>
+    void vector<T, Alloc>::_relocate(pointer dst, pointer src, size_type n, ft::false_type) {
+        size_type i = 0;
+
+        if (dst + n <= src || src + n <= dst) {
+            try {
+                for (; i < n; i++)
+                    ft::allocator_construct(_alloc, dst + i, FT_MOVE(src[i]));
+            } catch (...) {
+                while (i > 0)
+                    _alloc.destroy(dst + --i);
+                throw;
+            }
+            for (i = 0; i < n; i++)
+                _alloc.destroy(src + i);
+        } else if (dst < src) {
+            try {
+                for (; i < n; i++) {
+                    ft::allocator_construct(_alloc, dst + i, FT_MOVE(src[i]));
+                    _alloc.destroy(src + i);
+                }
+            } catch (...) {
+                for (size_type j = 0; j < i; j++)
+                    _alloc.destroy(dst + j);
+                for (size_type j = i; j < n; j++)
+                    _alloc.destroy(src + j);
+                throw;
+            }
+        } else {
+            try {
+                for (i = n; i > 0; i--) {
+                    ft::allocator_construct(_alloc, dst + i - 1, FT_MOVE(src[i - 1]));
+                    _alloc.destroy(src + i - 1);
+                }
+            } catch (...) {
+                for (size_type j = 0; j < i; j++)
+                    _alloc.destroy(src + j);
+                for (size_type j = i; j < n; j++)
+                    _alloc.destroy(dst + j);
+                throw;
+            }
+        }
+    }
+
+    /**
+     * Copy the first n elements of src over the first n elements of the container, by assignment
+     * @param src First element to copy
+     * @param n   Number of elements, at most size()
+     */
+    template<typename T, typename Alloc>
+    void vector<T, Alloc>::_copy_prefix(const_pointer src, size_type n, ft::true_type) {
+        for (size_type i = 0; i < n; i++)
+            _data[i] = src[i];
+    }
+
+    /**
+     * Copy the first n elements of src over the first n elements of the container, for elements that cannot be
+     * assigned such as the pairs of a flat_map: each one is destroyed and copy constructed in place.
+     * If a copy throws, the elements from the failed one on are destroyed and the container keeps the ones copied
+     */
+    template<typename T, typename Alloc>
+    void vector<T, Alloc>::_copy_prefix(const_pointer src, size_type n, ft::false_type) {
+        size_type i = 0;
+
+        try {
+            for (; i < n; i++) {
+                _alloc.destroy(_data + i);
+                _alloc.construct(_data + i, src[i]);
+            }
+        } catch (...) {
+            while (_size > i + 1)
+                _alloc.destroy(_data + --_size);
+            _size = i;
+            throw;
+        }
+    }
+
+    /**
+     * Grow storage if needed and shift the elements from position on n slots to the right
+     * @param position Position of the gap
+     * @param n        Number of slots
+     * @return Iterator to the first slot of the gap, the slots are raw memory and not counted in size
+     */
+    template<typename T, typename Alloc>
+    typename vector<T, Alloc>::iterator vector<T, Alloc>::_make_gap(iterator position, size_type n) {
+        difference_type offset = position - begin();
+
+        if (_size + n > _capacity)
+            _realloc(ft::max(ft::min(_capacity * 2, max_size()), _size + n));
+
+        position = begin() + offset;
+
+        try {
+            _relocate(position.base() + n, position.base(), end() - position);
+        } catch (...) {
+            _size = offset;
+            throw;
+        }
+
+        return (position);
+    }
+
+    /**
+     * Undo _make_gap once constructing an element in the gap threw: destroy the elements constructed in it
+     * and shift the elements after it back. If that shift throws too, the vector ends before the gap
+     * @param position Position of the gap
+     * @param filled   Number of slots of the gap already constructed
+     * @param n        Number of slots
+     */
+    template<typename T, typename Alloc>
+    void vector<T, Alloc>::_close_gap(iterator position, size_type filled, size_type n) {
+        size_type offset = position - begin();
+
+        for (size_type i = 0; i < filled; i++)
+            _alloc.destroy(position.base() + i);
+
+        try {
+            _relocate(position.base(), position.base() + n, _size - offset);
+        } catch (...) {
+            _size = offset;
+            throw;
+        }
+    }
+
     /**
      * Empty container constructor (default constructor)
      * @param alloc Allocator object
@@ -145,7 +325,13 @@ namespace ft {
     vector<T, Alloc>::vector(vector::size_type n, const value_type &val,
                              const allocator_type &alloc): _alloc(alloc), _capacity(n), _size(0) {
         _data = _alloc.allocate(_capacity);
-        insert(begin(), n, val);
+        try {
+            insert(begin(), n, val);
+        } catch (...) {
+            clear();
+            _alloc.deallocate(_data, _capacity);
+            throw;
+        }
     }
 
     /**
@@ -159,7 +345,13 @@ namespace ft {
     vector<T, Alloc>::vector(InputIterator first, InputIterator last, const allocator_type &alloc,
                              typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*): _alloc(alloc), _capacity(0), _size(0) {
         _data = _alloc.allocate(_capacity);
-        insert(begin(), first, last);
+        try {
+            insert(begin(), first, last);
+        } catch (...) {
+            clear();
+            _alloc.deallocate(_data, _capacity);
+            throw;
+        }
     }
 
     /**
@@ -169,8 +361,27 @@ namespace ft {
     template<typename T, typename Alloc>
     vector<T, Alloc>::vector(const vector &src): _alloc(src._alloc), _capacity(src._capacity), _size(0) {
         _data = _alloc.allocate(_capacity);
-        insert(begin(), src.begin(), src.end());
+        try {
+            insert(begin(), src.begin(), src.end());
+        } catch (...) {
+            clear();
+            _alloc.deallocate(_data, _capacity);
+            throw;
+        }
+    }
+
+# if FT_CXX11
+    /**
+     * Move constructor, takes over the storage of src and leaves it empty
+     * @param src Another vector object of the same type
+     */
+    template<typename T, typename Alloc>
+    vector<T, Alloc>::vector(vector &&src): _alloc(src._alloc), _capacity(src._capacity), _size(src._size), _data(src._data) {
+        src._capacity = 0;
+        src._size = 0;
+        src._data = NULL;
     }
+# endif
 
     template<typename T, typename Alloc>
     vector<T, Alloc>::~vector() {
@@ -178,20 +389,59 @@ namespace ft {
         _alloc.deallocate(_data, _capacity);
     }
 
+    /**
+     * Copy container content.
+     * The storage is kept if other fits in the capacity: the elements both vectors have are assigned in place (or
+     * destroyed and copy constructed, when they cannot be assigned), the ones other has in excess are copy constructed after them and the remaining ones are destroyed.
+     * Otherwise the elements are destroyed and other is copied into storage of exactly its size
+     * @param other A vector object of the same type
+     * @return *this
+     */
     template<typename T, typename Alloc>
     vector<T, Alloc> &vector<T, Alloc>::operator=(const vector &other) {
         if (this == &other)
             return (*this);
 
+        if (other._size > _capacity) {
+            clear();
+            _realloc(other._size);
+        }
+
+        size_type common = ft::min(_size, other._size);
+
+        _copy_prefix(other._data, common, ft::integral_constant<bool, ft::is_copy_assignable<T>::value>());
+        for (; _size < other._size; _size++)
+            _alloc.construct(_data + _size, other._data[_size]);
+        while (_size > other._size)
+            _alloc.destroy(_data + --_size);
+
+        return (*this);
+    }
+
+# if FT_CXX11
+    /**
+     * Move container content, other is left empty
+     */
+    template<typename T, typename Alloc>
+    vector<T, Alloc> &vector<T, Alloc>::operator=(vector &&other) {
+        if (this == &other)
+            return (*this);
+
         clear();
+        _alloc.deallocate(_data, _capacity);
 
         _alloc = other._alloc;
         _capacity = other._capacity;
+        _size = other._size;
+        _data = other._data;
 
-        insert(begin(), other.begin(), other.end());
+        other._capacity = 0;
+        other._size = 0;
+        other._data = NULL;
 
         return (*this);
     }
+# endif
 
     /**
      * Return iterator to beginning
@@ -436,6 +686,41 @@ namespace ft {
         insert(end(), val);
     }
 
+# if FT_CXX11
+    /**
+     * Add element at the end
+     * @param val Value to be moved to the new element
+     */
+    template<typename T, typename Alloc>
+    void vector<T, Alloc>::push_back(value_type &&val) {
+        insert(end(), std::move(val));
+    }
+
+    /**
+     * Construct element in place at the end
+     * @param args Arguments forwarded to the constructor of the new element
+     * @return A reference to the new element
+     */
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    typename vector<T, Alloc>::reference vector<T, Alloc>::emplace_back(Args&&... args) {
+        if (_size + 1 > _capacity) {
+            value_type tmp(std::forward<Args>(args)...);
+            iterator   position = _make_gap(end(), 1);
+            try {
+                ft::allocator_construct(_alloc, position.base(), std::move(tmp));
+            } catch (...) {
+                _close_gap(position, 0, 1);
+                throw;
+            }
+        } else {
+            ft::allocator_construct(_alloc, _data + _size, std::forward<Args>(args)...);
+        }
+        _size++;
+        return (back());
+    }
+# endif
+
     /**
      * Delete last element
      */
@@ -452,22 +737,66 @@ namespace ft {
      */
     template<typename T, typename Alloc>
     typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(vector::iterator position, const value_type &val) {
-        difference_type offset = position - begin();
+        if (&val >= _data && &val < _data + _size) {
+            value_type copy(val);
+            return (insert(position, FT_MOVE(copy)));
+        }
 
-        if (_size + 1 > _capacity)
-            _realloc(ft::max(ft::min(_capacity * 2, max_size()), 1ul));
+        position = _make_gap(position, 1);
 
-        position = begin() + offset;
+        try {
+            _alloc.construct(position.base(), val);
+        } catch (...) {
+            _close_gap(position, 0, 1);
+            throw;
+        }
+        _size++;
+        return (position);
+    }
 
-        for (vector::iterator it = end() - 1; it >= position; it--) {
-            *(it + 1) = *it;
+# if FT_CXX11
+    /**
+     * Insert elements
+     * @param position Position in the vector where the new element are inserted
+     * @param val      Value to be moved to the inserted elements
+     * @return An iterator that points to the newly inserted element
+     */
+    template<typename T, typename Alloc>
+    typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(vector::iterator position, value_type &&val) {
+        if (&val >= _data && &val < _data + _size) {
+            value_type tmp(std::move(val));
+            return (insert(position, std::move(tmp)));
         }
 
-        _alloc.construct(position.base(), val);
+        position = _make_gap(position, 1);
+
+        try {
+            ft::allocator_construct(_alloc, position.base(), std::move(val));
+        } catch (...) {
+            _close_gap(position, 0, 1);
+            throw;
+        }
         _size++;
         return (position);
     }
 
+    /**
+     * Construct and insert element
+     * @param position Position in the vector where the new element is inserted
+     * @param args     Arguments forwarded to the constructor of the new element
+     * @return An iterator that points to the newly inserted element
+     */
+    template<typename T, typename Alloc>
+    template<typename... Args>
+    typename vector<T, Alloc>::iterator vector<T, Alloc>::emplace(vector::iterator position, Args&&... args) {
+        if (position == end()) {
+            emplace_back(std::forward<Args>(args)...);
+            return (end() - 1);
+        }
+        return (insert(position, value_type(std::forward<Args>(args)...)));
+    }
+# endif
+
     /**
      * Insert elements
      * @param position Position in the vector where the new elements are inserted
@@ -476,19 +805,20 @@ namespace ft {
      */
     template<typename T, typename Alloc>
     void vector<T, Alloc>::insert(vector::iterator position, vector::size_type n, const value_type &val) {
-        difference_type offset = position - begin();
-
-        if (_size + n > _capacity)
-            _realloc(ft::max(ft::min(_capacity * 2, max_size()), _size + n));
-
-        position = begin() + offset;
-
-        for (vector::iterator it = end() - 1; it >= position; it--) {
-            *(it + n) = *it;
+        if (&val >= _data && &val < _data + _size) {
+            value_type copy(val);
+            return (insert(position, n, copy));
         }
 
-        for (vector::iterator it = position; it < position + n; it++) {
-            _alloc.construct(it.base(), val);
+        position = _make_gap(position, n);
+
+        size_type i = 0;
+        try {
+            for (; i < n; i++)
+                _alloc.construct(position.base() + i, val);
+        } catch (...) {
+            _close_gap(position, i, n);
+            throw;
         }
 
         _size += n;
@@ -504,21 +834,17 @@ namespace ft {
     template<typename InputIterator>
     void vector<T, Alloc>::insert(vector::iterator position, InputIterator first, InputIterator last,
                                   typename ft::enable_if<!ft::is_integral<InputIterator>::value && ft::is_input_iterator_tag<typename InputIterator::iterator_category>::value>::type*) {
-        difference_type offset = position - begin();
         difference_type n = ft::distance(first, last);
 
-        if (_size + n > _capacity)
-            _realloc(ft::max(ft::min(_capacity * 2, max_size()), _size + n));
-
-        position = begin() + offset;
-
-        for (vector::iterator it = end() - 1; it >= position; it--) {
-            *(it + n) = *it;
-        }
+        position = _make_gap(position, n);
 
-        for (vector::iterator it = position; it < position + n; it++) {
-            _alloc.construct(it.base(), *first);
-            first++;
+        difference_type i = 0;
+        try {
+            for (; i < n; i++, first++)
+                _alloc.construct(position.base() + i, *first);
+        } catch (...) {
+            _close_gap(position, i, n);
+            throw;
         }
 
         _size += n;
@@ -534,8 +860,11 @@ namespace ft {
     typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(vector::iterator position) {
         _alloc.destroy(position.base());
 
-        for (iterator it = position; it < end() - 1; it++) {
-            *it = *(it + 1);
+        try {
+            _relocate(position.base(), position.base() + 1, end() - position - 1);
+        } catch (...) {
+            _size = position - begin();
+            throw;
         }
 
         _size--;
@@ -557,8 +886,11 @@ namespace ft {
             _alloc.destroy(it.base());
         }
 
-        for (iterator it = last; it < end(); it++) {
-            *(it - n) = *it;
+        try {
+            _relocate(first.base(), last.base(), end() - last);
+        } catch (...) {
+            _size = first - begin();
+            throw;
         }
 
         _size -= n;